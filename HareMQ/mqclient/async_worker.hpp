@@ -9,7 +9,7 @@
 
 #include "../mqcommon/helper.hpp"
 #include "../mqcommon/logger.hpp"
-#include "../mqcommon/thread_pool.hpp"
+#include "delivery_executor.hpp"
 #include "muduo/net/EventLoopThread.h"
 
 namespace hare_mq {
@@ -17,7 +17,9 @@ class async_worker {
 public:
     using ptr = std::shared_ptr<async_worker>;
     muduo::net::EventLoopThread loop_thread;
-    thread_pool pool;
+    delivery_executor executor; // 推送消息的处理线程，同一个消费者的消息按顺序处理
+    async_worker(size_t delivery_threads = 1)
+        : executor(delivery_threads) { }
 };
 } // namespace hare_mq
 
@@ -13,77 +13,149 @@
 #include "../mqcommon/protocol.pb.h"
 #include "../mqcommon/thread_pool.hpp"
 #include "consumer.hpp"
+#include "response_slots.hpp"
+#include "muduo/net/EventLoop.h"
 #include "muduo/net/TcpConnection.h"
 #include "muduo/protoc/codec.h"
 #include "muduo/protoc/dispatcher.h"
-#include <condition_variable>
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <set>
 
 namespace hare_mq {
 using ProtobufCodecPtr = std::shared_ptr<ProtobufCodec>;
 using basicConsumeResponsePtr = std::shared_ptr<basicConsumeResponse>;
 using basicCommonResponsePtr = std::shared_ptr<basicCommonResponse>;
-using basicQueryResponsePtr = std::shared_ptr<basicQueryResponse>; //
-class channel {
+using basicQueryResponsePtr = std::shared_ptr<basicQueryResponse>;
+using basicGetResponsePtr = std::shared_ptr<basicGetResponse>;
+using metricsResponsePtr = std::shared_ptr<metricsResponse>;
+using statsResponsePtr = std::shared_ptr<statsResponse>; //
+// 异步请求的回调，参数是服务器的处理结果
+// 回调在连接的 IO 线程中执行，不能阻塞，也不能在回调里调用同步接口(会等不到自己的响应)
+using rpc_callback = std::function<void(bool)>;
+#define ACK_BATCH_SIZE 64 // 攒够这么多条确认就立即发送
+#define ACK_FLUSH_INTERVAL 0.01 // 否则最多等待这么久(秒)再发送
+class channel : public std::enable_shared_from_this<channel> {
 public:
     using ptr = std::shared_ptr<channel>; //
 private:
     std::string __cid;
-    muduo::net::TcpConnectionPtr __conn;
+    muduo::net::TcpConnectionPtr __conn; // 断线时为空，用 std::atomic_load/atomic_store 访问
+    std::atomic<uint64_t> __epoch; // 每断线一次加一，丢弃断线前还没处理完的推送
     ProtobufCodecPtr __codec;
-    consumer::ptr __consumer;
-    std::mutex __mtx;
-    std::condition_variable __cv;
-    std::unordered_map<std::string, basicCommonResponsePtr> __basic_resp; //
-    std::unordered_map<std::string, basicQueryResponsePtr> __basic_query_resp; //
+    std::mutex __consumer_mtx;
+    std::unordered_map<std::string, consumer::ptr> __consumers; // 一个信道可以有多个消费者: consumer_tag -> consumer
+    response_slots<basicCommonResponsePtr> __basic_resp; // 每个请求一个槽位，响应到达时只唤醒对应的等待者
+    response_slots<basicQueryResponsePtr> __basic_query_resp;
+    response_slots<basicGetResponsePtr> __basic_get_resp;
+    response_slots<metricsResponsePtr> __metrics_resp;
+    response_slots<statsResponsePtr> __stats_resp; //
+private:
+    // 在这个信道上声明过的交换机/队列/绑定，断线重连之后按顺序重新声明
+    std::mutex __topology_mtx;
+    std::map<std::string, declareExchangeRequest> __exchanges;
+    std::map<std::string, declareQueueRequest> __queues;
+    std::map<std::pair<std::string, std::string>, bindRequest> __bindings; // (ename, qname) -> bind
+private:
+    // 批量确认: 消息推送过来时记录投递标签，用户确认时先攒起来，连续的一段用一个 multiple 确认发出去
+    // 投递标签(推送和拉取的)都在连接的 IO 线程中、交给用户之前登记，登记顺序就是服务器发送的顺序
+    // 所以还没有登记的标签一定比已经登记的都大，__unacked_tags 中最小的就是信道上最小的未确认标签
+    // 同一个消息id可能同时有多次投递(扇出到同一个信道上的多个消费者、死信转投之后保留原id)，所以按投递标签记录
+    struct delivery_info {
+        uint64_t delivery_tag; // 为0表示服务器没有分配投递标签，只能按消息id确认
+        std::string msgid;
+        std::string consumer_tag;
+        std::string qname;
+    };
+    std::mutex __ack_mtx;
+    std::map<uint64_t, delivery_info> __deliveries; // 还没有被用户确认/拒绝的投递: delivery_tag -> delivery_info
+    std::unordered_map<std::string, std::set<uint64_t>> __delivery_tags; // msg_id -> 这条消息还没有被确认的投递标签(按投递顺序)
+    std::unordered_map<std::string, delivery_info> __untagged; // 老版本的服务器没有投递标签: msg_id -> delivery_info
+    std::set<uint64_t> __unacked_tags; // 已收到但还没有把确认发给服务器的投递标签
+    std::set<uint64_t> __pending_acks; // 用户已经确认，等待发送的投递标签
+    std::unordered_map<std::string, std::string> __pending_gets; // 等待响应的手动确认拉取请求: rid -> queue_name
+    bool __flush_scheduled = false; //
 public:
     channel(const muduo::net::TcpConnectionPtr& conn, const ProtobufCodecPtr& codec)
-        : __conn(conn)
-        , __cid(uuid_helper::uuid())
-        , __codec(codec) { }
+        : __cid(uuid_helper::uuid())
+        , __conn(conn)
+        , __epoch(0)
+        , __codec(codec)
+        , __basic_resp([](const std::string& rid) {
+            auto resp = std::make_shared<basicCommonResponse>();
+            resp->set_rid(rid);
+            resp->set_ok(false);
+            return resp;
+        })
+        , __basic_query_resp([](const std::string& rid) {
+            auto resp = std::make_shared<basicQueryResponse>();
+            resp->set_rid(rid);
+            return resp;
+        })
+        , __basic_get_resp([](const std::string& rid) {
+            auto resp = std::make_shared<basicGetResponse>();
+            resp->set_rid(rid);
+            resp->set_ok(false);
+            return resp;
+        })
+        , __metrics_resp([](const std::string& rid) {
+            auto resp = std::make_shared<metricsResponse>();
+            resp->set_rid(rid);
+            resp->set_ok(false);
+            return resp;
+        })
+        , __stats_resp([](const std::string& rid) {
+            auto resp = std::make_shared<statsResponse>();
+            resp->set_rid(rid);
+            resp->set_ok(false);
+            return resp;
+        }) { }
     ~channel() {
         // 需要取消订阅
         /* note: 如果不取消订阅，也不会有问题，因为我们的服务端很完善，如果被释放，所有东西都会自动解除的 */
-        basic_cancel();
+        // 析构可能发生在连接的 IO 线程中(最后一个引用在 schedule_flush 的定时器回调里释放)，不能等待响应，只发送请求
+        cancel_all_nowait();
     }
     bool open_server_channel() {
-        openChannelRequest req;
-        std::string rid = uuid_helper::uuid();
-        req.set_rid(rid);
-        req.set_cid(__cid);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
-        return resp->ok();
+        return call(open_channel_request());
+    }
+    void open_server_channel_async(const rpc_callback& cb) {
+        call_async(open_channel_request(), cb);
     }
     void close_server_channel() {
         closeChannelRequest req;
         std::string rid = uuid_helper::uuid();
         req.set_rid(rid);
         req.set_cid(__cid);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
+        basicCommonResponsePtr resp = request(req);
     }
     bool declare_exchange(const std::string& name,
         ExchangeType type,
         bool durable,
         bool auto_delete,
         const std::unordered_map<std::string, std::string>& args) {
-        // 构造请求对象
-        declareExchangeRequest req;
-        std::string rid = uuid_helper::uuid();
-        req.set_rid(rid);
-        req.set_cid(__cid);
-        req.set_exchange_name(name);
-        req.set_exchange_type(type);
-        req.set_durable(durable);
-        req.set_auto_delete(auto_delete);
-        auto m = map_helper::ConvertStdMapToProtoMap(args);
-        req.mutable_args()->swap(m);
-        // 向服务器发送请求
-        __codec->send(__conn, req);
-        // 等待响应
-        basicCommonResponsePtr resp = wait_response(rid);
-        return resp->ok();
+        declareExchangeRequest req = declare_exchange_request(name, type, durable, auto_delete, args);
+        if (call(req) == false)
+            return false;
+        remember(req);
+        return true;
+    }
+    void declare_exchange_async(const std::string& name,
+        ExchangeType type,
+        bool durable,
+        bool auto_delete,
+        const std::unordered_map<std::string, std::string>& args,
+        const rpc_callback& cb) {
+        declareExchangeRequest req = declare_exchange_request(name, type, durable, auto_delete, args);
+        std::weak_ptr<channel> weak_self = shared_from_this(); // 回调执行时信道可能已经关闭了
+        call_async(req, [weak_self, req, cb](bool ok) {
+            channel::ptr self = weak_self.lock();
+            if (ok && self)
+                self->remember(req);
+            if (cb)
+                cb(ok);
+        });
     }
     void delete_exchange(const std::string& name) {
         std::string rid = uuid_helper::uuid();
@@ -91,27 +163,39 @@ public:
         req.set_rid(rid);
         req.set_cid(__cid);
         req.set_exchange_name(name);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
+        basicCommonResponsePtr resp = request(req);
+        {
+            std::unique_lock<std::mutex> lock(__topology_mtx);
+            __exchanges.erase(name);
+        }
+        forget_bindings(name, "");
     }
     bool declare_queue(const std::string& qname,
         bool qdurable,
         bool qexclusive,
         bool qauto_delete,
         const std::unordered_map<std::string, std::string>& qargs) {
-        std::string rid = uuid_helper::uuid();
-        declareQueueRequest req;
-        req.set_rid(rid);
-        req.set_cid(__cid);
-        req.set_queue_name(qname);
-        req.set_durable(qdurable);
-        req.set_exclusive(qexclusive);
-        req.set_auto_delete(qauto_delete);
-        auto m = map_helper::ConvertStdMapToProtoMap(qargs);
-        req.mutable_args()->swap(m);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
-        return resp->ok();
+        declareQueueRequest req = declare_queue_request(qname, qdurable, qexclusive, qauto_delete, qargs);
+        if (call(req) == false)
+            return false;
+        remember(req);
+        return true;
+    }
+    void declare_queue_async(const std::string& qname,
+        bool qdurable,
+        bool qexclusive,
+        bool qauto_delete,
+        const std::unordered_map<std::string, std::string>& qargs,
+        const rpc_callback& cb) {
+        declareQueueRequest req = declare_queue_request(qname, qdurable, qexclusive, qauto_delete, qargs);
+        std::weak_ptr<channel> weak_self = shared_from_this(); // 回调执行时信道可能已经关闭了
+        call_async(req, [weak_self, req, cb](bool ok) {
+            channel::ptr self = weak_self.lock();
+            if (ok && self)
+                self->remember(req);
+            if (cb)
+                cb(ok);
+        });
     }
     void delete_queue(const std::string& name) {
         std::string rid = uuid_helper::uuid();
@@ -119,20 +203,30 @@ public:
         req.set_rid(rid);
         req.set_cid(__cid);
         req.set_queue_name(name);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
+        basicCommonResponsePtr resp = request(req);
+        {
+            std::unique_lock<std::mutex> lock(__topology_mtx);
+            __queues.erase(name);
+        }
+        forget_bindings("", name);
     }
     bool bind(const std::string& ename, const std::string& qname, const std::string& key) {
-        std::string rid = uuid_helper::uuid();
-        bindRequest req;
-        req.set_rid(rid);
-        req.set_cid(__cid);
-        req.set_exchange_name(ename);
-        req.set_queue_name(qname);
-        req.set_binding_key(key);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
-        return resp->ok();
+        bindRequest req = bind_request(ename, qname, key);
+        if (call(req) == false)
+            return false;
+        remember(req);
+        return true;
+    }
+    void bind_async(const std::string& ename, const std::string& qname, const std::string& key, const rpc_callback& cb) {
+        bindRequest req = bind_request(ename, qname, key);
+        std::weak_ptr<channel> weak_self = shared_from_this(); // 回调执行时信道可能已经关闭了
+        call_async(req, [weak_self, req, cb](bool ok) {
+            channel::ptr self = weak_self.lock();
+            if (ok && self)
+                self->remember(req);
+            if (cb)
+                cb(ok);
+        });
     }
     void unbind(const std::string& ename, const std::string& qname) {
         std::string rid = uuid_helper::uuid();
@@ -141,43 +235,120 @@ public:
         req.set_cid(__cid);
         req.set_exchange_name(ename);
         req.set_queue_name(qname);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
+        basicCommonResponsePtr resp = request(req);
+        forget_bindings(ename, qname);
     }
     void basic_publish(const std::string& ename, const BasicProperties* bp, const std::string& body) {
-        basicPublishRequest req;
+        call(basic_publish_request(ename, bp, body));
+    }
+    void basic_publish_async(const std::string& ename, const BasicProperties* bp, const std::string& body, const rpc_callback& cb) {
+        call_async(basic_publish_request(ename, bp, body), cb);
+    }
+    void basic_ack(const std::string& msgid, const std::string& consumer_tag = "") {
+        delivery_info info;
+        {
+            std::unique_lock<std::mutex> lock(__ack_mtx);
+            if (untrack(msgid, consumer_tag, info) == false) {
+                LOG(ERROR) << "cannot find delivery info of mesg: " << msgid << std::endl;
+                return;
+            }
+            if (info.delivery_tag != 0) {
+                // 异步批量确认，不等待响应
+                __pending_acks.insert(info.delivery_tag);
+                if (__pending_acks.size() >= ACK_BATCH_SIZE)
+                    __flush_acks();
+                else
+                    schedule_flush();
+                return;
+            }
+        }
+        // 没有投递标签(老版本的服务器)，按消息id确认
+        basicAckRequest req;
         std::string rid = uuid_helper::uuid();
         req.set_rid(rid);
         req.set_cid(__cid);
-        req.set_body(body);
-        req.set_exchange_name(ename);
-        if (bp) {
-            req.mutable_properties()->set_id(bp->id());
-            req.mutable_properties()->set_delivery_mode(bp->delivery_mode());
-            req.mutable_properties()->set_routing_key(bp->routing_key());
+        req.set_queue_name(info.qname); // fix bus
+        req.set_message_id(msgid);
+        basicCommonResponsePtr resp = request(req);
+    } // 同一个消息id有多次投递时，确认 consumer_tag(回调的第一个参数，为空不区分)收到的最早的一次
+    void basic_nack(const std::string& msgid, bool requeue = true, const std::string& consumer_tag = "") {
+        basicNackRequest req;
+        req.set_cid(__cid);
+        req.set_message_id(msgid);
+        req.set_requeue(requeue);
+        delivery_info info;
+        if (take_delivery(msgid, consumer_tag, info) == false) {
+            LOG(ERROR) << "cannot find delivery info of mesg: " << msgid << std::endl;
+            return;
         }
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
-    }
-    void basic_ack(const std::string& msgid) {
-        if (__consumer == nullptr) {
-            LOG(ERROR) << "cannot find consumer info" << std::endl;
+        if (info.delivery_tag != 0) {
+            req.set_delivery_tag(info.delivery_tag);
+            send(req); // 按投递标签拒绝，不等待响应
             return;
         }
-        basicAckRequest req;
         std::string rid = uuid_helper::uuid();
         req.set_rid(rid);
+        req.set_queue_name(info.qname);
+        basicCommonResponsePtr resp = request(req);
+    }
+    void basic_reject(const std::string& msgid, bool requeue = true, const std::string& consumer_tag = "") {
+        basicRejectRequest req;
         req.set_cid(__cid);
-        req.set_queue_name(__consumer->qname); // fix bus
         req.set_message_id(msgid);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
+        req.set_requeue(requeue);
+        delivery_info info;
+        if (take_delivery(msgid, consumer_tag, info) == false) {
+            LOG(ERROR) << "cannot find delivery info of mesg: " << msgid << std::endl;
+            return;
+        }
+        if (info.delivery_tag != 0) {
+            req.set_delivery_tag(info.delivery_tag);
+            send(req);
+            return;
+        }
+        std::string rid = uuid_helper::uuid();
+        req.set_rid(rid);
+        req.set_queue_name(info.qname);
+        basicCommonResponsePtr resp = request(req);
     }
+    size_t basic_get(const std::string& queue_name, size_t max_count, size_t max_bytes, bool auto_ack, const consumer_callback& cb) {
+        // 拉取模式: 一次请求最多取回 max_count 条/max_bytes 字节的消息，逐条交给 cb 处理，返回取到的消息条数
+        basicGetRequest req;
+        std::string rid = uuid_helper::uuid();
+        req.set_rid(rid);
+        req.set_cid(__cid);
+        req.set_queue_name(queue_name);
+        req.set_max_count(max_count);
+        req.set_max_bytes(max_bytes);
+        req.set_auto_ack(auto_ack);
+        if (!auto_ack) {
+            std::unique_lock<std::mutex> lock(__ack_mtx);
+            __pending_gets[rid] = queue_name; // 响应到达时在 IO 线程中登记投递标签(见 push_basic_response)
+        }
+        basicGetResponsePtr resp = send(req) ? wait_get_response(rid) : __basic_get_resp.failure(rid);
+        if (!auto_ack) {
+            std::unique_lock<std::mutex> lock(__ack_mtx);
+            __pending_gets.erase(rid); // 失败/断线时响应没有到达
+        }
+        if (resp->ok() == false) {
+            LOG(ERROR) << "basic get from queue: " << queue_name << " failed!" << std::endl;
+            return 0;
+        }
+        for (auto& m : *resp->mutable_messages())
+            cb(m.consumer_tag(), m.mutable_properties(), m.body());
+        return resp->messages_size();
+    }
+    void flush_acks() {
+        std::unique_lock<std::mutex> lock(__ack_mtx);
+        __flush_acks();
+    } // 立即发送所有攒下来的确认
     bool basic_consume(const std::string& consumer_tag, const std::string& queue_name, bool auto_ack, const consumer_callback& cb) {
-        if (__consumer != nullptr) {
-            // already subscribe another queue
-            LOG(ERROR) << "the channel already subscribed another queue" << std::endl;
-            return false;
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            if (__consumers.find(consumer_tag) != __consumers.end()) {
+                LOG(ERROR) << "the consumer tag: " << consumer_tag << " already exists in this channel" << std::endl;
+                return false;
+            }
         }
         basicConsumeRequest req;
         std::string rid = uuid_helper::uuid();
@@ -186,82 +357,460 @@ public:
         req.set_consumer_tag(consumer_tag);
         req.set_queue_name(queue_name);
         req.set_auto_ack(auto_ack);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
+        // 先登记消费者再发请求，服务器订阅成功后马上就会有消息推送过来
+        auto cp = std::make_shared<consumer>(consumer_tag, queue_name, auto_ack, cb);
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            __consumers.insert({ consumer_tag, cp });
+        }
+        basicCommonResponsePtr resp = request(req);
         if (resp->ok() == false) {
             LOG(ERROR) << "subscribe queue failed!" << std::endl;
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            __consumers.erase(consumer_tag);
             return false;
         }
-        __consumer = std::make_shared<consumer>(consumer_tag, queue_name, auto_ack, cb);
         return true;
     }
-    void basic_cancel() {
-        if (__consumer == nullptr)
-            return;
+    void basic_cancel(const std::string& consumer_tag) {
+        consumer::ptr cp;
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            auto it = __consumers.find(consumer_tag);
+            if (it == __consumers.end())
+                return;
+            cp = it->second;
+        }
+        flush_acks(); // 先把攒下来的确认发出去，剩下没确认的消息服务器会重新入队
         basicCancelRequest req;
         std::string rid = uuid_helper::uuid();
         req.set_rid(rid);
         req.set_cid(__cid);
-        req.set_queue_name(__consumer->qname);
-        req.set_consumer_tag(__consumer->tag);
-        __codec->send(__conn, req);
-        basicCommonResponsePtr resp = wait_response(rid);
-        __consumer.reset();
-    } //
+        req.set_queue_name(cp->qname);
+        req.set_consumer_tag(cp->tag);
+        basicCommonResponsePtr resp = request(req);
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            __consumers.erase(consumer_tag);
+        }
+        // 这个消费者没确认的消息已经被服务器重新入队了，它们的投递标签作废
+        std::unique_lock<std::mutex> lock(__ack_mtx);
+        for (auto it = __deliveries.begin(); it != __deliveries.end();) {
+            if (it->second.consumer_tag != consumer_tag) {
+                ++it;
+                continue;
+            }
+            forget_tag(it->second.msgid, it->first);
+            __unacked_tags.erase(it->first);
+            it = __deliveries.erase(it);
+        }
+        for (auto it = __untagged.begin(); it != __untagged.end();)
+            it = it->second.consumer_tag == consumer_tag ? __untagged.erase(it) : std::next(it);
+    }
+    void cancel_all_nowait() {
+        flush_acks(); // 先把攒下来的确认发出去
+        std::unique_lock<std::mutex> lock(__consumer_mtx);
+        for (const auto& e : __consumers) {
+            basicCancelRequest req;
+            req.set_rid(uuid_helper::uuid());
+            req.set_cid(__cid);
+            req.set_queue_name(e.second->qname);
+            req.set_consumer_tag(e.second->tag);
+            send(req); // 响应到达时信道已经不在了，直接丢弃
+        }
+        __consumers.clear();
+    } // 取消信道上所有的订阅，不等待响应
+    void basic_cancel() {
+        std::vector<std::string> tags;
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            for (const auto& e : __consumers)
+                tags.push_back(e.first);
+        }
+        for (const auto& tag : tags)
+            basic_cancel(tag);
+    } // 取消信道上所有的订阅
     void basic_query() {
         basicQueryRequest req;
         std::string rid = uuid_helper::uuid();
         req.set_rid(rid);
         req.set_cid(__cid);
-        __codec->send(__conn, req);
-        basicQueryResponsePtr resp = wait_query_response(rid);
+        basicQueryResponsePtr resp = send(req) ? wait_query_response(rid) : __basic_query_resp.failure(rid);
         return;
+    }
+    metricsResponsePtr metrics(bool prometheus_text = false) {
+        // 获取服务器的运行指标(吞吐计数、延迟分位数、每个队列的深度等)，失败时 ok 为 false
+        metricsRequest req;
+        std::string rid = uuid_helper::uuid();
+        req.set_rid(rid);
+        req.set_cid(__cid);
+        req.set_prometheus_text(prometheus_text);
+        return send(req) ? __metrics_resp.wait(rid) : __metrics_resp.failure(rid);
+    } //
+    statsResponsePtr stats(StatsSection section = STATS_ALL,
+        const std::string& name_prefix = "",
+        uint32_t offset = 0,
+        uint32_t limit = 0,
+        bool include_bindings = false) {
+        // 结构化的状态查询: 交换机/队列/消费者的列表，按名称前缀过滤，每个部分按名称排序之后分页，失败时 ok 为 false
+        // 翻页时比较响应的 version，变化了说明期间拓扑有修改
+        statsRequest req;
+        std::string rid = uuid_helper::uuid();
+        req.set_rid(rid);
+        req.set_cid(__cid);
+        req.set_section(section);
+        req.set_name_prefix(name_prefix);
+        req.set_offset(offset);
+        req.set_limit(limit);
+        req.set_include_bindings(include_bindings);
+        return send(req) ? __stats_resp.wait(rid) : __stats_resp.failure(rid);
     } //
 public:
     std::string cid() { return this->__cid; }
+    uint64_t epoch() { return __epoch; }
+    void on_disconnected() {
+        // 连接断开: 之后的请求直接失败，正在等待的请求以失败结束
+        std::atomic_store(&__conn, muduo::net::TcpConnectionPtr());
+        ++__epoch;
+        __basic_resp.close();
+        __basic_query_resp.close();
+        __basic_get_resp.close();
+        __metrics_resp.close();
+        __stats_resp.close();
+        // 服务器端的信道已经销毁，没确认的消息都被重新入队了，投递标签全部作废
+        std::unique_lock<std::mutex> lock(__ack_mtx);
+        __deliveries.clear();
+        __delivery_tags.clear();
+        __untagged.clear();
+        __unacked_tags.clear();
+        __pending_acks.clear();
+        __pending_gets.clear();
+    }
+    void recover(const muduo::net::TcpConnectionPtr& conn) {
+        // 重连成功(在 IO 线程中调用): 按 信道 -> 交换机 -> 队列 -> 绑定 -> 消费者 的顺序在新连接上重放
+        // 服务器按顺序处理同一条连接上的请求，所以不需要等待前一个请求的响应
+        __basic_resp.reopen();
+        __basic_query_resp.reopen();
+        __basic_get_resp.reopen();
+        __metrics_resp.reopen();
+        __stats_resp.reopen();
+        replay(conn, open_channel_request());
+        {
+            std::unique_lock<std::mutex> lock(__topology_mtx);
+            for (const auto& e : __exchanges)
+                replay(conn, e.second);
+            for (const auto& e : __queues)
+                replay(conn, e.second);
+            for (const auto& e : __bindings)
+                replay(conn, e.second);
+        }
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            for (const auto& e : __consumers) {
+                basicConsumeRequest req;
+                req.set_cid(__cid);
+                req.set_consumer_tag(e.second->tag);
+                req.set_queue_name(e.second->qname);
+                req.set_auto_ack(e.second->auto_ack);
+                replay(conn, req);
+            }
+        }
+        // 恢复请求都发出去之后，用户的新请求才能使用新连接
+        std::atomic_store(&__conn, conn);
+    }
     void push_basic_response(const basicCommonResponsePtr& resp) {
-        std::unique_lock<std::mutex> lock(__mtx);
-        __basic_resp.insert({ resp->rid(), resp });
-        __cv.notify_all(); // 唤醒 wait_response
-    } // 连接收到响应向hashmap添加响应
+        __basic_resp.push(resp->rid(), resp); // 唤醒 wait_response
+    } // 连接收到响应，交给对应请求的槽位
     void push_basic_response(const basicQueryResponsePtr& resp) {
-        std::unique_lock<std::mutex> lock(__mtx);
-        __basic_query_resp.insert({ resp->rid(), resp });
-        __cv.notify_all(); 
+        __basic_query_resp.push(resp->rid(), resp);
+    }
+    void push_basic_response(const basicGetResponsePtr& resp) {
+        {
+            std::unique_lock<std::mutex> lock(__ack_mtx);
+            auto it = __pending_gets.find(resp->rid());
+            if (it != __pending_gets.end()) {
+                for (const auto& m : resp->messages())
+                    track(m.properties().id(), m.delivery_tag(), "", it->second);
+                __pending_gets.erase(it);
+            }
+        }
+        __basic_get_resp.push(resp->rid(), resp);
+    }
+    void push_basic_response(const metricsResponsePtr& resp) {
+        __metrics_resp.push(resp->rid(), resp);
+    }
+    void push_basic_response(const statsResponsePtr& resp) {
+        __stats_resp.push(resp->rid(), resp);
+    }
+    void track_delivery(const basicConsumeResponsePtr& resp) {
+        // 连接的 IO 线程中调用，在交给推送执行器之前登记投递标签
+        // 如果放到执行器的线程里登记，用户先确认了后面的消息时，前面还没登记的标签会被 multiple 确认一起带走
+        consumer::ptr cp;
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx);
+            auto it = __consumers.find(resp->consumer_tag());
+            if (it == __consumers.end())
+                return; // consume 中会报错
+            cp = it->second;
+        }
+        if (resp->delivery_tag() == 0 && cp->auto_ack)
+            return;
+        std::unique_lock<std::mutex> lock(__ack_mtx);
+        track(resp->properties().id(), resp->delivery_tag(), cp->tag, cp->qname);
     }
     // 连接收到消息推送后，需要通过信道找到对应的消费者对象，通过回调函数进行消息处理
-    void consume(const basicConsumeResponsePtr& resp) {
+    void consume(const basicConsumeResponsePtr& resp, uint64_t epoch) {
         // std::unique_lock<std::mutex> lock(__mtx); // 千千万万不能加锁！这个是线程调的！
-        if (__consumer == nullptr) {
-            LOG(ERROR) << "cannot find subscriber info" << std::endl;
+        if (epoch != __epoch) {
+            // 断线之前收到的推送，服务器已经把它重新入队了，投递标签也已经作废，不能再交给用户
+            LOG(WARNING) << "drop a mesg delivered before reconnecting, consumer tag: " << resp->consumer_tag() << std::endl;
             return;
         }
-        if (__consumer->tag != resp->consumer_tag()) {
-            LOG(ERROR) << "error response, '__consumer->tag != resp->consumer_tag()', consume mesg failed" << std::endl;
+        consumer::ptr cp;
+        {
+            std::unique_lock<std::mutex> lock(__consumer_mtx); // 只在查找的时候加锁，回调不能在锁里面执行
+            auto it = __consumers.find(resp->consumer_tag());
+            if (it != __consumers.end())
+                cp = it->second;
+        }
+        if (cp == nullptr) {
+            LOG(ERROR) << "cannot find subscriber info, consumer tag: " << resp->consumer_tag() << std::endl;
             return;
         }
-        __consumer->callback(resp->consumer_tag(), resp->mutable_properties(), resp->body());
+        cp->callback(resp->consumer_tag(), resp->mutable_properties(), resp->body());
     } //
 private:
-    basicCommonResponsePtr wait_response(const std::string& rid) {
-        std::unique_lock<std::mutex> lock(__mtx);
-        __cv.wait(lock, [&rid, this]() {
-            return __basic_resp.find(rid) != __basic_resp.end();
+    void track(const std::string& msgid, uint64_t delivery_tag, const std::string& consumer_tag, const std::string& qname) {
+        // 调用时需要持有 __ack_mtx
+        delivery_info info = { delivery_tag, msgid, consumer_tag, qname };
+        if (delivery_tag == 0) {
+            __untagged[msgid] = info; // 老版本的服务器本来就只能按消息id确认
+            return;
+        }
+        __deliveries[delivery_tag] = info;
+        __delivery_tags[msgid].insert(delivery_tag);
+        __unacked_tags.insert(delivery_tag);
+    }
+    bool untrack(const std::string& msgid, const std::string& consumer_tag, delivery_info& info) {
+        // 调用时需要持有 __ack_mtx，取走这个消息id最早的一次投递(consumer_tag 不为空时只找这个消费者收到的)
+        auto it = __delivery_tags.find(msgid);
+        if (it != __delivery_tags.end()) {
+            for (uint64_t tag : it->second) {
+                auto dit = __deliveries.find(tag);
+                if (!consumer_tag.empty() && dit->second.consumer_tag != consumer_tag)
+                    continue;
+                info = dit->second;
+                __deliveries.erase(dit);
+                forget_tag(msgid, tag); // 找到之后马上返回，不会继续使用失效的迭代器
+                return true;
+            }
+        }
+        auto uit = __untagged.find(msgid);
+        if (uit == __untagged.end())
+            return false;
+        info = uit->second;
+        __untagged.erase(uit);
+        return true;
+    }
+    void forget_tag(const std::string& msgid, uint64_t delivery_tag) {
+        // 调用时需要持有 __ack_mtx
+        auto it = __delivery_tags.find(msgid);
+        if (it == __delivery_tags.end())
+            return;
+        it->second.erase(delivery_tag);
+        if (it->second.empty())
+            __delivery_tags.erase(it);
+    }
+    bool take_delivery(const std::string& msgid, const std::string& consumer_tag, delivery_info& info) {
+        std::unique_lock<std::mutex> lock(__ack_mtx);
+        if (untrack(msgid, consumer_tag, info) == false)
+            return false;
+        if (info.delivery_tag != 0) {
+            __flush_acks(); // 先于拒绝把之前的确认发出去，此时这条消息还在未确认集合中，累积确认不会越过它
+            __unacked_tags.erase(info.delivery_tag);
+        }
+        return true;
+    } // 拒绝一条消息之前取走它的投递信息
+    void schedule_flush() {
+        // 调用时需要持有 __ack_mtx
+        if (__flush_scheduled)
+            return;
+        muduo::net::TcpConnectionPtr conn = std::atomic_load(&__conn);
+        if (conn == nullptr)
+            return; // 断线了，未确认的消息服务器会重新入队
+        __flush_scheduled = true;
+        std::weak_ptr<channel> weak_self = shared_from_this();
+        conn->getLoop()->runAfter(ACK_FLUSH_INTERVAL, [weak_self]() {
+            channel::ptr self = weak_self.lock();
+            if (self)
+                self->flush_acks();
         });
-        basicCommonResponsePtr bresp = __basic_resp[rid];
-        __basic_resp.erase(rid);
-        return bresp;
+    }
+    void __flush_acks() {
+        // 调用时需要持有 __ack_mtx
+        __flush_scheduled = false;
+        if (__pending_acks.empty())
+            return;
+        // 1. 从信道上最小的未确认标签开始，找出全部已确认的连续一段，用一个 multiple 确认发出去
+        //    这一段在第一个还没有确认的标签(不管属于哪个消费者)之前停下，multiple 确认不会越过它
+        uint64_t last_tag = 0;
+        auto it = __unacked_tags.begin();
+        while (it != __unacked_tags.end() && __pending_acks.count(*it)) {
+            last_tag = *it;
+            __pending_acks.erase(*it);
+            it = __unacked_tags.erase(it);
+        }
+        if (last_tag != 0)
+            send_ack(last_tag, true);
+        // 2. 剩下不连续的确认逐条发送
+        for (uint64_t tag : __pending_acks) {
+            __unacked_tags.erase(tag);
+            send_ack(tag, false);
+        }
+        __pending_acks.clear();
+    }
+    void send_ack(uint64_t delivery_tag, bool multiple) {
+        basicAckRequest req; // 按投递标签确认不需要 rid 和 queue_name
+        req.set_cid(__cid);
+        req.set_delivery_tag(delivery_tag);
+        req.set_multiple(multiple);
+        send(req);
+    }
+    template <typename Req>
+    bool send(const Req& req) {
+        muduo::net::TcpConnectionPtr conn = std::atomic_load(&__conn);
+        if (conn == nullptr || conn->connected() == false) {
+            LOG(ERROR) << "the connection is broken, send " << req.GetTypeName() << " failed" << std::endl;
+            return false;
+        }
+        __codec->send(conn, req);
+        return true;
+    } // 断线的时候直接失败，不会把请求发给已经断开的连接
+    template <typename Req>
+    basicCommonResponsePtr request(const Req& req) {
+        if (send(req) == false)
+            return __basic_resp.failure(req.rid());
+        return wait_response(req.rid());
+    } // 发送请求并等待响应，断线时返回失败的响应
+    template <typename Req>
+    bool call(const Req& req) {
+        basicCommonResponsePtr resp = request(req);
+        return resp->ok();
+    } // 发送请求并等待响应
+    template <typename Req>
+    void call_async(const Req& req, const rpc_callback& cb) {
+        // 先登记回调再发送，响应到达时在连接的 IO 线程中执行回调
+        __basic_resp.expect(req.rid(), [cb](const basicCommonResponsePtr& resp) {
+            if (cb)
+                cb(resp->ok());
+        });
+        if (send(req) == false)
+            __basic_resp.fail(req.rid());
+    } // 发送请求，不等待响应
+    template <typename Req>
+    void replay(const muduo::net::TcpConnectionPtr& conn, Req req) {
+        std::string rid = uuid_helper::uuid();
+        std::string what = req.GetTypeName();
+        req.set_rid(rid);
+        __basic_resp.expect(rid, [what](const basicCommonResponsePtr& resp) {
+            if (resp->ok() == false)
+                LOG(ERROR) << "recover failed: " << what << std::endl;
+        });
+        __codec->send(conn, req);
+    } // 重连恢复时直接在新连接上重发请求
+    void remember(const declareExchangeRequest& req) {
+        std::unique_lock<std::mutex> lock(__topology_mtx);
+        __exchanges[req.exchange_name()] = req;
+    }
+    void remember(const declareQueueRequest& req) {
+        std::unique_lock<std::mutex> lock(__topology_mtx);
+        __queues[req.queue_name()] = req;
+    }
+    void remember(const bindRequest& req) {
+        std::unique_lock<std::mutex> lock(__topology_mtx);
+        __bindings[{ req.exchange_name(), req.queue_name() }] = req;
+    }
+    void forget_bindings(const std::string& ename, const std::string& qname) {
+        // 名字为空表示不按这个字段过滤
+        std::unique_lock<std::mutex> lock(__topology_mtx);
+        for (auto it = __bindings.begin(); it != __bindings.end();) {
+            if ((ename.empty() || it->first.first == ename) && (qname.empty() || it->first.second == qname))
+                it = __bindings.erase(it);
+            else
+                ++it;
+        }
+    }
+    openChannelRequest open_channel_request() {
+        openChannelRequest req;
+        req.set_rid(uuid_helper::uuid());
+        req.set_cid(__cid);
+        return req;
+    }
+    declareExchangeRequest declare_exchange_request(const std::string& name,
+        ExchangeType type,
+        bool durable,
+        bool auto_delete,
+        const std::unordered_map<std::string, std::string>& args) {
+        declareExchangeRequest req;
+        req.set_rid(uuid_helper::uuid());
+        req.set_cid(__cid);
+        req.set_exchange_name(name);
+        req.set_exchange_type(type);
+        req.set_durable(durable);
+        req.set_auto_delete(auto_delete);
+        auto m = map_helper::ConvertStdMapToProtoMap(args);
+        req.mutable_args()->swap(m);
+        return req;
+    }
+    declareQueueRequest declare_queue_request(const std::string& qname,
+        bool qdurable,
+        bool qexclusive,
+        bool qauto_delete,
+        const std::unordered_map<std::string, std::string>& qargs) {
+        declareQueueRequest req;
+        req.set_rid(uuid_helper::uuid());
+        req.set_cid(__cid);
+        req.set_queue_name(qname);
+        req.set_durable(qdurable);
+        req.set_exclusive(qexclusive);
+        req.set_auto_delete(qauto_delete);
+        auto m = map_helper::ConvertStdMapToProtoMap(qargs);
+        req.mutable_args()->swap(m);
+        return req;
+    }
+    bindRequest bind_request(const std::string& ename, const std::string& qname, const std::string& key) {
+        bindRequest req;
+        req.set_rid(uuid_helper::uuid());
+        req.set_cid(__cid);
+        req.set_exchange_name(ename);
+        req.set_queue_name(qname);
+        req.set_binding_key(key);
+        return req;
+    }
+    basicPublishRequest basic_publish_request(const std::string& ename, const BasicProperties* bp, const std::string& body) {
+        basicPublishRequest req;
+        req.set_rid(uuid_helper::uuid());
+        req.set_cid(__cid);
+        req.set_body(body);
+        req.set_exchange_name(ename);
+        if (bp) {
+            req.mutable_properties()->CopyFrom(*bp); // 头部、优先级等属性都要带上，头部交换机和一致性哈希交换机要用
+            if (req.properties().id().empty())
+                req.mutable_properties()->set_id(uuid_helper::uuid());
+        }
+        return req;
+    }
+    basicCommonResponsePtr wait_response(const std::string& rid) {
+        return __basic_resp.wait(rid);
     } // 等待指定请求的响应
     basicQueryResponsePtr wait_query_response(const std::string& rid) {
-        std::unique_lock<std::mutex> lock(__mtx);
-        __cv.wait(lock, [&rid, this]() {
-            return __basic_query_resp.find(rid) != __basic_query_resp.end();
-        });
-        basicQueryResponsePtr bresp = __basic_query_resp[rid];
-        __basic_query_resp.erase(rid);
+        basicQueryResponsePtr bresp = __basic_query_resp.wait(rid);
         std::cout << bresp->body() << std::endl;
         return bresp;
     }
+    basicGetResponsePtr wait_get_response(const std::string& rid) {
+        return __basic_get_resp.wait(rid);
+    }
 };
 
 class channel_manager {
@@ -288,6 +837,13 @@ public:
             return channel::ptr();
         return it->second;
     }
+    std::vector<channel::ptr> channels() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        std::vector<channel::ptr> result;
+        for (const auto& e : __channels)
+            result.push_back(e.second);
+        return result;
+    } // 所有信道的快照，断线/重连时使用
 };
 
 } // namespace hare_mq
@@ -26,6 +26,8 @@ private:
         { "publish", "Push a message to the specified exchange" },
         { "publish_mode", "Continuous push message to specified exchange" },
         { "svrstat", "View the exchange information, queue information and binding information of the current server, note: This is a blocking interface" },
+        { "metrics", "Show the server metrics in Prometheus text format, note: This is a blocking interface" },
+        { "stats", "Show the exchanges, queues and consumers of the server with live queue counters, note: This is a blocking interface" },
         { "declare_exchange", "Declare an exchange on the server" },
         { "declare_queue", "Declare a message queue on the server" },
         { "delete_exchange", "Delete an exchange on the server" },
@@ -140,7 +142,7 @@ private:
     }
     static void cb(hare_mq::channel::ptr& ch, const std::string& tag, const hare_mq::BasicProperties* bp, const std::string& body) {
         std::cout << tag << " recv a mesg# " << body << std::endl;
-        ch->basic_ack(bp->id());
+        ch->basic_ack(bp->id(), tag);
     }
     void print_logo() {
         for (const auto& e : __logo)
@@ -157,7 +159,7 @@ private:
             ss << "    unbind exchange_name queue_name";
         } else if (cmd == "declare_exchange") {
             ss << "    declare_exchange exchange_name ExchangeType durable auto_delete other_args" << std::endl;
-            ss << "    ExchangeType: TOPIC/FANOUT/DIRECT" << std::endl;
+            ss << "    ExchangeType: TOPIC/FANOUT/DIRECT/CONSISTENT_HASH/HEADERS" << std::endl;
             ss << "    durable, auto_delete: true/false" << std::endl;
             ss << "    other_args format: k1=v1&k2=v2&k3=v3...";
         } else if (cmd == "delete_exchange") {
@@ -176,9 +178,38 @@ private:
             ss << "    DURABLE: hare_mq::DeliveryMode::DURABLE/UNDURABLE";
         } else if (cmd == "subscribe") {
             ss << "    subscribe consumer_tag queue_name auto_ack";
+        } else if (cmd == "stats") {
+            ss << "    stats [all/exchanges/queues/consumers] [name_prefix]";
         }
         std::cerr << ss.str() << std::endl;
     }
+    void print_stats(const hare_mq::statsResponsePtr& resp) {
+        if (resp->exchanges_size() != 0) {
+            std::cout << yellow_bold << "exchanges (" << resp->total_exchanges() << "):" << reset << std::endl;
+            for (const auto& e : resp->exchanges()) {
+                std::cout << "    " << e.name() << "  type: " << hare_mq::ExchangeType_Name(e.type())
+                          << "  durable: " << e.durable() << "  auto_delete: " << e.auto_delete()
+                          << "  bindings: " << e.binding_count() << std::endl;
+                for (const auto& b : e.bindings())
+                    std::cout << "        <--> " << b.queue_name() << ", binding_key: " << b.binding_key() << std::endl;
+            }
+        }
+        if (resp->queues_size() != 0) {
+            std::cout << yellow_bold << "queues (" << resp->total_queues() << "):" << reset << std::endl;
+            for (const auto& q : resp->queues()) {
+                std::cout << "    " << q.name() << "  depth: " << q.depth() << "  unacked: " << q.unacked()
+                          << "  consumers: " << q.consumer_count() << "  published: " << q.published()
+                          << "  delivered: " << q.delivered() << "  acked: " << q.acked()
+                          << "  redelivered: " << q.redelivered() << std::endl;
+            }
+        }
+        if (resp->consumers_size() != 0) {
+            std::cout << yellow_bold << "consumers (" << resp->total_consumers() << "):" << reset << std::endl;
+            for (const auto& c : resp->consumers())
+                std::cout << "    " << c.tag() << "  queue: " << c.queue_name() << "  auto_ack: " << c.auto_ack()
+                          << "  unacked: " << c.unacked() << std::endl;
+        }
+    } // 打印结构化的状态查询结果
     bool run_cmd(const std::vector<std::string>& full_cmd_splited) {
         if (full_cmd_splited[0] == "cmds") {
             for (const auto& e : __valid_cmds) {
@@ -224,6 +255,10 @@ private:
                     return hare_mq::ExchangeType::DIRECT;
                 else if (full_cmd_splited[2] == "TOPIC")
                     return hare_mq::ExchangeType::TOPIC;
+                else if (full_cmd_splited[2] == "CONSISTENT_HASH")
+                    return hare_mq::ExchangeType::CONSISTENT_HASH;
+                else if (full_cmd_splited[2] == "HEADERS")
+                    return hare_mq::ExchangeType::HEADERS;
                 else {
                     usage("declare_exchange");
                     return hare_mq::ExchangeType::UNKNOWTYPE;
@@ -322,6 +357,36 @@ private:
         } else if (full_cmd_splited[0] == "svrstat") {
             __ch->basic_query();
             return true;
+        } else if (full_cmd_splited[0] == "metrics") {
+            hare_mq::metricsResponsePtr resp = __ch->metrics(true);
+            if (!resp->ok()) {
+                std::cerr << red_bold << "metrics failed" << reset << ", please check the server stats" << std::endl;
+                return false;
+            }
+            std::cout << resp->text();
+            return true;
+        } else if (full_cmd_splited[0] == "stats") {
+            static const std::unordered_map<std::string, hare_mq::StatsSection> sections = {
+                { "all", hare_mq::STATS_ALL },
+                { "exchanges", hare_mq::STATS_EXCHANGES },
+                { "queues", hare_mq::STATS_QUEUES },
+                { "consumers", hare_mq::STATS_CONSUMERS }
+            };
+            hare_mq::StatsSection section = hare_mq::STATS_ALL;
+            if (full_cmd_splited.size() > 3 || (full_cmd_splited.size() > 1 && sections.count(full_cmd_splited[1]) == 0)) {
+                usage("stats");
+                return false;
+            }
+            if (full_cmd_splited.size() > 1)
+                section = sections.at(full_cmd_splited[1]);
+            std::string prefix = full_cmd_splited.size() > 2 ? full_cmd_splited[2] : "";
+            hare_mq::statsResponsePtr resp = __ch->stats(section, prefix, 0, 0, true);
+            if (!resp->ok()) {
+                std::cerr << red_bold << "stats failed" << reset << ", please check the server stats" << std::endl;
+                return false;
+            }
+            print_stats(resp);
+            return true;
         } else if (full_cmd_splited[0] == "publish" || full_cmd_splited[0] == "publish_mode") {
             /*
                 hare_mq::BasicProperties bp;
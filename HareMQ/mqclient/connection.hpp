@@ -20,16 +20,36 @@
 #include "muduo/protoc/dispatcher.h"
 
 namespace hare_mq {
+#define HEARTBEAT_INTERVAL 30 // 客户端期望的心跳间隔(秒)，最终使用和服务器协商之后的值
+#define HEARTBEAT_TIMEOUT_FACTOR 2 // 超过 心跳间隔*这个倍数 没有收到任何数据，就认为连接已经断了
+#define HEARTBEAT_TICK 1.0 // 心跳定时器的周期(秒)
 class connection {
 public:
     using ptr = std::shared_ptr<connection>;
     using message_ptr = std::shared_ptr<google::protobuf::Message>;
     using basicCommonResponsePtr = std::shared_ptr<basicCommonResponse>;
     using basicConsumeResponsePtr = std::shared_ptr<basicConsumeResponse>;
-    using basicQueryResponsePtr = std::shared_ptr<basicQueryResponse>; //
+    using basicQueryResponsePtr = std::shared_ptr<basicQueryResponse>;
+    using basicGetResponsePtr = std::shared_ptr<basicGetResponse>;
+    using metricsResponsePtr = std::shared_ptr<metricsResponse>;
+    using statsResponsePtr = std::shared_ptr<statsResponse>;
+    using heartbeatResponsePtr = std::shared_ptr<heartbeatResponse>;
+    using heartbeatPtr = std::shared_ptr<heartbeat>; //
+private:
+    // 心跳状态: 定时器回调只持有这个对象，不依赖 connection 本身，连接对象析构之后回调也是安全的
+    struct heartbeat_state {
+        uint32_t requested = 0; // 客户端期望的心跳间隔
+        std::atomic<uint32_t> interval { 0 }; // 协商之后的心跳间隔，0 表示不使用心跳
+        std::atomic<int64_t> last_recv { 0 }; // 最近一次收到数据的时间(毫秒)
+        std::atomic<int64_t> last_sent { 0 }; // 最近一次发送心跳的时间(毫秒)
+        std::atomic<bool> stopped { false };
+        muduo::net::TcpConnectionPtr conn; // 用 std::atomic_load/atomic_store 访问
+    };
+    std::shared_ptr<heartbeat_state> __heartbeat;
+    muduo::net::TimerId __heartbeat_timer;
 private:
     muduo::CountDownLatch __latch; // 实现同步的
-    muduo::net::TcpConnectionPtr __conn; // 客户端对应的连接
+    muduo::net::TcpConnectionPtr __conn; // 客户端对应的连接，断线时为空，用 std::atomic_load/atomic_store 访问
     muduo::net::TcpClient __client; // 客户端
     ProtobufDispatcher __dispatcher; // 请求分发器
     ProtobufCodecPtr __codec; // 协议处理器
@@ -37,10 +57,9 @@ private:
 private:
     channel_manager::ptr __channel_manager; //
 public:
-    connection(const std::string& sip, int sport, const async_worker::ptr& worker)
-        : __latch(1)
-        , __worker(worker)
-        , __channel_manager(std::make_shared<channel_manager>())
+    connection(const std::string& sip, int sport, const async_worker::ptr& worker, uint32_t heartbeat_interval = HEARTBEAT_INTERVAL)
+        : __heartbeat(std::make_shared<heartbeat_state>())
+        , __latch(1)
         , __client(worker->loop_thread.startLoop(), muduo::net::InetAddress(sip, sport), "Client")
         , __dispatcher(std::bind(&connection::onUnknownMessage, this,
               std::placeholders::_1,
@@ -49,7 +68,10 @@ public:
         , __codec(std::make_shared<ProtobufCodec>(std::bind(&ProtobufDispatcher::onProtobufMessage, &__dispatcher,
               std::placeholders::_1,
               std::placeholders::_2,
-              std::placeholders::_3))) {
+              std::placeholders::_3)))
+        , __worker(worker)
+        , __channel_manager(std::make_shared<channel_manager>()) {
+        __heartbeat->requested = heartbeat_interval;
         __dispatcher.registerMessageCallback<basicCommonResponse>(std::bind(&connection::commonResponse,
             this, std::placeholders::_1,
             std::placeholders::_2,
@@ -62,24 +84,67 @@ public:
             this, std::placeholders::_1,
             std::placeholders::_2,
             std::placeholders::_3));
-        __client.setMessageCallback(std::bind(&ProtobufCodec::onMessage, __codec,
+        __dispatcher.registerMessageCallback<basicGetResponse>(std::bind(&connection::getResponse,
+            this, std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3));
+        __dispatcher.registerMessageCallback<metricsResponse>(std::bind(&connection::metricsResult,
+            this, std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3));
+        __dispatcher.registerMessageCallback<statsResponse>(std::bind(&connection::statsResult,
+            this, std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3));
+        __dispatcher.registerMessageCallback<heartbeatResponse>(std::bind(&connection::heartbeatNegotiated,
+            this, std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3));
+        __dispatcher.registerMessageCallback<heartbeat>(std::bind(&connection::heartbeatReceived,
+            this, std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3));
+        __client.setMessageCallback(std::bind(&connection::onMessage, this,
             std::placeholders::_1,
             std::placeholders::_2,
             std::placeholders::_3));
         __client.setConnectionCallback(std::bind(&connection::onConnection, this, std::placeholders::_1));
+        // 断线之后自动重连(muduo 的 Connector 自带退避: 0.5s 开始翻倍，最长 30s)
+        __client.enableRetry();
         // 连接服务器
         __client.connect();
         __latch.wait();
+        __heartbeat_timer = __client.getLoop()->runEvery(HEARTBEAT_TICK, std::bind(&connection::heartbeatTick, __heartbeat, __codec));
+    }
+    ~connection() {
+        __heartbeat->stopped = true;
+        __client.getLoop()->cancel(__heartbeat_timer);
     }
     channel::ptr openChannel() {
-        channel::ptr ch = __channel_manager->create_channel(__conn, __codec);
+        muduo::net::TcpConnectionPtr conn = std::atomic_load(&__conn);
+        channel::ptr ch = __channel_manager->create_channel(conn, __codec);
         // 给服务器发送信道创建请求
         if (!ch->open_server_channel()) {
             LOG(ERROR) << "open channel failed!" << std::endl;
+            __channel_manager->remove_channel(ch->cid());
             return channel::ptr();
         }
         return ch;
     }
+    void openChannelAsync(const std::function<void(const channel::ptr&)>& cb) {
+        // 异步创建信道: 服务器确认之后在 IO 线程中回调，失败时回调参数为空
+        muduo::net::TcpConnectionPtr conn = std::atomic_load(&__conn);
+        channel::ptr ch = __channel_manager->create_channel(conn, __codec);
+        channel_manager::ptr cmp = __channel_manager;
+        ch->open_server_channel_async([ch, cmp, cb](bool ok) {
+            if (!ok) {
+                LOG(ERROR) << "open channel failed!" << std::endl;
+                cmp->remove_channel(ch->cid());
+            }
+            if (cb)
+                cb(ok ? ch : channel::ptr());
+        });
+    }
     void closeChannel(const channel::ptr& ch) {
         ch->close_server_channel();
         __channel_manager->remove_channel(ch->cid());
@@ -98,10 +163,13 @@ private:
     void consumeResponse(const muduo::net::TcpConnectionPtr& conn, const basicConsumeResponsePtr& message, muduo::Timestamp ts) {
         // 1. 找到信道
         channel::ptr ch = __channel_manager->select_channel(message->cid());
-        // 2. 封装异步任务，抛入到线程池
-        __worker->pool.push([ch, message]() {
-            ch->consume(message);
-        });
+        if (ch == nullptr) {
+            LOG(ERROR) << "cannot find channel info" << std::endl;
+            return;
+        }
+        // 2. 在 IO 线程中先登记投递标签，再交给推送执行器，同一个消费者的消息按顺序处理，不同消费者之间并行
+        ch->track_delivery(message);
+        __worker->executor.push(ch, message);
     }
     void queryRespone(const muduo::net::TcpConnectionPtr& conn, const basicQueryResponsePtr& message, muduo::Timestamp ts) {
         channel::ptr ch = __channel_manager->select_channel(message->cid());
@@ -111,17 +179,89 @@ private:
         }
         ch->push_basic_response(message);
     }
+    void getResponse(const muduo::net::TcpConnectionPtr& conn, const basicGetResponsePtr& message, muduo::Timestamp ts) {
+        channel::ptr ch = __channel_manager->select_channel(message->cid());
+        if (ch == nullptr) {
+            LOG(ERROR) << "cannot find channel info" << std::endl;
+            return;
+        }
+        ch->push_basic_response(message);
+    }
+    void metricsResult(const muduo::net::TcpConnectionPtr& conn, const metricsResponsePtr& message, muduo::Timestamp ts) {
+        channel::ptr ch = __channel_manager->select_channel(message->cid());
+        if (ch == nullptr) {
+            LOG(ERROR) << "cannot find channel info" << std::endl;
+            return;
+        }
+        ch->push_basic_response(message);
+    }
+    void statsResult(const muduo::net::TcpConnectionPtr& conn, const statsResponsePtr& message, muduo::Timestamp ts) {
+        channel::ptr ch = __channel_manager->select_channel(message->cid());
+        if (ch == nullptr) {
+            LOG(ERROR) << "cannot find channel info" << std::endl;
+            return;
+        }
+        ch->push_basic_response(message);
+    }
+    void heartbeatNegotiated(const muduo::net::TcpConnectionPtr& conn, const heartbeatResponsePtr& message, muduo::Timestamp ts) {
+        __heartbeat->interval = message->interval();
+        LOG(INFO) << "heartbeat interval: " << std::to_string(message->interval()) << "s" << std::endl;
+    }
+    void heartbeatReceived(const muduo::net::TcpConnectionPtr& conn, const heartbeatPtr& message, muduo::Timestamp ts) {
+        // 收到数据的时间在 onMessage 中已经记录了，这里什么都不用做
+    }
+    static void heartbeatTick(const std::shared_ptr<heartbeat_state>& hb, const ProtobufCodecPtr& codec) {
+        if (hb->stopped)
+            return;
+        uint32_t interval = hb->interval;
+        muduo::net::TcpConnectionPtr conn = std::atomic_load(&hb->conn);
+        if (interval == 0 || conn == nullptr || conn->connected() == false)
+            return;
+        int64_t now = time_helper::steady_ms();
+        if (now - hb->last_recv > (int64_t)interval * HEARTBEAT_TIMEOUT_FACTOR * 1000) {
+            // 服务器太久没有任何数据了，主动断开，之后会自动重连并恢复信道
+            LOG(WARNING) << "heartbeat timeout, close the connection" << std::endl;
+            conn->forceClose();
+            return;
+        }
+        if (now - hb->last_sent >= (int64_t)interval * 1000) {
+            heartbeat req;
+            req.set_timestamp(now);
+            codec->send(conn, req);
+            hb->last_sent = now;
+        }
+    }
+    void onMessage(const muduo::net::TcpConnectionPtr& conn, muduo::net::Buffer* buf, muduo::Timestamp ts) {
+        __heartbeat->last_recv = time_helper::steady_ms();
+        __codec->onMessage(conn, buf, ts);
+    }
     void onUnknownMessage(const muduo::net::TcpConnectionPtr& conn, const MessagePtr& message, muduo::Timestamp ts) {
         LOG(INFO) << "unknown result: " << message->GetTypeName() << std::endl;
         conn->shutdown();
     }
     void onConnection(const muduo::net::TcpConnectionPtr& conn) {
         if (conn->connected()) {
+            // 先协商心跳
+            __heartbeat->last_recv = time_helper::steady_ms();
+            std::atomic_store(&__heartbeat->conn, conn);
+            heartbeatRequest hreq;
+            hreq.set_rid(uuid_helper::uuid());
+            hreq.set_interval(__heartbeat->requested);
+            __codec->send(conn, hreq);
+            // 重连的时候，已有的信道要在新连接上恢复(第一次连接时还没有信道)
+            for (const auto& ch : __channel_manager->channels())
+                ch->recover(conn);
+            std::atomic_store(&__conn, conn);
             __latch.countDown();
-            __conn = conn;
             LOG(INFO) << "connected" << std::endl;
-        } else
-            LOG(INFO) << "disconnected" << std::endl;
+        } else {
+            std::atomic_store(&__conn, muduo::net::TcpConnectionPtr());
+            std::atomic_store(&__heartbeat->conn, muduo::net::TcpConnectionPtr());
+            __heartbeat->interval = 0;
+            for (const auto& ch : __channel_manager->channels())
+                ch->on_disconnected(); // 正在等待响应的请求全部失败，不会一直阻塞
+            LOG(INFO) << "disconnected, reconnecting..." << std::endl;
+        }
     }
 };
 
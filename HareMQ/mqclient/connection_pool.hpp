@@ -0,0 +1,131 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_CLIENT_CONNECTION_POOL__
+#define __YUFC_CLIENT_CONNECTION_POOL__
+
+#include "../mqcommon/logger.hpp"
+#include "async_worker.hpp"
+#include "connection.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace hare_mq {
+// 客户端连接池: 多条 TCP 连接，每条连接有自己的 IO 线程(EventLoopThread)和推送执行器
+// 信道按轮询分散到各条连接上，单个进程可以把多 reactor 的服务器压满
+class connection_pool {
+public:
+    using ptr = std::shared_ptr<connection_pool>;
+private:
+    std::vector<async_worker::ptr> __workers; // 和连接一一对应
+    std::vector<connection::ptr> __conns;
+    std::atomic<size_t> __next; // 轮询下标
+    std::mutex __mtx;
+    std::unordered_map<std::string, connection::ptr> __channel_conns; // cid -> 信道所在的连接
+public:
+    connection_pool(const std::string& sip, int sport, size_t pool_size, size_t delivery_threads = 1)
+        : __next(0) {
+        if (pool_size == 0)
+            pool_size = 1;
+        for (size_t i = 0; i < pool_size; ++i) {
+            __workers.push_back(std::make_shared<async_worker>(delivery_threads));
+            __conns.push_back(std::make_shared<connection>(sip, sport, __workers.back()));
+        }
+    }
+    ~connection_pool() {
+        __conns.clear(); // 先释放连接，再释放连接所用的 IO 线程
+        __workers.clear();
+    }
+    size_t size() const { return __conns.size(); }
+    connection::ptr select_connection(size_t index) {
+        return __conns[index % __conns.size()];
+    }
+    channel::ptr openChannel() {
+        size_t index = __next.fetch_add(1);
+        return openChannel(index);
+    } // 轮询选择一条连接创建信道
+    channel::ptr openChannel(size_t index) {
+        connection::ptr conn = select_connection(index);
+        channel::ptr ch = conn->openChannel();
+        if (ch == nullptr)
+            return ch;
+        std::unique_lock<std::mutex> lock(__mtx);
+        __channel_conns.insert({ ch->cid(), conn });
+        return ch;
+    } // 在指定的连接上创建信道
+    void closeChannel(const channel::ptr& ch) {
+        connection::ptr conn;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __channel_conns.find(ch->cid());
+            if (it == __channel_conns.end()) {
+                LOG(ERROR) << "the channel: " << ch->cid() << " is not opened by this pool" << std::endl;
+                return;
+            }
+            conn = it->second;
+            __channel_conns.erase(it);
+        }
+        conn->closeChannel(ch);
+    }
+};
+
+// 按 routing_key 分片的发布者: 每条连接上开一个信道，同一个 routing_key 的消息总是走同一个信道，保证顺序
+class sharded_publisher {
+public:
+    using ptr = std::shared_ptr<sharded_publisher>;
+private:
+    connection_pool::ptr __pool;
+    std::string __exchange_name;
+    std::vector<channel::ptr> __channels; // 下标和连接池中的连接一一对应
+public:
+    sharded_publisher(const connection_pool::ptr& pool, const std::string& ename)
+        : __pool(pool)
+        , __exchange_name(ename) {
+        for (size_t i = 0; i < pool->size(); ++i) {
+            channel::ptr ch = pool->openChannel(i);
+            if (ch == nullptr) {
+                LOG(ERROR) << "sharded publisher open channel failed on connection: " << std::to_string(i) << std::endl;
+                continue;
+            }
+            __channels.push_back(ch);
+        }
+    }
+    ~sharded_publisher() {
+        for (const auto& ch : __channels)
+            __pool->closeChannel(ch);
+    }
+    void basic_publish(const BasicProperties* bp, const std::string& body) {
+        channel::ptr ch = select_channel(bp);
+        if (ch == nullptr)
+            return;
+        ch->basic_publish(__exchange_name, bp, body);
+    }
+    void basic_publish_async(const BasicProperties* bp, const std::string& body, const rpc_callback& cb) {
+        channel::ptr ch = select_channel(bp);
+        if (ch == nullptr) {
+            if (cb)
+                cb(false);
+            return;
+        }
+        ch->basic_publish_async(__exchange_name, bp, body, cb);
+    }
+private:
+    channel::ptr select_channel(const BasicProperties* bp) {
+        if (__channels.empty()) {
+            LOG(ERROR) << "sharded publisher has no usable channel" << std::endl;
+            return channel::ptr();
+        }
+        std::string routing_key = bp ? bp->routing_key() : std::string();
+        return __channels[std::hash<std::string>()(routing_key) % __channels.size()];
+    } // 同一个 routing_key 总是选到同一个信道
+};
+} // namespace hare_mq
+
+#endif
@@ -8,7 +8,7 @@
 
 void cb(hare_mq::channel::ptr& ch, const std::string& tag, const hare_mq::BasicProperties* bp, const std::string& body) {
     hare_mq::LOG(INFO) << "[" << tag << "] consumed a mesg: " << body << std::endl;
-    ch->basic_ack(bp->id());
+    ch->basic_ack(bp->id(), tag);
 }
 
 void consume_client(const std::string& qname) {
@@ -0,0 +1,97 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_CLIENT_DELIVERY_EXECUTOR__
+#define __YUFC_CLIENT_DELIVERY_EXECUTOR__
+
+#include "../mqcommon/logger.hpp"
+#include "channel.hpp"
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hare_mq {
+// 客户端推送消息的执行器
+// 1. 每个线程对应一条通道(lane)，同一个消费者(cid + consumer_tag)的消息总是进入同一条通道，保证按推送顺序处理
+// 2. 不同的消费者分散到不同的通道上，可以并行处理
+// 3. 通道里面是两个交替使用的 vector，容量会保留下来，稳定之后每条消息不需要再申请内存
+class delivery_executor {
+private:
+    struct delivery {
+        channel::ptr ch;
+        basicConsumeResponsePtr msg;
+        uint64_t epoch; // 收到消息时信道的断线次数，断线之前的消息不再交给用户
+    };
+    struct lane {
+        std::mutex mtx;
+        std::condition_variable cond;
+        std::vector<delivery> pending; // 等待处理的消息
+        bool stop = false;
+        std::thread thread;
+    };
+    std::vector<std::unique_ptr<lane>> __lanes; //
+public:
+    delivery_executor(size_t concurrency = 1) {
+        if (concurrency == 0)
+            concurrency = 1;
+        for (size_t i = 0; i < concurrency; ++i)
+            __lanes.emplace_back(new lane());
+        for (auto& ln : __lanes)
+            ln->thread = std::thread(&delivery_executor::entry, ln.get());
+    }
+    ~delivery_executor() {
+        stop();
+    }
+    void stop() {
+        for (auto& ln : __lanes) {
+            std::unique_lock<std::mutex> lock(ln->mtx);
+            ln->stop = true;
+            ln->cond.notify_one();
+        }
+        for (auto& ln : __lanes) {
+            if (ln->thread.joinable())
+                ln->thread.join(); // 退出前会把已经收到的消息处理完
+        }
+    }
+    void push(const channel::ptr& ch, const basicConsumeResponsePtr& msg) {
+        lane& ln = *__lanes[lane_index(msg->cid(), msg->consumer_tag())];
+        std::unique_lock<std::mutex> lock(ln.mtx);
+        ln.pending.push_back({ ch, msg, ch->epoch() });
+        if (ln.pending.size() == 1)
+            ln.cond.notify_one(); // 只有从空变成非空的时候线程才可能在等待
+    }
+    size_t concurrency() const { return __lanes.size(); }
+
+private:
+    size_t lane_index(const std::string& cid, const std::string& consumer_tag) const {
+        if (__lanes.size() == 1)
+            return 0;
+        std::hash<std::string> hasher;
+        size_t h = hasher(cid) * 31 + hasher(consumer_tag);
+        return h % __lanes.size();
+    }
+    static void entry(lane* ln) {
+        std::vector<delivery> running;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(ln->mtx);
+                ln->cond.wait(lock, [ln]() { return ln->stop || !ln->pending.empty(); });
+                if (ln->pending.empty())
+                    return; // 收到停止信号，并且消息已经处理完了
+                running.swap(ln->pending); // 交换之后 pending 用的是上一轮清空过的 vector
+            }
+            for (auto& d : running) // 无锁状态下按顺序处理
+                d.ch->consume(d.msg, d.epoch);
+            running.clear();
+        }
+    }
+};
+} // namespace hare_mq
+
+#endif
@@ -0,0 +1,334 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+// 端到端压测(hare-bench): 对本地运行的服务器，多个生产者发布、多个消费者接收，
+// 统计发布/消费的吞吐(msg/s, MB/s)以及从发布到收到消息的延迟分布
+// usage: ./hare_bench [--key=value ...]
+//  --host=127.0.0.1 --port=8085      服务器地址
+//  --producers=1 --consumers=1       生产者/消费者数量，每个都使用独立的连接
+//  --messages=100000                 所有生产者一共发布的消息条数
+//  --size=256                        消息体大小(字节)，至少 8 字节(前 8 字节是发布时间)
+//  --exchange=direct                 交换机类型: direct/fanout/topic，fanout 时每个消费者一个队列，其他类型所有消费者共用一个队列
+//  --durable=0                       交换机、队列、消息是否持久化
+//  --confirm=async --window=256      发布确认方式: none(不等响应)/sync(逐条等待响应)/async(最多 window 条未确认)
+//  --prefetch=0                      0: 推送模式(basic_consume)；N: 拉取模式，每次 basic_get 最多取 N 条
+//  --auto_ack=1                      消费者是否自动确认
+//  --timeout=60                      最多等待消费完成的时间(秒)
+
+#include "../mqcommon/histogram.hpp"
+#include "connection.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define BENCH_EXCHANGE "hare_bench_exchange"
+#define BENCH_QUEUE "hare_bench_queue"
+#define BENCH_ROUTING_KEY "hare.bench"
+
+struct bench_options {
+    std::string host = "127.0.0.1";
+    int port = 8085;
+    size_t producers = 1;
+    size_t consumers = 1;
+    size_t messages = 100000;
+    size_t size = 256;
+    std::string exchange = "direct";
+    bool durable = false;
+    std::string confirm = "async";
+    size_t window = 256;
+    size_t prefetch = 0;
+    bool auto_ack = true;
+    int timeout = 60;
+};
+
+static bool parse_options(int argc, char** argv, bench_options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t pos = arg.find('=');
+        if (arg.compare(0, 2, "--") != 0 || pos == std::string::npos) {
+            hare_mq::LOG(ERROR) << "invalid argument: " << arg << std::endl;
+            return false;
+        }
+        std::string key = arg.substr(2, pos - 2);
+        std::string value = arg.substr(pos + 1);
+        if (key == "host")
+            opt.host = value;
+        else if (key == "port")
+            opt.port = std::stoi(value);
+        else if (key == "producers")
+            opt.producers = std::stoul(value);
+        else if (key == "consumers")
+            opt.consumers = std::stoul(value);
+        else if (key == "messages")
+            opt.messages = std::stoul(value);
+        else if (key == "size")
+            opt.size = std::stoul(value);
+        else if (key == "exchange")
+            opt.exchange = value;
+        else if (key == "durable")
+            opt.durable = value == "1" || value == "true";
+        else if (key == "confirm")
+            opt.confirm = value;
+        else if (key == "window")
+            opt.window = std::stoul(value);
+        else if (key == "prefetch")
+            opt.prefetch = std::stoul(value);
+        else if (key == "auto_ack")
+            opt.auto_ack = value == "1" || value == "true";
+        else if (key == "timeout")
+            opt.timeout = std::stoi(value);
+        else {
+            hare_mq::LOG(ERROR) << "unknown option: " << key << std::endl;
+            return false;
+        }
+    }
+    if (opt.exchange != "direct" && opt.exchange != "fanout" && opt.exchange != "topic") {
+        hare_mq::LOG(ERROR) << "unsupported exchange type: " << opt.exchange << std::endl;
+        return false;
+    }
+    if (opt.confirm != "none" && opt.confirm != "sync" && opt.confirm != "async") {
+        hare_mq::LOG(ERROR) << "unsupported confirm mode: " << opt.confirm << std::endl;
+        return false;
+    }
+    if (opt.producers == 0 || opt.consumers == 0 || opt.window == 0) {
+        hare_mq::LOG(ERROR) << "producers, consumers and window must be positive" << std::endl;
+        return false;
+    }
+    if (opt.size < sizeof(int64_t))
+        opt.size = sizeof(int64_t);
+    return true;
+}
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 一个客户端: 独立的 IO 线程 + 连接 + 信道
+struct bench_client {
+    hare_mq::async_worker::ptr worker;
+    hare_mq::connection::ptr conn;
+    hare_mq::channel::ptr ch;
+    bench_client(const bench_options& opt)
+        : worker(std::make_shared<hare_mq::async_worker>())
+        , conn(std::make_shared<hare_mq::connection>(opt.host, opt.port, worker))
+        , ch(conn->openChannel()) { }
+    ~bench_client() {
+        if (ch)
+            conn->closeChannel(ch);
+        conn.reset(); // 连接要在 IO 线程之前析构
+    }
+};
+
+// 所有消费者共享的接收统计
+struct bench_receiver {
+    hare_mq::histogram latency; // 单位: 微秒
+    std::atomic<size_t> received { 0 };
+    std::atomic<int64_t> last_ns { 0 };
+    size_t expected = 0;
+    std::mutex mtx;
+    std::condition_variable cond;
+    void on_message(const std::string& body) {
+        int64_t now = now_ns();
+        int64_t sent = 0;
+        memcpy(&sent, body.data(), sizeof(sent));
+        latency.record(now > sent ? (now - sent) / 1000 : 0);
+        last_ns.store(now, std::memory_order_relaxed);
+        if (++received == expected) {
+            std::unique_lock<std::mutex> lock(mtx);
+            cond.notify_all();
+        }
+    }
+    bool done() const { return received >= expected; }
+};
+
+// 异步确认模式下限制未确认的发布数量
+struct publish_window {
+    std::mutex mtx;
+    std::condition_variable cond;
+    size_t inflight = 0;
+    size_t failed = 0;
+    void acquire(size_t limit) {
+        std::unique_lock<std::mutex> lock(mtx);
+        cond.wait(lock, [this, limit]() { return inflight < limit; });
+        ++inflight;
+    }
+    void release(bool ok) {
+        std::unique_lock<std::mutex> lock(mtx);
+        --inflight;
+        if (!ok)
+            ++failed;
+        cond.notify_all();
+    }
+    void drain() {
+        std::unique_lock<std::mutex> lock(mtx);
+        cond.wait(lock, [this]() { return inflight == 0; });
+    }
+};
+
+static void produce(const bench_options& opt, size_t index, size_t count, std::atomic<size_t>& failed) {
+    bench_client client(opt);
+    if (client.ch == nullptr) {
+        failed += count;
+        return;
+    }
+    hare_mq::BasicProperties bp;
+    bp.set_delivery_mode(opt.durable ? hare_mq::DeliveryMode::DURABLE : hare_mq::DeliveryMode::UNDURABLE);
+    bp.set_routing_key(BENCH_ROUTING_KEY);
+    std::string prefix = hare_mq::uuid_helper::uuid() + "-" + std::to_string(index) + "-";
+    std::string body(opt.size, 'x');
+    publish_window window;
+    for (size_t i = 0; i < count; ++i) {
+        bp.set_id(prefix + std::to_string(i));
+        int64_t stamp = now_ns();
+        memcpy(&body[0], &stamp, sizeof(stamp));
+        if (opt.confirm == "sync") {
+            client.ch->basic_publish(BENCH_EXCHANGE, &bp, body);
+        } else if (opt.confirm == "async") {
+            window.acquire(opt.window);
+            client.ch->basic_publish_async(BENCH_EXCHANGE, &bp, body, [&window](bool ok) { window.release(ok); });
+        } else {
+            client.ch->basic_publish_async(BENCH_EXCHANGE, &bp, body, hare_mq::rpc_callback());
+        }
+    }
+    window.drain();
+    failed += window.failed;
+}
+
+static void consume_pull(const bench_options& opt, const std::string& qname, hare_mq::channel::ptr ch, bench_receiver& receiver, int64_t deadline) {
+    hare_mq::channel* rawch = ch.get();
+    bool auto_ack = opt.auto_ack;
+    auto cb = [rawch, auto_ack, &receiver](const std::string& tag, const hare_mq::BasicProperties* bp, const std::string& body) {
+        receiver.on_message(body);
+        if (!auto_ack)
+            rawch->basic_ack(bp->id(), tag);
+    };
+    while (!receiver.done() && now_ns() < deadline) {
+        if (ch->basic_get(qname, opt.prefetch, 0, opt.auto_ack, cb) == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    ch->flush_acks();
+}
+
+static void report(const char* name, size_t count, size_t bytes, double seconds) {
+    double rate = seconds > 0 ? count / seconds : 0;
+    double mbps = seconds > 0 ? bytes / seconds / (1024 * 1024) : 0;
+    hare_mq::LOG(INFO) << name << ": " << std::to_string(count) << " msgs in " << std::to_string(seconds) << "s"
+                       << ", " << std::to_string((size_t)rate) << " msg/s"
+                       << ", " << std::to_string(mbps) << " MB/s" << std::endl;
+}
+
+void hare_bench(const bench_options& opt) {
+    // 1. 声明交换机和队列
+    bench_client admin(opt);
+    if (admin.ch == nullptr)
+        return;
+    auto empty_map = std::unordered_map<std::string, std::string>();
+    hare_mq::ExchangeType type = opt.exchange == "fanout" ? hare_mq::ExchangeType::FANOUT
+        : opt.exchange == "topic"                         ? hare_mq::ExchangeType::TOPIC
+                                                          : hare_mq::ExchangeType::DIRECT;
+    std::string binding_key = opt.exchange == "topic" ? "hare.#" : BENCH_ROUTING_KEY;
+    admin.ch->declare_exchange(BENCH_EXCHANGE, type, opt.durable, false, empty_map);
+    std::vector<std::string> queues; // 第 i 个消费者使用 queues[i % queues.size()]
+    if (opt.exchange == "fanout") {
+        for (size_t i = 0; i < opt.consumers; ++i)
+            queues.push_back(BENCH_QUEUE + std::string("_") + std::to_string(i));
+    } else {
+        queues.push_back(BENCH_QUEUE);
+    }
+    for (const auto& qname : queues) {
+        admin.ch->declare_queue(qname, opt.durable, false, false, empty_map);
+        admin.ch->bind(BENCH_EXCHANGE, qname, binding_key);
+    }
+    size_t per_producer = opt.messages / opt.producers;
+    size_t published = per_producer * opt.producers;
+    bench_receiver receiver;
+    receiver.expected = opt.exchange == "fanout" ? published * opt.consumers : published;
+    // 2. 先启动消费者
+    int64_t start = now_ns();
+    int64_t deadline = start + (int64_t)opt.timeout * 1000000000;
+    std::vector<std::unique_ptr<bench_client>> consumers;
+    std::vector<std::thread> pullers;
+    for (size_t i = 0; i < opt.consumers; ++i) {
+        consumers.emplace_back(new bench_client(opt));
+        if (consumers.back()->ch == nullptr)
+            return;
+    }
+    for (size_t i = 0; i < opt.consumers; ++i) {
+        hare_mq::channel::ptr ch = consumers[i]->ch;
+        const std::string& qname = queues[i % queues.size()];
+        if (opt.prefetch != 0) {
+            pullers.emplace_back(consume_pull, std::cref(opt), qname, ch, std::ref(receiver), deadline);
+            continue;
+        }
+        hare_mq::channel* rawch = ch.get();
+        bool auto_ack = opt.auto_ack;
+        ch->basic_consume("hare_bench_consumer_" + std::to_string(i), qname, opt.auto_ack,
+            [rawch, auto_ack, &receiver](const std::string& tag, const hare_mq::BasicProperties* bp, const std::string& body) {
+                receiver.on_message(body);
+                if (!auto_ack)
+                    rawch->basic_ack(bp->id(), tag);
+            });
+    }
+    // 3. 生产者各自在独立的线程和连接上发布
+    start = now_ns();
+    std::atomic<size_t> failed(0);
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < opt.producers; ++i)
+        producers.emplace_back(produce, std::cref(opt), i, per_producer, std::ref(failed));
+    for (auto& t : producers)
+        t.join();
+    double publish_seconds = (now_ns() - start) / 1e9;
+    // 4. 等待消费完成或者超时
+    {
+        std::unique_lock<std::mutex> lock(receiver.mtx);
+        receiver.cond.wait_until(lock, std::chrono::steady_clock::now() + std::chrono::nanoseconds(deadline - now_ns()),
+            [&receiver]() { return receiver.done(); });
+    }
+    for (auto& t : pullers)
+        t.join();
+    size_t received = receiver.received;
+    double consume_seconds = received == 0 ? 0 : (receiver.last_ns - start) / 1e9;
+    // 5. 输出结果
+    hare_mq::LOG(INFO) << "exchange: " << opt.exchange << ", producers: " << std::to_string(opt.producers)
+                       << ", consumers: " << std::to_string(opt.consumers) << ", size: " << std::to_string(opt.size)
+                       << ", durable: " << std::to_string(opt.durable) << ", confirm: " << opt.confirm
+                       << ", prefetch: " << std::to_string(opt.prefetch) << ", auto_ack: " << std::to_string(opt.auto_ack) << std::endl;
+    report("publish", published, published * opt.size, publish_seconds);
+    report("consume", received, received * opt.size, consume_seconds);
+    if (failed != 0)
+        hare_mq::LOG(WARNING) << "publish failed: " << std::to_string(failed) << std::endl;
+    if (received < receiver.expected)
+        hare_mq::LOG(WARNING) << "timeout, received " << std::to_string(received)
+                              << " of " << std::to_string(receiver.expected) << std::endl;
+    const hare_mq::histogram& h = receiver.latency;
+    hare_mq::LOG(INFO) << "latency(us) mean: " << std::to_string(h.mean())
+                       << ", p50: " << std::to_string(h.percentile(0.50))
+                       << ", p90: " << std::to_string(h.percentile(0.90))
+                       << ", p99: " << std::to_string(h.percentile(0.99))
+                       << ", p99.9: " << std::to_string(h.percentile(0.999))
+                       << ", max: " << std::to_string(h.max()) << std::endl;
+    // 6. 清理
+    for (auto& c : consumers) {
+        c->ch->basic_cancel();
+        c->ch->flush_acks();
+    }
+    consumers.clear();
+    for (const auto& qname : queues)
+        admin.ch->delete_queue(qname);
+    admin.ch->delete_exchange(BENCH_EXCHANGE);
+}
+
+int main(int argc, char** argv) {
+    bench_options opt;
+    if (!parse_options(argc, argv, opt))
+        return 1;
+    hare_bench(opt);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_CLIENT_RESPONSE_SLOTS__
+#define __YUFC_CLIENT_RESPONSE_SLOTS__
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hare_mq {
+// 按请求id匹配响应: 每个请求一个槽位，响应到达时只唤醒等待这个请求的线程
+// 1. 同步等待(wait): 响应和等待谁先到都可以，先到的一方创建槽位，后到的一方把槽位取走
+// 2. 异步回调(expect): 必须在发送请求之前登记，响应到达时在连接的 IO 线程中执行回调
+// 3. 连接断开(close): 所有还在等待的请求都以失败结束，重连恢复之前新的等待也直接失败
+template <typename T>
+class response_slots {
+public:
+    using callback = std::function<void(const T&)>;
+    using failure_maker = std::function<T(const std::string&)>; // 根据 rid 构造一个失败的响应
+private:
+    struct slot {
+        std::promise<T> promise;
+        callback cb; // 不为空表示异步请求
+        bool fulfilled = false; // 响应已经先到了，等待 wait 来取
+    };
+    using slot_ptr = std::shared_ptr<slot>;
+    std::mutex __mtx;
+    std::unordered_map<std::string, slot_ptr> __slots; // rid -> slot
+    failure_maker __make_failure;
+    bool __closed = false; //
+public:
+    response_slots(const failure_maker& make_failure)
+        : __make_failure(make_failure) { }
+    void push(const std::string& rid, const T& resp) {
+        slot_ptr s;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __slots.find(rid);
+            if (it == __slots.end()) {
+                s = std::make_shared<slot>();
+                s->fulfilled = true;
+                __slots.insert({ rid, s });
+            } else {
+                s = it->second;
+                __slots.erase(it);
+            }
+        }
+        if (s->cb)
+            s->cb(resp);
+        else
+            s->promise.set_value(resp); // set_value 在锁外面，只唤醒这一个等待者
+    } // 连接收到响应
+    T wait(const std::string& rid) {
+        slot_ptr s;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __slots.find(rid);
+            if (it != __slots.end()) {
+                s = it->second;
+                __slots.erase(it);
+            } else if (__closed) {
+                return __make_failure(rid);
+            } else {
+                s = std::make_shared<slot>();
+                __slots.insert({ rid, s });
+            }
+        }
+        return s->promise.get_future().get();
+    } // 等待指定请求的响应
+    void expect(const std::string& rid, const callback& cb) {
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            if (__closed == false) {
+                slot_ptr s = std::make_shared<slot>();
+                s->cb = cb;
+                __slots[rid] = s;
+                return;
+            }
+        }
+        cb(__make_failure(rid));
+    } // 登记异步请求的回调
+    void fail(const std::string& rid) {
+        slot_ptr s;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __slots.find(rid);
+            if (it == __slots.end() || it->second->fulfilled)
+                return;
+            s = it->second;
+            __slots.erase(it);
+        }
+        finish(rid, s);
+    } // 请求没有发出去，让等待这个请求的一方以失败结束
+    T failure(const std::string& rid) {
+        return __make_failure(rid);
+    }
+    void close() {
+        std::vector<std::pair<std::string, slot_ptr>> pending;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            __closed = true;
+            for (auto it = __slots.begin(); it != __slots.end();) {
+                if (it->second->fulfilled) {
+                    ++it; // 响应已经到了的保留下来
+                    continue;
+                }
+                pending.push_back(*it);
+                it = __slots.erase(it);
+            }
+        }
+        for (auto& e : pending)
+            finish(e.first, e.second);
+    } // 连接断开
+    void reopen() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        __closed = false;
+    } // 连接恢复
+    size_t size() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        return __slots.size();
+    } // 还没有配对的槽位数
+private:
+    void finish(const std::string& rid, const slot_ptr& s) {
+        T resp = __make_failure(rid);
+        if (s->cb)
+            s->cb(resp);
+        else
+            s->promise.set_value(resp);
+    }
+};
+} // namespace hare_mq
+
+#endif
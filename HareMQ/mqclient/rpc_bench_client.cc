@@ -0,0 +1,108 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+// 并发请求压测: 多个生产者在同一个信道上同时发请求，测试响应匹配的吞吐和延迟
+// usage: ./rpc_bench_client [producers] [requests_per_producer] [sync|async]
+//  sync:  每个生产者一个线程，调用同步接口
+//  async: 不额外创建线程，每个生产者是一串异步回调，上一个请求的响应到达后再发下一个
+
+#include "connection.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+struct async_producer {
+    hare_mq::channel::ptr ch;
+    std::vector<double>* latencies;
+    int remaining;
+    std::function<void()> on_done;
+    void next() {
+        if (remaining-- == 0)
+            return on_done();
+        auto t0 = std::chrono::steady_clock::now();
+        auto empty_map = std::unordered_map<std::string, std::string>();
+        ch->declare_exchange_async("rpc_bench_exchange", hare_mq::ExchangeType::DIRECT, false, true, empty_map, [this, t0](bool) {
+            auto t1 = std::chrono::steady_clock::now();
+            latencies->push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+            next(); // 在 IO 线程中直接发下一个请求
+        });
+    }
+};
+
+void rpc_bench_client(int thread_count, int requests, bool async_mode) {
+    // 1. 实例化异步工作线程
+    hare_mq::async_worker::ptr awp = std::make_shared<hare_mq::async_worker>();
+    // 2. 实例化连接对象
+    hare_mq::connection::ptr conn = std::make_shared<hare_mq::connection>("127.0.0.1", 8085, awp);
+    // 3. 通过连接创建信道，所有线程共用这一个信道
+    hare_mq::channel::ptr ch = conn->openChannel();
+    auto empty_map = std::unordered_map<std::string, std::string>();
+    ch->declare_exchange("rpc_bench_exchange", hare_mq::ExchangeType::DIRECT, false, true, empty_map);
+    // 4. 每个线程循环声明同一个交换机(已经存在，服务器直接返回)，只测请求-响应的往返
+    std::vector<std::vector<double>> latencies(thread_count); // 单位: 微秒
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    if (async_mode) {
+        std::vector<async_producer> producers(thread_count);
+        std::atomic<int> running(thread_count);
+        std::promise<void> all_done;
+        for (int i = 0; i < thread_count; ++i) {
+            latencies[i].reserve(requests);
+            producers[i] = { ch, &latencies[i], requests, [&running, &all_done]() {
+                                if (--running == 0)
+                                    all_done.set_value();
+                            } };
+        }
+        for (auto& p : producers)
+            p.next();
+        all_done.get_future().wait();
+    }
+    for (int i = 0; !async_mode && i < thread_count; ++i) {
+        threads.emplace_back([&, i]() {
+            latencies[i].reserve(requests);
+            for (int j = 0; j < requests; ++j) {
+                auto t0 = std::chrono::steady_clock::now();
+                ch->declare_exchange("rpc_bench_exchange", hare_mq::ExchangeType::DIRECT, false, true, empty_map);
+                auto t1 = std::chrono::steady_clock::now();
+                latencies[i].push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // 5. 统计结果
+    std::vector<double> all;
+    for (auto& v : latencies)
+        all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double p) -> double {
+        if (all.empty())
+            return 0;
+        return all[std::min(all.size() - 1, (size_t)(p * all.size()))];
+    };
+    hare_mq::LOG(INFO) << (async_mode ? "async" : "sync") << " producers: " << std::to_string(thread_count)
+                       << ", requests: " << std::to_string(all.size())
+                       << ", time: " << std::to_string(seconds) << "s"
+                       << ", rps: " << std::to_string(all.size() / seconds) << std::endl;
+    hare_mq::LOG(INFO) << "latency(us) p50: " << std::to_string(percentile(0.50))
+                       << ", p99: " << std::to_string(percentile(0.99))
+                       << ", max: " << std::to_string(percentile(1.0)) << std::endl;
+    // 6. 关闭信道
+    ch->delete_exchange("rpc_bench_exchange");
+    conn->closeChannel(ch);
+}
+
+int main(int argc, char** argv) {
+    int thread_count = argc > 1 ? std::stoi(argv[1]) : 64;
+    int requests = argc > 2 ? std::stoi(argv[2]) : 1000;
+    bool async_mode = argc > 3 && std::string(argv[3]) == "async";
+    rpc_bench_client(thread_count, requests, async_mode);
+    return 0;
+}
@@ -10,6 +10,7 @@
 #include "./logger.hpp"
 #include <atomic>
 #include <boost/algorithm/string.hpp>
+#include <chrono>
 #include <errno.h>
 #include <fstream>
 #include <google/protobuf/map.h>
@@ -107,6 +108,15 @@ public:
     }
 };
 
+class time_helper {
+public:
+    static int64_t steady_ms() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    } // 单调时钟(毫秒)，用来计算空闲时间，不受系统时间调整影响
+};
+
 class file_helper {
 private:
     std::string __file_name;
@@ -0,0 +1,113 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_HISTOGRAM__
+#define __YUFC_HISTOGRAM__
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace hare_mq {
+// 对数-线性分桶的直方图(和 HdrHistogram 的分桶方式相同)
+// 1. 小于 2^HISTOGRAM_SUB_BITS 的值每个值一个桶，之后每个 2 的幂区间再平分成 2^(HISTOGRAM_SUB_BITS-1) 个子桶，相对误差不超过 1/64
+// 2. 桶是原子计数，任意线程都可以无锁记录，读取时汇总
+#define HISTOGRAM_SUB_BITS 7
+class histogram {
+public:
+    using ptr = std::shared_ptr<histogram>;
+    static const size_t BUCKETS = ((64 - HISTOGRAM_SUB_BITS + 1) << (HISTOGRAM_SUB_BITS - 1)) + (1 << (HISTOGRAM_SUB_BITS - 1));
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> __buckets;
+    std::atomic<uint64_t> __count;
+    std::atomic<uint64_t> __sum;
+    std::atomic<uint64_t> __max;
+public:
+    histogram()
+        : __buckets(new std::atomic<uint64_t>[BUCKETS])
+        , __count(0)
+        , __sum(0)
+        , __max(0) {
+        reset();
+    }
+    void record(uint64_t v) {
+        __buckets[index_of(v)].fetch_add(1, std::memory_order_relaxed);
+        __count.fetch_add(1, std::memory_order_relaxed);
+        __sum.fetch_add(v, std::memory_order_relaxed);
+        uint64_t cur = __max.load(std::memory_order_relaxed);
+        while (v > cur && !__max.compare_exchange_weak(cur, v, std::memory_order_relaxed)) { }
+    }
+    void merge(const histogram& other) {
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            uint64_t n = other.__buckets[i].load(std::memory_order_relaxed);
+            if (n != 0)
+                __buckets[i].fetch_add(n, std::memory_order_relaxed);
+        }
+        __count.fetch_add(other.count(), std::memory_order_relaxed);
+        __sum.fetch_add(other.sum(), std::memory_order_relaxed);
+        uint64_t v = other.max();
+        uint64_t cur = __max.load(std::memory_order_relaxed);
+        while (v > cur && !__max.compare_exchange_weak(cur, v, std::memory_order_relaxed)) { }
+    }
+    void reset() {
+        for (size_t i = 0; i < BUCKETS; ++i)
+            __buckets[i].store(0, std::memory_order_relaxed);
+        __count = 0;
+        __sum = 0;
+        __max = 0;
+    }
+    uint64_t count() const { return __count.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return __sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return __max.load(std::memory_order_relaxed); }
+    double mean() const { return count() == 0 ? 0 : sum() * 1.0 / count(); }
+    uint64_t percentile(double p) const {
+        // 返回第 p 分位(0~1)所在桶的上界，不会超过记录到的最大值
+        uint64_t total = count();
+        if (total == 0)
+            return 0;
+        uint64_t rank = (uint64_t)(p * total);
+        if (rank >= total)
+            rank = total - 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            seen += __buckets[i].load(std::memory_order_relaxed);
+            if (seen > rank) {
+                uint64_t upper = upper_of(i);
+                return upper < max() ? upper : max();
+            }
+        }
+        return max();
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> buckets() const {
+        std::vector<std::pair<uint64_t, uint64_t>> result;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            uint64_t n = __buckets[i].load(std::memory_order_relaxed);
+            if (n != 0)
+                result.push_back({ upper_of(i), n });
+        }
+        return result;
+    } // 非空桶: (桶的上界, 数量)，按上界递增
+
+private:
+    static size_t index_of(uint64_t v) {
+        if (v < (1ULL << HISTOGRAM_SUB_BITS))
+            return v;
+        int msb = 63 - __builtin_clzll(v);
+        int shift = msb - HISTOGRAM_SUB_BITS + 1;
+        return ((size_t)shift << (HISTOGRAM_SUB_BITS - 1)) + (v >> shift);
+    }
+    static uint64_t upper_of(size_t index) {
+        if (index < (1ULL << HISTOGRAM_SUB_BITS))
+            return index;
+        int shift = (int)(index >> (HISTOGRAM_SUB_BITS - 1)) - 1;
+        uint64_t m = index - ((uint64_t)shift << (HISTOGRAM_SUB_BITS - 1));
+        return ((m + 1) << shift) - 1;
+    }
+};
+} // namespace hare_mq
+
+#endif
@@ -21,12 +21,25 @@ namespace _pb = ::PROTOBUF_NAMESPACE_ID;
 namespace _pbi = _pb::internal;
 
 namespace hare_mq {
+PROTOBUF_CONSTEXPR BasicProperties_HeadersEntry_DoNotUse::BasicProperties_HeadersEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    BasicProperties_HeadersEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal _BasicProperties_HeadersEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR BasicProperties::BasicProperties(
-    ::_pbi::ConstantInitialized)
-  : id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , routing_key_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , delivery_mode_(0)
-{}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.headers_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.routing_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delivery_mode_)*/0
+  , /*decltype(_impl_.priority_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct BasicPropertiesDefaultTypeInternal {
   PROTOBUF_CONSTEXPR BasicPropertiesDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -37,10 +50,11 @@ struct BasicPropertiesDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BasicPropertiesDefaultTypeInternal _BasicProperties_default_instance_;
 PROTOBUF_CONSTEXPR Message_Payload::Message_Payload(
-    ::_pbi::ConstantInitialized)
-  : body_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , valid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , properties_(nullptr){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.valid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct Message_PayloadDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Message_PayloadDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -51,10 +65,12 @@ struct Message_PayloadDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_PayloadDefaultTypeInternal _Message_Payload_default_instance_;
 PROTOBUF_CONSTEXPR Message::Message(
-    ::_pbi::ConstantInitialized)
-  : payload_(nullptr)
-  , offset_(0u)
-  , length_(0u){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.payload_)*/nullptr
+  , /*decltype(_impl_.offset_)*/0u
+  , /*decltype(_impl_.length_)*/0u
+  , /*decltype(_impl_.trace_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct MessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -65,69 +81,89 @@ struct MessageDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageDefaultTypeInternal _Message_default_instance_;
 }  // namespace hare_mq
-static ::_pb::Metadata file_level_metadata_msg_2eproto[3];
+static ::_pb::Metadata file_level_metadata_msg_2eproto[4];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_msg_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_msg_2eproto = nullptr;
 
 const uint32_t TableStruct_msg_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties_HeadersEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties_HeadersEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties_HeadersEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties_HeadersEntry_DoNotUse, value_),
+  0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, id_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, delivery_mode_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, routing_key_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, _impl_.delivery_mode_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, _impl_.routing_key_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, _impl_.headers_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::BasicProperties, _impl_.priority_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, properties_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, body_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, valid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, _impl_.properties_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message_Payload, _impl_.valid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::Message, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, payload_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, offset_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, length_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, _impl_.length_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::Message, _impl_.trace_id_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::hare_mq::BasicProperties)},
-  { 9, -1, -1, sizeof(::hare_mq::Message_Payload)},
-  { 18, -1, -1, sizeof(::hare_mq::Message)},
+  { 0, 8, -1, sizeof(::hare_mq::BasicProperties_HeadersEntry_DoNotUse)},
+  { 10, -1, -1, sizeof(::hare_mq::BasicProperties)},
+  { 21, -1, -1, sizeof(::hare_mq::Message_Payload)},
+  { 30, -1, -1, sizeof(::hare_mq::Message)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
+  &::hare_mq::_BasicProperties_HeadersEntry_DoNotUse_default_instance_._instance,
   &::hare_mq::_BasicProperties_default_instance_._instance,
   &::hare_mq::_Message_Payload_default_instance_._instance,
   &::hare_mq::_Message_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_msg_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\tmsg.proto\022\007hare_mq\"`\n\017BasicProperties\022"
-  "\n\n\002id\030\001 \001(\t\022,\n\rdelivery_mode\030\002 \001(\0162\025.har"
-  "e_mq.DeliveryMode\022\023\n\013routing_key\030\003 \001(\t\"\252"
-  "\001\n\007Message\022)\n\007payload\030\001 \001(\0132\030.hare_mq.Me"
-  "ssage.Payload\022\016\n\006offset\030\002 \001(\r\022\016\n\006length\030"
-  "\003 \001(\r\032T\n\007Payload\022,\n\nproperties\030\001 \001(\0132\030.h"
-  "are_mq.BasicProperties\022\014\n\004body\030\002 \001(\t\022\r\n\005"
-  "valid\030\003 \001(\t*A\n\014ExchangeType\022\016\n\nUNKNOWTYP"
-  "E\020\000\022\n\n\006DIRECT\020\001\022\n\n\006FANOUT\020\002\022\t\n\005TOPIC\020\003*:"
-  "\n\014DeliveryMode\022\016\n\nUNKNOWMODE\020\000\022\r\n\tUNDURA"
-  "BLE\020\001\022\013\n\007DURABLE\020\002b\006proto3"
+  "\n\tmsg.proto\022\007hare_mq\"\332\001\n\017BasicProperties"
+  "\022\n\n\002id\030\001 \001(\t\022,\n\rdelivery_mode\030\002 \001(\0162\025.ha"
+  "re_mq.DeliveryMode\022\023\n\013routing_key\030\003 \001(\t\022"
+  "6\n\007headers\030\004 \003(\0132%.hare_mq.BasicProperti"
+  "es.HeadersEntry\022\020\n\010priority\030\005 \001(\r\032.\n\014Hea"
+  "dersEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028"
+  "\001\"\274\001\n\007Message\022)\n\007payload\030\001 \001(\0132\030.hare_mq"
+  ".Message.Payload\022\016\n\006offset\030\002 \001(\r\022\016\n\006leng"
+  "th\030\003 \001(\r\022\020\n\010trace_id\030\004 \001(\004\032T\n\007Payload\022,\n"
+  "\nproperties\030\001 \001(\0132\030.hare_mq.BasicPropert"
+  "ies\022\014\n\004body\030\002 \001(\t\022\r\n\005valid\030\003 \001(\t*c\n\014Exch"
+  "angeType\022\016\n\nUNKNOWTYPE\020\000\022\n\n\006DIRECT\020\001\022\n\n\006"
+  "FANOUT\020\002\022\t\n\005TOPIC\020\003\022\023\n\017CONSISTENT_HASH\020\004"
+  "\022\013\n\007HEADERS\020\005*:\n\014DeliveryMode\022\016\n\nUNKNOWM"
+  "ODE\020\000\022\r\n\tUNDURABLE\020\001\022\013\n\007DURABLE\020\002b\006proto"
+  "3"
   ;
 static ::_pbi::once_flag descriptor_table_msg_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_msg_2eproto = {
-    false, false, 426, descriptor_table_protodef_msg_2eproto,
+    false, false, 601, descriptor_table_protodef_msg_2eproto,
     "msg.proto",
-    &descriptor_table_msg_2eproto_once, nullptr, 0, 3,
+    &descriptor_table_msg_2eproto_once, nullptr, 0, 4,
     schemas, file_default_instances, TableStruct_msg_2eproto::offsets,
     file_level_metadata_msg_2eproto, file_level_enum_descriptors_msg_2eproto,
     file_level_service_descriptors_msg_2eproto,
@@ -149,6 +185,8 @@ bool ExchangeType_IsValid(int value) {
     case 1:
     case 2:
     case 3:
+    case 4:
+    case 5:
       return true;
     default:
       return false;
@@ -171,6 +209,20 @@ bool DeliveryMode_IsValid(int value) {
 }
 
 
+// ===================================================================
+
+BasicProperties_HeadersEntry_DoNotUse::BasicProperties_HeadersEntry_DoNotUse() {}
+BasicProperties_HeadersEntry_DoNotUse::BasicProperties_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void BasicProperties_HeadersEntry_DoNotUse::MergeFrom(const BasicProperties_HeadersEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata BasicProperties_HeadersEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
+      file_level_metadata_msg_2eproto[0]);
+}
+
 // ===================================================================
 
 class BasicProperties::_Internal {
@@ -180,48 +232,74 @@ class BasicProperties::_Internal {
 BasicProperties::BasicProperties(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &BasicProperties::ArenaDtor);
+  }
   // @@protoc_insertion_point(arena_constructor:hare_mq.BasicProperties)
 }
 BasicProperties::BasicProperties(const BasicProperties& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BasicProperties* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.headers_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.routing_key_){}
+    , decltype(_impl_.delivery_mode_){}
+    , decltype(_impl_.priority_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  id_.InitDefault();
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    id_.Set("", GetArenaForAllocation());
+    _impl_.id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_id().empty()) {
-    id_.Set(from._internal_id(), 
-      GetArenaForAllocation());
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
   }
-  routing_key_.InitDefault();
+  _impl_.routing_key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    routing_key_.Set("", GetArenaForAllocation());
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_routing_key().empty()) {
-    routing_key_.Set(from._internal_routing_key(), 
-      GetArenaForAllocation());
+    _this->_impl_.routing_key_.Set(from._internal_routing_key(), 
+      _this->GetArenaForAllocation());
   }
-  delivery_mode_ = from.delivery_mode_;
+  ::memcpy(&_impl_.delivery_mode_, &from._impl_.delivery_mode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.priority_) -
+    reinterpret_cast<char*>(&_impl_.delivery_mode_)) + sizeof(_impl_.priority_));
   // @@protoc_insertion_point(copy_constructor:hare_mq.BasicProperties)
 }
 
-inline void BasicProperties::SharedCtor() {
-id_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  id_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-routing_key_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  routing_key_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-delivery_mode_ = 0;
+inline void BasicProperties::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.headers_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.routing_key_){}
+    , decltype(_impl_.delivery_mode_){0}
+    , decltype(_impl_.priority_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.routing_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BasicProperties::~BasicProperties() {
   // @@protoc_insertion_point(destructor:hare_mq.BasicProperties)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
+    ArenaDtor(this);
     return;
   }
   SharedDtor();
@@ -229,12 +307,18 @@ BasicProperties::~BasicProperties() {
 
 inline void BasicProperties::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  id_.Destroy();
-  routing_key_.Destroy();
+  _impl_.headers_.Destruct();
+  _impl_.headers_.~MapField();
+  _impl_.id_.Destroy();
+  _impl_.routing_key_.Destroy();
 }
 
+void BasicProperties::ArenaDtor(void* object) {
+  BasicProperties* _this = reinterpret_cast< BasicProperties* >(object);
+  _this->_impl_.headers_.Destruct();
+}
 void BasicProperties::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void BasicProperties::Clear() {
@@ -243,9 +327,12 @@ void BasicProperties::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  id_.ClearToEmpty();
-  routing_key_.ClearToEmpty();
-  delivery_mode_ = 0;
+  _impl_.headers_.Clear();
+  _impl_.id_.ClearToEmpty();
+  _impl_.routing_key_.ClearToEmpty();
+  ::memset(&_impl_.delivery_mode_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.priority_) -
+      reinterpret_cast<char*>(&_impl_.delivery_mode_)) + sizeof(_impl_.priority_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -284,6 +371,27 @@ const char* BasicProperties::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // map<string, string> headers = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.headers_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 priority = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -340,6 +448,42 @@ uint8_t* BasicProperties::_InternalSerialize(
         3, this->_internal_routing_key(), target);
   }
 
+  // map<string, string> headers = 4;
+  if (!this->_internal_headers().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = BasicProperties_HeadersEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_headers();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "hare_mq.BasicProperties.HeadersEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "hare_mq.BasicProperties.HeadersEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // uint32 priority = 5;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_priority(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -356,6 +500,15 @@ size_t BasicProperties::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // map<string, string> headers = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_headers_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_headers().begin();
+      it != this->_internal_headers().end(); ++it) {
+    total_size += BasicProperties_HeadersEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
   // string id = 1;
   if (!this->_internal_id().empty()) {
     total_size += 1 +
@@ -376,38 +529,43 @@ size_t BasicProperties::ByteSizeLong() const {
       ::_pbi::WireFormatLite::EnumSize(this->_internal_delivery_mode());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 priority = 5;
+  if (this->_internal_priority() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BasicProperties::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     BasicProperties::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BasicProperties::GetClassData() const { return &_class_data_; }
 
-void BasicProperties::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<BasicProperties *>(to)->MergeFrom(
-      static_cast<const BasicProperties &>(from));
-}
 
-
-void BasicProperties::MergeFrom(const BasicProperties& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.BasicProperties)
-  GOOGLE_DCHECK_NE(&from, this);
+void BasicProperties::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BasicProperties*>(&to_msg);
+  auto& from = static_cast<const BasicProperties&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.BasicProperties)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
   if (!from._internal_id().empty()) {
-    _internal_set_id(from._internal_id());
+    _this->_internal_set_id(from._internal_id());
   }
   if (!from._internal_routing_key().empty()) {
-    _internal_set_routing_key(from._internal_routing_key());
+    _this->_internal_set_routing_key(from._internal_routing_key());
   }
   if (from._internal_delivery_mode() != 0) {
-    _internal_set_delivery_mode(from._internal_delivery_mode());
+    _this->_internal_set_delivery_mode(from._internal_delivery_mode());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BasicProperties::CopyFrom(const BasicProperties& from) {
@@ -426,21 +584,27 @@ void BasicProperties::InternalSwap(BasicProperties* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.headers_.InternalSwap(&other->_impl_.headers_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &id_, lhs_arena,
-      &other->id_, rhs_arena
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &routing_key_, lhs_arena,
-      &other->routing_key_, rhs_arena
+      &_impl_.routing_key_, lhs_arena,
+      &other->_impl_.routing_key_, rhs_arena
   );
-  swap(delivery_mode_, other->delivery_mode_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BasicProperties, _impl_.priority_)
+      + sizeof(BasicProperties::_impl_.priority_)
+      - PROTOBUF_FIELD_OFFSET(BasicProperties, _impl_.delivery_mode_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_mode_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_mode_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BasicProperties::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
-      file_level_metadata_msg_2eproto[0]);
+      file_level_metadata_msg_2eproto[1]);
 }
 
 // ===================================================================
@@ -452,51 +616,64 @@ class Message_Payload::_Internal {
 
 const ::hare_mq::BasicProperties&
 Message_Payload::_Internal::properties(const Message_Payload* msg) {
-  return *msg->properties_;
+  return *msg->_impl_.properties_;
 }
 Message_Payload::Message_Payload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.Message.Payload)
 }
 Message_Payload::Message_Payload(const Message_Payload& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_Payload* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.body_){}
+    , decltype(_impl_.valid_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  body_.InitDefault();
+  _impl_.body_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set("", GetArenaForAllocation());
+    _impl_.body_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_body().empty()) {
-    body_.Set(from._internal_body(), 
-      GetArenaForAllocation());
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
   }
-  valid_.InitDefault();
+  _impl_.valid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    valid_.Set("", GetArenaForAllocation());
+    _impl_.valid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_valid().empty()) {
-    valid_.Set(from._internal_valid(), 
-      GetArenaForAllocation());
+    _this->_impl_.valid_.Set(from._internal_valid(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_properties()) {
-    properties_ = new ::hare_mq::BasicProperties(*from.properties_);
-  } else {
-    properties_ = nullptr;
+    _this->_impl_.properties_ = new ::hare_mq::BasicProperties(*from._impl_.properties_);
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.Message.Payload)
 }
 
-inline void Message_Payload::SharedCtor() {
-body_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-valid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  valid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-properties_ = nullptr;
+inline void Message_Payload::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.body_){}
+    , decltype(_impl_.valid_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.valid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.valid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Message_Payload::~Message_Payload() {
@@ -510,13 +687,13 @@ Message_Payload::~Message_Payload() {
 
 inline void Message_Payload::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  body_.Destroy();
-  valid_.Destroy();
-  if (this != internal_default_instance()) delete properties_;
+  _impl_.body_.Destroy();
+  _impl_.valid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
 }
 
 void Message_Payload::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Message_Payload::Clear() {
@@ -525,12 +702,12 @@ void Message_Payload::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  body_.ClearToEmpty();
-  valid_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
+  _impl_.body_.ClearToEmpty();
+  _impl_.valid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
   }
-  properties_ = nullptr;
+  _impl_.properties_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -658,41 +835,38 @@ size_t Message_Payload::ByteSizeLong() const {
   if (this->_internal_has_properties()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *properties_);
+        *_impl_.properties_);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_Payload::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Message_Payload::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_Payload::GetClassData() const { return &_class_data_; }
 
-void Message_Payload::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Message_Payload *>(to)->MergeFrom(
-      static_cast<const Message_Payload &>(from));
-}
-
 
-void Message_Payload::MergeFrom(const Message_Payload& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.Message.Payload)
-  GOOGLE_DCHECK_NE(&from, this);
+void Message_Payload::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_Payload*>(&to_msg);
+  auto& from = static_cast<const Message_Payload&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.Message.Payload)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
+    _this->_internal_set_body(from._internal_body());
   }
   if (!from._internal_valid().empty()) {
-    _internal_set_valid(from._internal_valid());
+    _this->_internal_set_valid(from._internal_valid());
   }
   if (from._internal_has_properties()) {
-    _internal_mutable_properties()->::hare_mq::BasicProperties::MergeFrom(from._internal_properties());
+    _this->_internal_mutable_properties()->::hare_mq::BasicProperties::MergeFrom(
+        from._internal_properties());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Message_Payload::CopyFrom(const Message_Payload& from) {
@@ -712,20 +886,20 @@ void Message_Payload::InternalSwap(Message_Payload* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &valid_, lhs_arena,
-      &other->valid_, rhs_arena
+      &_impl_.valid_, lhs_arena,
+      &other->_impl_.valid_, rhs_arena
   );
-  swap(properties_, other->properties_);
+  swap(_impl_.properties_, other->_impl_.properties_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Message_Payload::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
-      file_level_metadata_msg_2eproto[1]);
+      file_level_metadata_msg_2eproto[2]);
 }
 
 // ===================================================================
@@ -737,33 +911,45 @@ class Message::_Internal {
 
 const ::hare_mq::Message_Payload&
 Message::_Internal::payload(const Message* msg) {
-  return *msg->payload_;
+  return *msg->_impl_.payload_;
 }
 Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.Message)
 }
 Message::Message(const Message& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){nullptr}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.length_){}
+    , decltype(_impl_.trace_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_payload()) {
-    payload_ = new ::hare_mq::Message_Payload(*from.payload_);
-  } else {
-    payload_ = nullptr;
+    _this->_impl_.payload_ = new ::hare_mq::Message_Payload(*from._impl_.payload_);
   }
-  ::memcpy(&offset_, &from.offset_,
-    static_cast<size_t>(reinterpret_cast<char*>(&length_) -
-    reinterpret_cast<char*>(&offset_)) + sizeof(length_));
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.trace_id_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.trace_id_));
   // @@protoc_insertion_point(copy_constructor:hare_mq.Message)
 }
 
-inline void Message::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&payload_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&length_) -
-    reinterpret_cast<char*>(&payload_)) + sizeof(length_));
+inline void Message::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){nullptr}
+    , decltype(_impl_.offset_){0u}
+    , decltype(_impl_.length_){0u}
+    , decltype(_impl_.trace_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Message::~Message() {
@@ -777,11 +963,11 @@ Message::~Message() {
 
 inline void Message::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete payload_;
+  if (this != internal_default_instance()) delete _impl_.payload_;
 }
 
 void Message::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Message::Clear() {
@@ -790,13 +976,13 @@ void Message::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && payload_ != nullptr) {
-    delete payload_;
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
   }
-  payload_ = nullptr;
-  ::memset(&offset_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&length_) -
-      reinterpret_cast<char*>(&offset_)) + sizeof(length_));
+  _impl_.payload_ = nullptr;
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.trace_id_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.trace_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -817,7 +1003,7 @@ const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
       // uint32 offset = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -825,7 +1011,15 @@ const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
       // uint32 length = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 trace_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.trace_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -878,6 +1072,12 @@ uint8_t* Message::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_length(), target);
   }
 
+  // uint64 trace_id = 4;
+  if (this->_internal_trace_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_trace_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -898,7 +1098,7 @@ size_t Message::ByteSizeLong() const {
   if (this->_internal_has_payload()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *payload_);
+        *_impl_.payload_);
   }
 
   // uint32 offset = 2;
@@ -911,38 +1111,43 @@ size_t Message::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_length());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint64 trace_id = 4;
+  if (this->_internal_trace_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_trace_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Message::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message::GetClassData() const { return &_class_data_; }
 
-void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Message *>(to)->MergeFrom(
-      static_cast<const Message &>(from));
-}
-
 
-void Message::MergeFrom(const Message& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.Message)
-  GOOGLE_DCHECK_NE(&from, this);
+void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message*>(&to_msg);
+  auto& from = static_cast<const Message&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.Message)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_has_payload()) {
-    _internal_mutable_payload()->::hare_mq::Message_Payload::MergeFrom(from._internal_payload());
+    _this->_internal_mutable_payload()->::hare_mq::Message_Payload::MergeFrom(
+        from._internal_payload());
   }
   if (from._internal_offset() != 0) {
-    _internal_set_offset(from._internal_offset());
+    _this->_internal_set_offset(from._internal_offset());
   }
   if (from._internal_length() != 0) {
-    _internal_set_length(from._internal_length());
+    _this->_internal_set_length(from._internal_length());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_trace_id() != 0) {
+    _this->_internal_set_trace_id(from._internal_trace_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Message::CopyFrom(const Message& from) {
@@ -960,22 +1165,26 @@ void Message::InternalSwap(Message* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Message, length_)
-      + sizeof(Message::length_)
-      - PROTOBUF_FIELD_OFFSET(Message, payload_)>(
-          reinterpret_cast<char*>(&payload_),
-          reinterpret_cast<char*>(&other->payload_));
+      PROTOBUF_FIELD_OFFSET(Message, _impl_.trace_id_)
+      + sizeof(Message::_impl_.trace_id_)
+      - PROTOBUF_FIELD_OFFSET(Message, _impl_.payload_)>(
+          reinterpret_cast<char*>(&_impl_.payload_),
+          reinterpret_cast<char*>(&other->_impl_.payload_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_msg_2eproto_getter, &descriptor_table_msg_2eproto_once,
-      file_level_metadata_msg_2eproto[2]);
+      file_level_metadata_msg_2eproto[3]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace hare_mq
 PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::hare_mq::BasicProperties_HeadersEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::hare_mq::BasicProperties_HeadersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::BasicProperties_HeadersEntry_DoNotUse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::hare_mq::BasicProperties*
 Arena::CreateMaybeMessage< ::hare_mq::BasicProperties >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hare_mq::BasicProperties >(arena);
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3020002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -29,6 +29,9 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
@@ -49,6 +52,9 @@ namespace hare_mq {
 class BasicProperties;
 struct BasicPropertiesDefaultTypeInternal;
 extern BasicPropertiesDefaultTypeInternal _BasicProperties_default_instance_;
+class BasicProperties_HeadersEntry_DoNotUse;
+struct BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal;
+extern BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal _BasicProperties_HeadersEntry_DoNotUse_default_instance_;
 class Message;
 struct MessageDefaultTypeInternal;
 extern MessageDefaultTypeInternal _Message_default_instance_;
@@ -58,6 +64,7 @@ extern Message_PayloadDefaultTypeInternal _Message_Payload_default_instance_;
 }  // namespace hare_mq
 PROTOBUF_NAMESPACE_OPEN
 template<> ::hare_mq::BasicProperties* Arena::CreateMaybeMessage<::hare_mq::BasicProperties>(Arena*);
+template<> ::hare_mq::BasicProperties_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::hare_mq::BasicProperties_HeadersEntry_DoNotUse>(Arena*);
 template<> ::hare_mq::Message* Arena::CreateMaybeMessage<::hare_mq::Message>(Arena*);
 template<> ::hare_mq::Message_Payload* Arena::CreateMaybeMessage<::hare_mq::Message_Payload>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -68,12 +75,14 @@ enum ExchangeType : int {
   DIRECT = 1,
   FANOUT = 2,
   TOPIC = 3,
+  CONSISTENT_HASH = 4,
+  HEADERS = 5,
   ExchangeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   ExchangeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ExchangeType_IsValid(int value);
 constexpr ExchangeType ExchangeType_MIN = UNKNOWTYPE;
-constexpr ExchangeType ExchangeType_MAX = TOPIC;
+constexpr ExchangeType ExchangeType_MAX = HEADERS;
 constexpr int ExchangeType_ARRAYSIZE = ExchangeType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExchangeType_descriptor();
@@ -118,6 +127,34 @@ inline bool DeliveryMode_Parse(
 }
 // ===================================================================
 
+class BasicProperties_HeadersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BasicProperties_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BasicProperties_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  BasicProperties_HeadersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR BasicProperties_HeadersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit BasicProperties_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const BasicProperties_HeadersEntry_DoNotUse& other);
+  static const BasicProperties_HeadersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BasicProperties_HeadersEntry_DoNotUse*>(&_BasicProperties_HeadersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "hare_mq.BasicProperties.HeadersEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "hare_mq.BasicProperties.HeadersEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_msg_2eproto;
+};
+
+// -------------------------------------------------------------------
+
 class BasicProperties final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.BasicProperties) */ {
  public:
@@ -166,7 +203,7 @@ class BasicProperties final :
                &_BasicProperties_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(BasicProperties& a, BasicProperties& b) {
     a.Swap(&b);
@@ -198,9 +235,11 @@ class BasicProperties final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BasicProperties& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const BasicProperties& from);
+  void MergeFrom( const BasicProperties& from) {
+    BasicProperties::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -209,10 +248,10 @@ class BasicProperties final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BasicProperties* other);
@@ -225,6 +264,8 @@ class BasicProperties final :
   protected:
   explicit BasicProperties(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -234,13 +275,33 @@ class BasicProperties final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
+    kHeadersFieldNumber = 4,
     kIdFieldNumber = 1,
     kRoutingKeyFieldNumber = 3,
     kDeliveryModeFieldNumber = 2,
+    kPriorityFieldNumber = 5,
   };
+  // map<string, string> headers = 4;
+  int headers_size() const;
+  private:
+  int _internal_headers_size() const;
+  public:
+  void clear_headers();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_headers();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_headers();
+
   // string id = 1;
   void clear_id();
   const std::string& id() const;
@@ -278,6 +339,15 @@ class BasicProperties final :
   void _internal_set_delivery_mode(::hare_mq::DeliveryMode value);
   public:
 
+  // uint32 priority = 5;
+  void clear_priority();
+  uint32_t priority() const;
+  void set_priority(uint32_t value);
+  private:
+  uint32_t _internal_priority() const;
+  void _internal_set_priority(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:hare_mq.BasicProperties)
  private:
   class _Internal;
@@ -285,10 +355,19 @@ class BasicProperties final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr routing_key_;
-  int delivery_mode_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        BasicProperties_HeadersEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr routing_key_;
+    int delivery_mode_;
+    uint32_t priority_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_msg_2eproto;
 };
 // -------------------------------------------------------------------
@@ -341,7 +420,7 @@ class Message_Payload final :
                &_Message_Payload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(Message_Payload& a, Message_Payload& b) {
     a.Swap(&b);
@@ -373,9 +452,11 @@ class Message_Payload final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message_Payload& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Message_Payload& from);
+  void MergeFrom( const Message_Payload& from) {
+    Message_Payload::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -384,10 +465,10 @@ class Message_Payload final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Message_Payload* other);
@@ -469,10 +550,13 @@ class Message_Payload final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valid_;
-  ::hare_mq::BasicProperties* properties_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valid_;
+    ::hare_mq::BasicProperties* properties_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_msg_2eproto;
 };
 // -------------------------------------------------------------------
@@ -525,7 +609,7 @@ class Message final :
                &_Message_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(Message& a, Message& b) {
     a.Swap(&b);
@@ -557,9 +641,11 @@ class Message final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Message& from);
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -568,10 +654,10 @@ class Message final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Message* other);
@@ -601,6 +687,7 @@ class Message final :
     kPayloadFieldNumber = 1,
     kOffsetFieldNumber = 2,
     kLengthFieldNumber = 3,
+    kTraceIdFieldNumber = 4,
   };
   // .hare_mq.Message.Payload payload = 1;
   bool has_payload() const;
@@ -638,6 +725,15 @@ class Message final :
   void _internal_set_length(uint32_t value);
   public:
 
+  // uint64 trace_id = 4;
+  void clear_trace_id();
+  uint64_t trace_id() const;
+  void set_trace_id(uint64_t value);
+  private:
+  uint64_t _internal_trace_id() const;
+  void _internal_set_trace_id(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:hare_mq.Message)
  private:
   class _Internal;
@@ -645,10 +741,14 @@ class Message final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::hare_mq::Message_Payload* payload_;
-  uint32_t offset_;
-  uint32_t length_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::hare_mq::Message_Payload* payload_;
+    uint32_t offset_;
+    uint32_t length_;
+    uint64_t trace_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_msg_2eproto;
 };
 // ===================================================================
@@ -660,11 +760,13 @@ class Message final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
 // BasicProperties
 
 // string id = 1;
 inline void BasicProperties::clear_id() {
-  id_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
 }
 inline const std::string& BasicProperties::id() const {
   // @@protoc_insertion_point(field_get:hare_mq.BasicProperties.id)
@@ -674,7 +776,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void BasicProperties::set_id(ArgT0&& arg0, ArgT... args) {
  
- id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:hare_mq.BasicProperties.id)
 }
 inline std::string* BasicProperties::mutable_id() {
@@ -683,19 +785,19 @@ inline std::string* BasicProperties::mutable_id() {
   return _s;
 }
 inline const std::string& BasicProperties::_internal_id() const {
-  return id_.Get();
+  return _impl_.id_.Get();
 }
 inline void BasicProperties::_internal_set_id(const std::string& value) {
   
-  id_.Set(value, GetArenaForAllocation());
+  _impl_.id_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BasicProperties::_internal_mutable_id() {
   
-  return id_.Mutable(GetArenaForAllocation());
+  return _impl_.id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BasicProperties::release_id() {
   // @@protoc_insertion_point(field_release:hare_mq.BasicProperties.id)
-  return id_.Release();
+  return _impl_.id_.Release();
 }
 inline void BasicProperties::set_allocated_id(std::string* id) {
   if (id != nullptr) {
@@ -703,10 +805,10 @@ inline void BasicProperties::set_allocated_id(std::string* id) {
   } else {
     
   }
-  id_.SetAllocated(id, GetArenaForAllocation());
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (id_.IsDefault()) {
-    id_.Set("", GetArenaForAllocation());
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:hare_mq.BasicProperties.id)
@@ -714,10 +816,10 @@ inline void BasicProperties::set_allocated_id(std::string* id) {
 
 // .hare_mq.DeliveryMode delivery_mode = 2;
 inline void BasicProperties::clear_delivery_mode() {
-  delivery_mode_ = 0;
+  _impl_.delivery_mode_ = 0;
 }
 inline ::hare_mq::DeliveryMode BasicProperties::_internal_delivery_mode() const {
-  return static_cast< ::hare_mq::DeliveryMode >(delivery_mode_);
+  return static_cast< ::hare_mq::DeliveryMode >(_impl_.delivery_mode_);
 }
 inline ::hare_mq::DeliveryMode BasicProperties::delivery_mode() const {
   // @@protoc_insertion_point(field_get:hare_mq.BasicProperties.delivery_mode)
@@ -725,7 +827,7 @@ inline ::hare_mq::DeliveryMode BasicProperties::delivery_mode() const {
 }
 inline void BasicProperties::_internal_set_delivery_mode(::hare_mq::DeliveryMode value) {
   
-  delivery_mode_ = value;
+  _impl_.delivery_mode_ = value;
 }
 inline void BasicProperties::set_delivery_mode(::hare_mq::DeliveryMode value) {
   _internal_set_delivery_mode(value);
@@ -734,7 +836,7 @@ inline void BasicProperties::set_delivery_mode(::hare_mq::DeliveryMode value) {
 
 // string routing_key = 3;
 inline void BasicProperties::clear_routing_key() {
-  routing_key_.ClearToEmpty();
+  _impl_.routing_key_.ClearToEmpty();
 }
 inline const std::string& BasicProperties::routing_key() const {
   // @@protoc_insertion_point(field_get:hare_mq.BasicProperties.routing_key)
@@ -744,7 +846,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void BasicProperties::set_routing_key(ArgT0&& arg0, ArgT... args) {
  
- routing_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.routing_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:hare_mq.BasicProperties.routing_key)
 }
 inline std::string* BasicProperties::mutable_routing_key() {
@@ -753,19 +855,19 @@ inline std::string* BasicProperties::mutable_routing_key() {
   return _s;
 }
 inline const std::string& BasicProperties::_internal_routing_key() const {
-  return routing_key_.Get();
+  return _impl_.routing_key_.Get();
 }
 inline void BasicProperties::_internal_set_routing_key(const std::string& value) {
   
-  routing_key_.Set(value, GetArenaForAllocation());
+  _impl_.routing_key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BasicProperties::_internal_mutable_routing_key() {
   
-  return routing_key_.Mutable(GetArenaForAllocation());
+  return _impl_.routing_key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BasicProperties::release_routing_key() {
   // @@protoc_insertion_point(field_release:hare_mq.BasicProperties.routing_key)
-  return routing_key_.Release();
+  return _impl_.routing_key_.Release();
 }
 inline void BasicProperties::set_allocated_routing_key(std::string* routing_key) {
   if (routing_key != nullptr) {
@@ -773,34 +875,83 @@ inline void BasicProperties::set_allocated_routing_key(std::string* routing_key)
   } else {
     
   }
-  routing_key_.SetAllocated(routing_key, GetArenaForAllocation());
+  _impl_.routing_key_.SetAllocated(routing_key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (routing_key_.IsDefault()) {
-    routing_key_.Set("", GetArenaForAllocation());
+  if (_impl_.routing_key_.IsDefault()) {
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:hare_mq.BasicProperties.routing_key)
 }
 
+// map<string, string> headers = 4;
+inline int BasicProperties::_internal_headers_size() const {
+  return _impl_.headers_.size();
+}
+inline int BasicProperties::headers_size() const {
+  return _internal_headers_size();
+}
+inline void BasicProperties::clear_headers() {
+  _impl_.headers_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+BasicProperties::_internal_headers() const {
+  return _impl_.headers_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+BasicProperties::headers() const {
+  // @@protoc_insertion_point(field_map:hare_mq.BasicProperties.headers)
+  return _internal_headers();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+BasicProperties::_internal_mutable_headers() {
+  return _impl_.headers_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+BasicProperties::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_map:hare_mq.BasicProperties.headers)
+  return _internal_mutable_headers();
+}
+
+// uint32 priority = 5;
+inline void BasicProperties::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t BasicProperties::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t BasicProperties::priority() const {
+  // @@protoc_insertion_point(field_get:hare_mq.BasicProperties.priority)
+  return _internal_priority();
+}
+inline void BasicProperties::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void BasicProperties::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:hare_mq.BasicProperties.priority)
+}
+
 // -------------------------------------------------------------------
 
 // Message_Payload
 
 // .hare_mq.BasicProperties properties = 1;
 inline bool Message_Payload::_internal_has_properties() const {
-  return this != internal_default_instance() && properties_ != nullptr;
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
 }
 inline bool Message_Payload::has_properties() const {
   return _internal_has_properties();
 }
 inline void Message_Payload::clear_properties() {
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
   }
-  properties_ = nullptr;
+  _impl_.properties_ = nullptr;
 }
 inline const ::hare_mq::BasicProperties& Message_Payload::_internal_properties() const {
-  const ::hare_mq::BasicProperties* p = properties_;
+  const ::hare_mq::BasicProperties* p = _impl_.properties_;
   return p != nullptr ? *p : reinterpret_cast<const ::hare_mq::BasicProperties&>(
       ::hare_mq::_BasicProperties_default_instance_);
 }
@@ -811,9 +962,9 @@ inline const ::hare_mq::BasicProperties& Message_Payload::properties() const {
 inline void Message_Payload::unsafe_arena_set_allocated_properties(
     ::hare_mq::BasicProperties* properties) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
   }
-  properties_ = properties;
+  _impl_.properties_ = properties;
   if (properties) {
     
   } else {
@@ -823,8 +974,8 @@ inline void Message_Payload::unsafe_arena_set_allocated_properties(
 }
 inline ::hare_mq::BasicProperties* Message_Payload::release_properties() {
   
-  ::hare_mq::BasicProperties* temp = properties_;
-  properties_ = nullptr;
+  ::hare_mq::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -839,17 +990,17 @@ inline ::hare_mq::BasicProperties* Message_Payload::release_properties() {
 inline ::hare_mq::BasicProperties* Message_Payload::unsafe_arena_release_properties() {
   // @@protoc_insertion_point(field_release:hare_mq.Message.Payload.properties)
   
-  ::hare_mq::BasicProperties* temp = properties_;
-  properties_ = nullptr;
+  ::hare_mq::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
   return temp;
 }
 inline ::hare_mq::BasicProperties* Message_Payload::_internal_mutable_properties() {
   
-  if (properties_ == nullptr) {
+  if (_impl_.properties_ == nullptr) {
     auto* p = CreateMaybeMessage<::hare_mq::BasicProperties>(GetArenaForAllocation());
-    properties_ = p;
+    _impl_.properties_ = p;
   }
-  return properties_;
+  return _impl_.properties_;
 }
 inline ::hare_mq::BasicProperties* Message_Payload::mutable_properties() {
   ::hare_mq::BasicProperties* _msg = _internal_mutable_properties();
@@ -859,7 +1010,7 @@ inline ::hare_mq::BasicProperties* Message_Payload::mutable_properties() {
 inline void Message_Payload::set_allocated_properties(::hare_mq::BasicProperties* properties) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete properties_;
+    delete _impl_.properties_;
   }
   if (properties) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -872,13 +1023,13 @@ inline void Message_Payload::set_allocated_properties(::hare_mq::BasicProperties
   } else {
     
   }
-  properties_ = properties;
+  _impl_.properties_ = properties;
   // @@protoc_insertion_point(field_set_allocated:hare_mq.Message.Payload.properties)
 }
 
 // string body = 2;
 inline void Message_Payload::clear_body() {
-  body_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
 }
 inline const std::string& Message_Payload::body() const {
   // @@protoc_insertion_point(field_get:hare_mq.Message.Payload.body)
@@ -888,7 +1039,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Message_Payload::set_body(ArgT0&& arg0, ArgT... args) {
  
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:hare_mq.Message.Payload.body)
 }
 inline std::string* Message_Payload::mutable_body() {
@@ -897,19 +1048,19 @@ inline std::string* Message_Payload::mutable_body() {
   return _s;
 }
 inline const std::string& Message_Payload::_internal_body() const {
-  return body_.Get();
+  return _impl_.body_.Get();
 }
 inline void Message_Payload::_internal_set_body(const std::string& value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Message_Payload::_internal_mutable_body() {
   
-  return body_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Message_Payload::release_body() {
   // @@protoc_insertion_point(field_release:hare_mq.Message.Payload.body)
-  return body_.Release();
+  return _impl_.body_.Release();
 }
 inline void Message_Payload::set_allocated_body(std::string* body) {
   if (body != nullptr) {
@@ -917,10 +1068,10 @@ inline void Message_Payload::set_allocated_body(std::string* body) {
   } else {
     
   }
-  body_.SetAllocated(body, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:hare_mq.Message.Payload.body)
@@ -928,7 +1079,7 @@ inline void Message_Payload::set_allocated_body(std::string* body) {
 
 // string valid = 3;
 inline void Message_Payload::clear_valid() {
-  valid_.ClearToEmpty();
+  _impl_.valid_.ClearToEmpty();
 }
 inline const std::string& Message_Payload::valid() const {
   // @@protoc_insertion_point(field_get:hare_mq.Message.Payload.valid)
@@ -938,7 +1089,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Message_Payload::set_valid(ArgT0&& arg0, ArgT... args) {
  
- valid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.valid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:hare_mq.Message.Payload.valid)
 }
 inline std::string* Message_Payload::mutable_valid() {
@@ -947,19 +1098,19 @@ inline std::string* Message_Payload::mutable_valid() {
   return _s;
 }
 inline const std::string& Message_Payload::_internal_valid() const {
-  return valid_.Get();
+  return _impl_.valid_.Get();
 }
 inline void Message_Payload::_internal_set_valid(const std::string& value) {
   
-  valid_.Set(value, GetArenaForAllocation());
+  _impl_.valid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Message_Payload::_internal_mutable_valid() {
   
-  return valid_.Mutable(GetArenaForAllocation());
+  return _impl_.valid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Message_Payload::release_valid() {
   // @@protoc_insertion_point(field_release:hare_mq.Message.Payload.valid)
-  return valid_.Release();
+  return _impl_.valid_.Release();
 }
 inline void Message_Payload::set_allocated_valid(std::string* valid) {
   if (valid != nullptr) {
@@ -967,10 +1118,10 @@ inline void Message_Payload::set_allocated_valid(std::string* valid) {
   } else {
     
   }
-  valid_.SetAllocated(valid, GetArenaForAllocation());
+  _impl_.valid_.SetAllocated(valid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (valid_.IsDefault()) {
-    valid_.Set("", GetArenaForAllocation());
+  if (_impl_.valid_.IsDefault()) {
+    _impl_.valid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:hare_mq.Message.Payload.valid)
@@ -982,19 +1133,19 @@ inline void Message_Payload::set_allocated_valid(std::string* valid) {
 
 // .hare_mq.Message.Payload payload = 1;
 inline bool Message::_internal_has_payload() const {
-  return this != internal_default_instance() && payload_ != nullptr;
+  return this != internal_default_instance() && _impl_.payload_ != nullptr;
 }
 inline bool Message::has_payload() const {
   return _internal_has_payload();
 }
 inline void Message::clear_payload() {
-  if (GetArenaForAllocation() == nullptr && payload_ != nullptr) {
-    delete payload_;
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
   }
-  payload_ = nullptr;
+  _impl_.payload_ = nullptr;
 }
 inline const ::hare_mq::Message_Payload& Message::_internal_payload() const {
-  const ::hare_mq::Message_Payload* p = payload_;
+  const ::hare_mq::Message_Payload* p = _impl_.payload_;
   return p != nullptr ? *p : reinterpret_cast<const ::hare_mq::Message_Payload&>(
       ::hare_mq::_Message_Payload_default_instance_);
 }
@@ -1005,9 +1156,9 @@ inline const ::hare_mq::Message_Payload& Message::payload() const {
 inline void Message::unsafe_arena_set_allocated_payload(
     ::hare_mq::Message_Payload* payload) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(payload_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.payload_);
   }
-  payload_ = payload;
+  _impl_.payload_ = payload;
   if (payload) {
     
   } else {
@@ -1017,8 +1168,8 @@ inline void Message::unsafe_arena_set_allocated_payload(
 }
 inline ::hare_mq::Message_Payload* Message::release_payload() {
   
-  ::hare_mq::Message_Payload* temp = payload_;
-  payload_ = nullptr;
+  ::hare_mq::Message_Payload* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1033,17 +1184,17 @@ inline ::hare_mq::Message_Payload* Message::release_payload() {
 inline ::hare_mq::Message_Payload* Message::unsafe_arena_release_payload() {
   // @@protoc_insertion_point(field_release:hare_mq.Message.payload)
   
-  ::hare_mq::Message_Payload* temp = payload_;
-  payload_ = nullptr;
+  ::hare_mq::Message_Payload* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
   return temp;
 }
 inline ::hare_mq::Message_Payload* Message::_internal_mutable_payload() {
   
-  if (payload_ == nullptr) {
+  if (_impl_.payload_ == nullptr) {
     auto* p = CreateMaybeMessage<::hare_mq::Message_Payload>(GetArenaForAllocation());
-    payload_ = p;
+    _impl_.payload_ = p;
   }
-  return payload_;
+  return _impl_.payload_;
 }
 inline ::hare_mq::Message_Payload* Message::mutable_payload() {
   ::hare_mq::Message_Payload* _msg = _internal_mutable_payload();
@@ -1053,7 +1204,7 @@ inline ::hare_mq::Message_Payload* Message::mutable_payload() {
 inline void Message::set_allocated_payload(::hare_mq::Message_Payload* payload) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete payload_;
+    delete _impl_.payload_;
   }
   if (payload) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -1066,16 +1217,16 @@ inline void Message::set_allocated_payload(::hare_mq::Message_Payload* payload)
   } else {
     
   }
-  payload_ = payload;
+  _impl_.payload_ = payload;
   // @@protoc_insertion_point(field_set_allocated:hare_mq.Message.payload)
 }
 
 // uint32 offset = 2;
 inline void Message::clear_offset() {
-  offset_ = 0u;
+  _impl_.offset_ = 0u;
 }
 inline uint32_t Message::_internal_offset() const {
-  return offset_;
+  return _impl_.offset_;
 }
 inline uint32_t Message::offset() const {
   // @@protoc_insertion_point(field_get:hare_mq.Message.offset)
@@ -1083,7 +1234,7 @@ inline uint32_t Message::offset() const {
 }
 inline void Message::_internal_set_offset(uint32_t value) {
   
-  offset_ = value;
+  _impl_.offset_ = value;
 }
 inline void Message::set_offset(uint32_t value) {
   _internal_set_offset(value);
@@ -1092,10 +1243,10 @@ inline void Message::set_offset(uint32_t value) {
 
 // uint32 length = 3;
 inline void Message::clear_length() {
-  length_ = 0u;
+  _impl_.length_ = 0u;
 }
 inline uint32_t Message::_internal_length() const {
-  return length_;
+  return _impl_.length_;
 }
 inline uint32_t Message::length() const {
   // @@protoc_insertion_point(field_get:hare_mq.Message.length)
@@ -1103,13 +1254,33 @@ inline uint32_t Message::length() const {
 }
 inline void Message::_internal_set_length(uint32_t value) {
   
-  length_ = value;
+  _impl_.length_ = value;
 }
 inline void Message::set_length(uint32_t value) {
   _internal_set_length(value);
   // @@protoc_insertion_point(field_set:hare_mq.Message.length)
 }
 
+// uint64 trace_id = 4;
+inline void Message::clear_trace_id() {
+  _impl_.trace_id_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_trace_id() const {
+  return _impl_.trace_id_;
+}
+inline uint64_t Message::trace_id() const {
+  // @@protoc_insertion_point(field_get:hare_mq.Message.trace_id)
+  return _internal_trace_id();
+}
+inline void Message::_internal_set_trace_id(uint64_t value) {
+  
+  _impl_.trace_id_ = value;
+}
+inline void Message::set_trace_id(uint64_t value) {
+  _internal_set_trace_id(value);
+  // @@protoc_insertion_point(field_set:hare_mq.Message.trace_id)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1117,6 +1288,8 @@ inline void Message::set_length(uint32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -22,9 +22,10 @@ namespace _pbi = _pb::internal;
 
 namespace hare_mq {
 PROTOBUF_CONSTEXPR openChannelRequest::openChannelRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct openChannelRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR openChannelRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -35,9 +36,10 @@ struct openChannelRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 openChannelRequestDefaultTypeInternal _openChannelRequest_default_instance_;
 PROTOBUF_CONSTEXPR closeChannelRequest::closeChannelRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct closeChannelRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR closeChannelRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -48,7 +50,7 @@ struct closeChannelRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 closeChannelRequestDefaultTypeInternal _closeChannelRequest_default_instance_;
 PROTOBUF_CONSTEXPR declareExchangeRequest_ArgsEntry_DoNotUse::declareExchangeRequest_ArgsEntry_DoNotUse(
-    ::_pbi::ConstantInitialized){}
+    ::_pbi::ConstantInitialized) {}
 struct declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -59,15 +61,15 @@ struct declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal _declareExchangeRequest_ArgsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR declareExchangeRequest::declareExchangeRequest(
-    ::_pbi::ConstantInitialized)
-  : args_(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{})
-  , rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_type_(0)
-
-  , durable_(false)
-  , auto_delete_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_type_)*/0
+  , /*decltype(_impl_.durable_)*/false
+  , /*decltype(_impl_.auto_delete_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct declareExchangeRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareExchangeRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -78,10 +80,11 @@ struct declareExchangeRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareExchangeRequestDefaultTypeInternal _declareExchangeRequest_default_instance_;
 PROTOBUF_CONSTEXPR deleteExchangeRequest::deleteExchangeRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct deleteExchangeRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR deleteExchangeRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -92,7 +95,7 @@ struct deleteExchangeRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 deleteExchangeRequestDefaultTypeInternal _deleteExchangeRequest_default_instance_;
 PROTOBUF_CONSTEXPR declareQueueRequest_ArgsEntry_DoNotUse::declareQueueRequest_ArgsEntry_DoNotUse(
-    ::_pbi::ConstantInitialized){}
+    ::_pbi::ConstantInitialized) {}
 struct declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -103,14 +106,15 @@ struct declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal _declareQueueRequest_ArgsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR declareQueueRequest::declareQueueRequest(
-    ::_pbi::ConstantInitialized)
-  : args_(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{})
-  , rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exclusive_(false)
-  , durable_(false)
-  , auto_delete_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exclusive_)*/false
+  , /*decltype(_impl_.durable_)*/false
+  , /*decltype(_impl_.auto_delete_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct declareQueueRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareQueueRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -121,10 +125,11 @@ struct declareQueueRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareQueueRequestDefaultTypeInternal _declareQueueRequest_default_instance_;
 PROTOBUF_CONSTEXPR deleteQueueRequest::deleteQueueRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct deleteQueueRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR deleteQueueRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -135,12 +140,13 @@ struct deleteQueueRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 deleteQueueRequestDefaultTypeInternal _deleteQueueRequest_default_instance_;
 PROTOBUF_CONSTEXPR bindRequest::bindRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , binding_key_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binding_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct bindRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR bindRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -151,11 +157,12 @@ struct bindRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 bindRequestDefaultTypeInternal _bindRequest_default_instance_;
 PROTOBUF_CONSTEXPR unbindRequest::unbindRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct unbindRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR unbindRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -166,12 +173,13 @@ struct unbindRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 unbindRequestDefaultTypeInternal _unbindRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicPublishRequest::basicPublishRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , body_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , properties_(nullptr){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicPublishRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicPublishRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -182,11 +190,14 @@ struct basicPublishRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicPublishRequestDefaultTypeInternal _basicPublishRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicAckRequest::basicAckRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , message_id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delivery_tag_)*/uint64_t{0u}
+  , /*decltype(_impl_.multiple_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicAckRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicAckRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -196,13 +207,51 @@ struct basicAckRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicAckRequestDefaultTypeInternal _basicAckRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicNackRequest::basicNackRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delivery_tag_)*/uint64_t{0u}
+  , /*decltype(_impl_.requeue_)*/false
+  , /*decltype(_impl_.multiple_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicNackRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicNackRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicNackRequestDefaultTypeInternal() {}
+  union {
+    basicNackRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicNackRequestDefaultTypeInternal _basicNackRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicRejectRequest::basicRejectRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delivery_tag_)*/uint64_t{0u}
+  , /*decltype(_impl_.requeue_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicRejectRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicRejectRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicRejectRequestDefaultTypeInternal() {}
+  union {
+    basicRejectRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicRejectRequestDefaultTypeInternal _basicRejectRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicConsumeRequest::basicConsumeRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , consumer_tag_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , auto_ack_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.auto_ack_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicConsumeRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicConsumeRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -213,11 +262,12 @@ struct basicConsumeRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConsumeRequestDefaultTypeInternal _basicConsumeRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicCancelRequest::basicCancelRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , consumer_tag_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicCancelRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicCancelRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -228,11 +278,13 @@ struct basicCancelRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicCancelRequestDefaultTypeInternal _basicCancelRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicConsumeResponse::basicConsumeResponse(
-    ::_pbi::ConstantInitialized)
-  : cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , consumer_tag_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , body_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , properties_(nullptr){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_.delivery_tag_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicConsumeResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicConsumeResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -242,11 +294,46 @@ struct basicConsumeResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConsumeResponseDefaultTypeInternal _basicConsumeResponse_default_instance_;
+PROTOBUF_CONSTEXPR basicGetRequest::basicGetRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_count_)*/0u
+  , /*decltype(_impl_.auto_ack_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicGetRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicGetRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicGetRequestDefaultTypeInternal() {}
+  union {
+    basicGetRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicGetRequestDefaultTypeInternal _basicGetRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicGetResponse::basicGetResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ok_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicGetResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicGetResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicGetResponseDefaultTypeInternal() {}
+  union {
+    basicGetResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicGetResponseDefaultTypeInternal _basicGetResponse_default_instance_;
 PROTOBUF_CONSTEXPR basicCommonResponse::basicCommonResponse(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , ok_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ok_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicCommonResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicCommonResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -257,9 +344,10 @@ struct basicCommonResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicCommonResponseDefaultTypeInternal _basicCommonResponse_default_instance_;
 PROTOBUF_CONSTEXPR basicQueryRequest::basicQueryRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicQueryRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicQueryRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -270,10 +358,11 @@ struct basicQueryRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicQueryRequestDefaultTypeInternal _basicQueryRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicQueryResponse::basicQueryResponse(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , body_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicQueryResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicQueryResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -283,9 +372,251 @@ struct basicQueryResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicQueryResponseDefaultTypeInternal _basicQueryResponse_default_instance_;
+PROTOBUF_CONSTEXPR heartbeatRequest::heartbeatRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.interval_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct heartbeatRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR heartbeatRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~heartbeatRequestDefaultTypeInternal() {}
+  union {
+    heartbeatRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 heartbeatRequestDefaultTypeInternal _heartbeatRequest_default_instance_;
+PROTOBUF_CONSTEXPR heartbeatResponse::heartbeatResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.interval_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct heartbeatResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR heartbeatResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~heartbeatResponseDefaultTypeInternal() {}
+  union {
+    heartbeatResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 heartbeatResponseDefaultTypeInternal _heartbeatResponse_default_instance_;
+PROTOBUF_CONSTEXPR heartbeat::heartbeat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct heartbeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR heartbeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~heartbeatDefaultTypeInternal() {}
+  union {
+    heartbeat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 heartbeatDefaultTypeInternal _heartbeat_default_instance_;
+PROTOBUF_CONSTEXPR metricsRequest::metricsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prometheus_text_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct metricsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR metricsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~metricsRequestDefaultTypeInternal() {}
+  union {
+    metricsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 metricsRequestDefaultTypeInternal _metricsRequest_default_instance_;
+PROTOBUF_CONSTEXPR metricCounter::metricCounter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct metricCounterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR metricCounterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~metricCounterDefaultTypeInternal() {}
+  union {
+    metricCounter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 metricCounterDefaultTypeInternal _metricCounter_default_instance_;
+PROTOBUF_CONSTEXPR metricHistogram::metricHistogram(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.sum_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct metricHistogramDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR metricHistogramDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~metricHistogramDefaultTypeInternal() {}
+  union {
+    metricHistogram _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 metricHistogramDefaultTypeInternal _metricHistogram_default_instance_;
+PROTOBUF_CONSTEXPR queueMetrics::queueMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.depth_)*/uint64_t{0u}
+  , /*decltype(_impl_.unacked_)*/uint64_t{0u}
+  , /*decltype(_impl_.disk_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.published_)*/uint64_t{0u}
+  , /*decltype(_impl_.delivered_)*/uint64_t{0u}
+  , /*decltype(_impl_.acked_)*/uint64_t{0u}
+  , /*decltype(_impl_.redelivered_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct queueMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR queueMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~queueMetricsDefaultTypeInternal() {}
+  union {
+    queueMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 queueMetricsDefaultTypeInternal _queueMetrics_default_instance_;
+PROTOBUF_CONSTEXPR metricsResponse::metricsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.counters_)*/{}
+  , /*decltype(_impl_.histograms_)*/{}
+  , /*decltype(_impl_.queues_)*/{}
+  , /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ok_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct metricsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR metricsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~metricsResponseDefaultTypeInternal() {}
+  union {
+    metricsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 metricsResponseDefaultTypeInternal _metricsResponse_default_instance_;
+PROTOBUF_CONSTEXPR statsRequest::statsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.section_)*/0
+  , /*decltype(_impl_.include_bindings_)*/false
+  , /*decltype(_impl_.offset_)*/0u
+  , /*decltype(_impl_.limit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct statsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR statsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~statsRequestDefaultTypeInternal() {}
+  union {
+    statsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 statsRequestDefaultTypeInternal _statsRequest_default_instance_;
+PROTOBUF_CONSTEXPR bindingStats::bindingStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binding_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct bindingStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR bindingStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~bindingStatsDefaultTypeInternal() {}
+  union {
+    bindingStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 bindingStatsDefaultTypeInternal _bindingStats_default_instance_;
+PROTOBUF_CONSTEXPR exchangeStats::exchangeStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bindings_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.durable_)*/false
+  , /*decltype(_impl_.auto_delete_)*/false
+  , /*decltype(_impl_.binding_count_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct exchangeStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR exchangeStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~exchangeStatsDefaultTypeInternal() {}
+  union {
+    exchangeStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 exchangeStatsDefaultTypeInternal _exchangeStats_default_instance_;
+PROTOBUF_CONSTEXPR queueStats::queueStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.depth_)*/uint64_t{0u}
+  , /*decltype(_impl_.unacked_)*/uint64_t{0u}
+  , /*decltype(_impl_.consumer_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.published_)*/uint64_t{0u}
+  , /*decltype(_impl_.delivered_)*/uint64_t{0u}
+  , /*decltype(_impl_.acked_)*/uint64_t{0u}
+  , /*decltype(_impl_.redelivered_)*/uint64_t{0u}
+  , /*decltype(_impl_.durable_)*/false
+  , /*decltype(_impl_.exclusive_)*/false
+  , /*decltype(_impl_.auto_delete_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct queueStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR queueStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~queueStatsDefaultTypeInternal() {}
+  union {
+    queueStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 queueStatsDefaultTypeInternal _queueStats_default_instance_;
+PROTOBUF_CONSTEXPR consumerStats::consumerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.unacked_)*/uint64_t{0u}
+  , /*decltype(_impl_.auto_ack_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct consumerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR consumerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~consumerStatsDefaultTypeInternal() {}
+  union {
+    consumerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 consumerStatsDefaultTypeInternal _consumerStats_default_instance_;
+PROTOBUF_CONSTEXPR statsResponse::statsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.exchanges_)*/{}
+  , /*decltype(_impl_.queues_)*/{}
+  , /*decltype(_impl_.consumers_)*/{}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_exchanges_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_queues_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_consumers_)*/uint64_t{0u}
+  , /*decltype(_impl_.ok_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct statsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR statsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~statsResponseDefaultTypeInternal() {}
+  union {
+    statsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 statsResponseDefaultTypeInternal _statsResponse_default_instance_;
 }  // namespace hare_mq
-static ::_pb::Metadata file_level_metadata_protocol_2eproto[18];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_protocol_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_protocol_2eproto[36];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_protocol_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_protocol_2eproto = nullptr;
 
 const uint32_t TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -295,16 +626,16 @@ const uint32_t TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::openChannelRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::openChannelRequest, cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::openChannelRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::openChannelRequest, _impl_.cid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::closeChannelRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::closeChannelRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::closeChannelRequest, cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::closeChannelRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::closeChannelRequest, _impl_.cid_),
   PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest_ArgsEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest_ArgsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -321,22 +652,22 @@ const uint32_t TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, exchange_type_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, durable_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, auto_delete_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, args_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.exchange_type_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.durable_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.auto_delete_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareExchangeRequest, _impl_.args_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteExchangeRequest, _impl_.exchange_name_),
   PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest_ArgsEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest_ArgsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -353,121 +684,329 @@ const uint32_t TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, exclusive_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, durable_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, auto_delete_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, args_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.exclusive_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.durable_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.auto_delete_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::declareQueueRequest, _impl_.args_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::deleteQueueRequest, _impl_.queue_name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, binding_key_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindRequest, _impl_.binding_key_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::unbindRequest, _impl_.queue_name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, body_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, properties_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicPublishRequest, _impl_.properties_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, message_id_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _impl_.delivery_tag_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicAckRequest, _impl_.multiple_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.requeue_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.delivery_tag_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicNackRequest, _impl_.multiple_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _impl_.requeue_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicRejectRequest, _impl_.delivery_tag_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, consumer_tag_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, auto_ack_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeRequest, _impl_.auto_ack_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, consumer_tag_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCancelRequest, _impl_.queue_name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, consumer_tag_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, body_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, properties_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, _impl_.properties_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicConsumeResponse, _impl_.delivery_tag_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _impl_.max_count_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _impl_.max_bytes_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetRequest, _impl_.auto_ack_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetResponse, _impl_.ok_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicGetResponse, _impl_.messages_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, ok_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicCommonResponse, _impl_.ok_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryRequest, cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryRequest, _impl_.cid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, rid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, cid_),
-  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, body_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::basicQueryResponse, _impl_.body_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeatRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeatRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeatRequest, _impl_.interval_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeatResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeatResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeatResponse, _impl_.interval_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::heartbeat, _impl_.timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsRequest, _impl_.prometheus_text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricCounter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricCounter, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricCounter, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.sum_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.p50_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.p90_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.p99_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.p999_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricHistogram, _impl_.max_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.unacked_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.disk_bytes_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.published_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.delivered_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.acked_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueMetrics, _impl_.redelivered_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.ok_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.counters_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.histograms_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.queues_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::metricsResponse, _impl_.requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.section_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.name_prefix_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.include_bindings_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsRequest, _impl_.limit_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindingStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindingStats, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::bindingStats, _impl_.binding_key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _impl_.durable_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _impl_.auto_delete_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _impl_.binding_count_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::exchangeStats, _impl_.bindings_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.durable_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.exclusive_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.auto_delete_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.unacked_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.consumer_count_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.published_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.delivered_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.acked_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::queueStats, _impl_.redelivered_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::consumerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::consumerStats, _impl_.tag_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::consumerStats, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::consumerStats, _impl_.auto_ack_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::consumerStats, _impl_.unacked_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.ok_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.exchanges_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.queues_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.consumers_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.total_exchanges_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.total_queues_),
+  PROTOBUF_FIELD_OFFSET(::hare_mq::statsResponse, _impl_.total_consumers_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::hare_mq::openChannelRequest)},
@@ -482,12 +1021,30 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 91, -1, -1, sizeof(::hare_mq::unbindRequest)},
   { 101, -1, -1, sizeof(::hare_mq::basicPublishRequest)},
   { 112, -1, -1, sizeof(::hare_mq::basicAckRequest)},
-  { 122, -1, -1, sizeof(::hare_mq::basicConsumeRequest)},
-  { 133, -1, -1, sizeof(::hare_mq::basicCancelRequest)},
-  { 143, -1, -1, sizeof(::hare_mq::basicConsumeResponse)},
-  { 153, -1, -1, sizeof(::hare_mq::basicCommonResponse)},
-  { 162, -1, -1, sizeof(::hare_mq::basicQueryRequest)},
-  { 170, -1, -1, sizeof(::hare_mq::basicQueryResponse)},
+  { 124, -1, -1, sizeof(::hare_mq::basicNackRequest)},
+  { 137, -1, -1, sizeof(::hare_mq::basicRejectRequest)},
+  { 149, -1, -1, sizeof(::hare_mq::basicConsumeRequest)},
+  { 160, -1, -1, sizeof(::hare_mq::basicCancelRequest)},
+  { 170, -1, -1, sizeof(::hare_mq::basicConsumeResponse)},
+  { 181, -1, -1, sizeof(::hare_mq::basicGetRequest)},
+  { 193, -1, -1, sizeof(::hare_mq::basicGetResponse)},
+  { 203, -1, -1, sizeof(::hare_mq::basicCommonResponse)},
+  { 212, -1, -1, sizeof(::hare_mq::basicQueryRequest)},
+  { 220, -1, -1, sizeof(::hare_mq::basicQueryResponse)},
+  { 229, -1, -1, sizeof(::hare_mq::heartbeatRequest)},
+  { 237, -1, -1, sizeof(::hare_mq::heartbeatResponse)},
+  { 245, -1, -1, sizeof(::hare_mq::heartbeat)},
+  { 252, -1, -1, sizeof(::hare_mq::metricsRequest)},
+  { 261, -1, -1, sizeof(::hare_mq::metricCounter)},
+  { 269, -1, -1, sizeof(::hare_mq::metricHistogram)},
+  { 283, -1, -1, sizeof(::hare_mq::queueMetrics)},
+  { 297, -1, -1, sizeof(::hare_mq::metricsResponse)},
+  { 311, -1, -1, sizeof(::hare_mq::statsRequest)},
+  { 324, -1, -1, sizeof(::hare_mq::bindingStats)},
+  { 332, -1, -1, sizeof(::hare_mq::exchangeStats)},
+  { 344, -1, -1, sizeof(::hare_mq::queueStats)},
+  { 361, -1, -1, sizeof(::hare_mq::consumerStats)},
+  { 371, -1, -1, sizeof(::hare_mq::statsResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -503,12 +1060,30 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::hare_mq::_unbindRequest_default_instance_._instance,
   &::hare_mq::_basicPublishRequest_default_instance_._instance,
   &::hare_mq::_basicAckRequest_default_instance_._instance,
+  &::hare_mq::_basicNackRequest_default_instance_._instance,
+  &::hare_mq::_basicRejectRequest_default_instance_._instance,
   &::hare_mq::_basicConsumeRequest_default_instance_._instance,
   &::hare_mq::_basicCancelRequest_default_instance_._instance,
   &::hare_mq::_basicConsumeResponse_default_instance_._instance,
+  &::hare_mq::_basicGetRequest_default_instance_._instance,
+  &::hare_mq::_basicGetResponse_default_instance_._instance,
   &::hare_mq::_basicCommonResponse_default_instance_._instance,
   &::hare_mq::_basicQueryRequest_default_instance_._instance,
   &::hare_mq::_basicQueryResponse_default_instance_._instance,
+  &::hare_mq::_heartbeatRequest_default_instance_._instance,
+  &::hare_mq::_heartbeatResponse_default_instance_._instance,
+  &::hare_mq::_heartbeat_default_instance_._instance,
+  &::hare_mq::_metricsRequest_default_instance_._instance,
+  &::hare_mq::_metricCounter_default_instance_._instance,
+  &::hare_mq::_metricHistogram_default_instance_._instance,
+  &::hare_mq::_queueMetrics_default_instance_._instance,
+  &::hare_mq::_metricsResponse_default_instance_._instance,
+  &::hare_mq::_statsRequest_default_instance_._instance,
+  &::hare_mq::_bindingStats_default_instance_._instance,
+  &::hare_mq::_exchangeStats_default_instance_._instance,
+  &::hare_mq::_queueStats_default_instance_._instance,
+  &::hare_mq::_consumerStats_default_instance_._instance,
+  &::hare_mq::_statsResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_protocol_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -539,30 +1114,90 @@ const char descriptor_table_protodef_protocol_2eproto[] PROTOBUF_SECTION_VARIABL
   "asicPublishRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002"
   " \001(\t\022\025\n\rexchange_name\030\003 \001(\t\022\014\n\004body\030\004 \001("
   "\t\022,\n\nproperties\030\005 \001(\0132\030.hare_mq.BasicPro"
-  "perties\"S\n\017basicAckRequest\022\013\n\003rid\030\001 \001(\t\022"
+  "perties\"{\n\017basicAckRequest\022\013\n\003rid\030\001 \001(\t\022"
   "\013\n\003cid\030\002 \001(\t\022\022\n\nqueue_name\030\003 \001(\t\022\022\n\nmess"
-  "age_id\030\004 \001(\t\"k\n\023basicConsumeRequest\022\013\n\003r"
-  "id\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\024\n\014consumer_tag\030\003 "
-  "\001(\t\022\022\n\nqueue_name\030\004 \001(\t\022\020\n\010auto_ack\030\005 \001("
-  "\010\"X\n\022basicCancelRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003"
-  "cid\030\002 \001(\t\022\024\n\014consumer_tag\030\003 \001(\t\022\022\n\nqueue"
-  "_name\030\004 \001(\t\"u\n\024basicConsumeResponse\022\013\n\003c"
-  "id\030\001 \001(\t\022\024\n\014consumer_tag\030\002 \001(\t\022\014\n\004body\030\003"
-  " \001(\t\022,\n\nproperties\030\004 \001(\0132\030.hare_mq.Basic"
-  "Properties\";\n\023basicCommonResponse\022\013\n\003rid"
-  "\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\n\n\002ok\030\003 \001(\010\"-\n\021basic"
-  "QueryRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\"<"
-  "\n\022basicQueryResponse\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid"
-  "\030\002 \001(\t\022\014\n\004body\030\003 \001(\tb\006proto3"
+  "age_id\030\004 \001(\t\022\024\n\014delivery_tag\030\005 \001(\004\022\020\n\010mu"
+  "ltiple\030\006 \001(\010\"\215\001\n\020basicNackRequest\022\013\n\003rid"
+  "\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\022\n\nqueue_name\030\003 \001(\t\022"
+  "\022\n\nmessage_id\030\004 \001(\t\022\017\n\007requeue\030\005 \001(\010\022\024\n\014"
+  "delivery_tag\030\006 \001(\004\022\020\n\010multiple\030\007 \001(\010\"}\n\022"
+  "basicRejectRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002"
+  " \001(\t\022\022\n\nqueue_name\030\003 \001(\t\022\022\n\nmessage_id\030\004"
+  " \001(\t\022\017\n\007requeue\030\005 \001(\010\022\024\n\014delivery_tag\030\006 "
+  "\001(\004\"k\n\023basicConsumeRequest\022\013\n\003rid\030\001 \001(\t\022"
+  "\013\n\003cid\030\002 \001(\t\022\024\n\014consumer_tag\030\003 \001(\t\022\022\n\nqu"
+  "eue_name\030\004 \001(\t\022\020\n\010auto_ack\030\005 \001(\010\"X\n\022basi"
+  "cCancelRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t"
+  "\022\024\n\014consumer_tag\030\003 \001(\t\022\022\n\nqueue_name\030\004 \001"
+  "(\t\"\213\001\n\024basicConsumeResponse\022\013\n\003cid\030\001 \001(\t"
+  "\022\024\n\014consumer_tag\030\002 \001(\t\022\014\n\004body\030\003 \001(\t\022,\n\n"
+  "properties\030\004 \001(\0132\030.hare_mq.BasicProperti"
+  "es\022\024\n\014delivery_tag\030\005 \001(\004\"w\n\017basicGetRequ"
+  "est\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\022\n\nqueue_n"
+  "ame\030\003 \001(\t\022\021\n\tmax_count\030\004 \001(\r\022\021\n\tmax_byte"
+  "s\030\005 \001(\004\022\020\n\010auto_ack\030\006 \001(\010\"i\n\020basicGetRes"
+  "ponse\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\n\n\002ok\030\003 "
+  "\001(\010\022/\n\010messages\030\004 \003(\0132\035.hare_mq.basicCon"
+  "sumeResponse\";\n\023basicCommonResponse\022\013\n\003r"
+  "id\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\n\n\002ok\030\003 \001(\010\"-\n\021bas"
+  "icQueryRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t"
+  "\"<\n\022basicQueryResponse\022\013\n\003rid\030\001 \001(\t\022\013\n\003c"
+  "id\030\002 \001(\t\022\014\n\004body\030\003 \001(\t\"1\n\020heartbeatReque"
+  "st\022\013\n\003rid\030\001 \001(\t\022\020\n\010interval\030\002 \001(\r\"2\n\021hea"
+  "rtbeatResponse\022\013\n\003rid\030\001 \001(\t\022\020\n\010interval\030"
+  "\002 \001(\r\"\036\n\theartbeat\022\021\n\ttimestamp\030\001 \001(\004\"C\n"
+  "\016metricsRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001("
+  "\t\022\027\n\017prometheus_text\030\003 \001(\010\",\n\rmetricCoun"
+  "ter\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\004\"}\n\017metr"
+  "icHistogram\022\014\n\004name\030\001 \001(\t\022\r\n\005count\030\002 \001(\004"
+  "\022\013\n\003sum\030\003 \001(\004\022\013\n\003p50\030\004 \001(\004\022\013\n\003p90\030\005 \001(\004\022"
+  "\013\n\003p99\030\006 \001(\004\022\014\n\004p999\030\007 \001(\004\022\013\n\003max\030\010 \001(\004\""
+  "\232\001\n\014queueMetrics\022\014\n\004name\030\001 \001(\t\022\r\n\005depth\030"
+  "\002 \001(\004\022\017\n\007unacked\030\003 \001(\004\022\022\n\ndisk_bytes\030\004 \001"
+  "(\004\022\021\n\tpublished\030\005 \001(\004\022\021\n\tdelivered\030\006 \001(\004"
+  "\022\r\n\005acked\030\007 \001(\004\022\023\n\013redelivered\030\010 \001(\004\"\360\001\n"
+  "\017metricsResponse\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001"
+  "(\t\022\n\n\002ok\030\003 \001(\010\022(\n\010counters\030\004 \003(\0132\026.hare_"
+  "mq.metricCounter\022,\n\nhistograms\030\005 \003(\0132\030.h"
+  "are_mq.metricHistogram\022%\n\006queues\030\006 \003(\0132\025"
+  ".hare_mq.queueMetrics\022\014\n\004text\030\007 \001(\t\022*\n\010r"
+  "equests\030\010 \003(\0132\030.hare_mq.metricHistogram\""
+  "\236\001\n\014statsRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001"
+  "(\t\022&\n\007section\030\003 \001(\0162\025.hare_mq.StatsSecti"
+  "on\022\023\n\013name_prefix\030\004 \001(\t\022\030\n\020include_bindi"
+  "ngs\030\005 \001(\010\022\016\n\006offset\030\006 \001(\r\022\r\n\005limit\030\007 \001(\r"
+  "\"7\n\014bindingStats\022\022\n\nqueue_name\030\001 \001(\t\022\023\n\013"
+  "binding_key\030\002 \001(\t\"\250\001\n\rexchangeStats\022\014\n\004n"
+  "ame\030\001 \001(\t\022#\n\004type\030\002 \001(\0162\025.hare_mq.Exchan"
+  "geType\022\017\n\007durable\030\003 \001(\010\022\023\n\013auto_delete\030\004"
+  " \001(\010\022\025\n\rbinding_count\030\005 \001(\004\022\'\n\010bindings\030"
+  "\006 \003(\0132\025.hare_mq.bindingStats\"\325\001\n\nqueueSt"
+  "ats\022\014\n\004name\030\001 \001(\t\022\017\n\007durable\030\002 \001(\010\022\021\n\tex"
+  "clusive\030\003 \001(\010\022\023\n\013auto_delete\030\004 \001(\010\022\r\n\005de"
+  "pth\030\005 \001(\004\022\017\n\007unacked\030\006 \001(\004\022\026\n\016consumer_c"
+  "ount\030\007 \001(\004\022\021\n\tpublished\030\010 \001(\004\022\021\n\tdeliver"
+  "ed\030\t \001(\004\022\r\n\005acked\030\n \001(\004\022\023\n\013redelivered\030\013"
+  " \001(\004\"S\n\rconsumerStats\022\013\n\003tag\030\001 \001(\t\022\022\n\nqu"
+  "eue_name\030\002 \001(\t\022\020\n\010auto_ack\030\003 \001(\010\022\017\n\007unac"
+  "ked\030\004 \001(\004\"\211\002\n\rstatsResponse\022\013\n\003rid\030\001 \001(\t"
+  "\022\013\n\003cid\030\002 \001(\t\022\n\n\002ok\030\003 \001(\010\022\017\n\007version\030\004 \001"
+  "(\004\022)\n\texchanges\030\005 \003(\0132\026.hare_mq.exchange"
+  "Stats\022#\n\006queues\030\006 \003(\0132\023.hare_mq.queueSta"
+  "ts\022)\n\tconsumers\030\007 \003(\0132\026.hare_mq.consumer"
+  "Stats\022\027\n\017total_exchanges\030\010 \001(\004\022\024\n\014total_"
+  "queues\030\t \001(\004\022\027\n\017total_consumers\030\n \001(\004*Y\n"
+  "\014StatsSection\022\r\n\tSTATS_ALL\020\000\022\023\n\017STATS_EX"
+  "CHANGES\020\001\022\020\n\014STATS_QUEUES\020\002\022\023\n\017STATS_CON"
+  "SUMERS\020\003b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_protocol_2eproto_deps[1] = {
   &::descriptor_table_msg_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_protocol_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_protocol_2eproto = {
-    false, false, 1668, descriptor_table_protodef_protocol_2eproto,
+    false, false, 4056, descriptor_table_protodef_protocol_2eproto,
     "protocol.proto",
-    &descriptor_table_protocol_2eproto_once, descriptor_table_protocol_2eproto_deps, 1, 18,
+    &descriptor_table_protocol_2eproto_once, descriptor_table_protocol_2eproto_deps, 1, 36,
     schemas, file_default_instances, TableStruct_protocol_2eproto::offsets,
     file_level_metadata_protocol_2eproto, file_level_enum_descriptors_protocol_2eproto,
     file_level_service_descriptors_protocol_2eproto,
@@ -574,6 +1209,22 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_protocol
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_protocol_2eproto(&descriptor_table_protocol_2eproto);
 namespace hare_mq {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatsSection_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[0];
+}
+bool StatsSection_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -584,40 +1235,54 @@ class openChannelRequest::_Internal {
 openChannelRequest::openChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.openChannelRequest)
 }
 openChannelRequest::openChannelRequest(const openChannelRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  openChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.openChannelRequest)
 }
 
-inline void openChannelRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void openChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 openChannelRequest::~openChannelRequest() {
@@ -631,12 +1296,12 @@ openChannelRequest::~openChannelRequest() {
 
 inline void openChannelRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
 }
 
 void openChannelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void openChannelRequest::Clear() {
@@ -645,8 +1310,8 @@ void openChannelRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -755,35 +1420,31 @@ size_t openChannelRequest::ByteSizeLong() const {
         this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData openChannelRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     openChannelRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*openChannelRequest::GetClassData() const { return &_class_data_; }
 
-void openChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<openChannelRequest *>(to)->MergeFrom(
-      static_cast<const openChannelRequest &>(from));
-}
-
 
-void openChannelRequest::MergeFrom(const openChannelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.openChannelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void openChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<openChannelRequest*>(&to_msg);
+  auto& from = static_cast<const openChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.openChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void openChannelRequest::CopyFrom(const openChannelRequest& from) {
@@ -803,12 +1464,12 @@ void openChannelRequest::InternalSwap(openChannelRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
 }
 
@@ -827,40 +1488,54 @@ class closeChannelRequest::_Internal {
 closeChannelRequest::closeChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.closeChannelRequest)
 }
 closeChannelRequest::closeChannelRequest(const closeChannelRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  closeChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.closeChannelRequest)
 }
 
-inline void closeChannelRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void closeChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 closeChannelRequest::~closeChannelRequest() {
@@ -874,12 +1549,12 @@ closeChannelRequest::~closeChannelRequest() {
 
 inline void closeChannelRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
 }
 
 void closeChannelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void closeChannelRequest::Clear() {
@@ -888,8 +1563,8 @@ void closeChannelRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -998,35 +1673,31 @@ size_t closeChannelRequest::ByteSizeLong() const {
         this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData closeChannelRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     closeChannelRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*closeChannelRequest::GetClassData() const { return &_class_data_; }
 
-void closeChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<closeChannelRequest *>(to)->MergeFrom(
-      static_cast<const closeChannelRequest &>(from));
-}
-
 
-void closeChannelRequest::MergeFrom(const closeChannelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.closeChannelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void closeChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<closeChannelRequest*>(&to_msg);
+  auto& from = static_cast<const closeChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.closeChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void closeChannelRequest::CopyFrom(const closeChannelRequest& from) {
@@ -1046,12 +1717,12 @@ void closeChannelRequest::InternalSwap(closeChannelRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
 }
 
@@ -1083,9 +1754,8 @@ class declareExchangeRequest::_Internal {
 
 declareExchangeRequest::declareExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  args_(arena) {
-  SharedCtor();
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   if (arena != nullptr && !is_message_owned) {
     arena->OwnCustomDestructor(this, &declareExchangeRequest::ArenaDtor);
   }
@@ -1093,55 +1763,75 @@ declareExchangeRequest::declareExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* a
 }
 declareExchangeRequest::declareExchangeRequest(const declareExchangeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  declareExchangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.exchange_type_){}
+    , decltype(_impl_.durable_){}
+    , decltype(_impl_.auto_delete_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  args_.MergeFrom(from.args_);
-  rid_.InitDefault();
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&exchange_type_, &from.exchange_type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exchange_type_)) + sizeof(auto_delete_));
+  ::memcpy(&_impl_.exchange_type_, &from._impl_.exchange_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_delete_) -
+    reinterpret_cast<char*>(&_impl_.exchange_type_)) + sizeof(_impl_.auto_delete_));
   // @@protoc_insertion_point(copy_constructor:hare_mq.declareExchangeRequest)
 }
 
-inline void declareExchangeRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&exchange_type_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exchange_type_)) + sizeof(auto_delete_));
+inline void declareExchangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.exchange_type_){0}
+    , decltype(_impl_.durable_){false}
+    , decltype(_impl_.auto_delete_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 declareExchangeRequest::~declareExchangeRequest() {
@@ -1156,18 +1846,19 @@ declareExchangeRequest::~declareExchangeRequest() {
 
 inline void declareExchangeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  args_.Destruct();
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
+  _impl_.args_.Destruct();
+  _impl_.args_.~MapField();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.exchange_name_.Destroy();
 }
 
 void declareExchangeRequest::ArenaDtor(void* object) {
   declareExchangeRequest* _this = reinterpret_cast< declareExchangeRequest* >(object);
-  _this->args_.Destruct();
+  _this->_impl_.args_.Destruct();
 }
 void declareExchangeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void declareExchangeRequest::Clear() {
@@ -1176,13 +1867,13 @@ void declareExchangeRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  args_.Clear();
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  ::memset(&exchange_type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&auto_delete_) -
-      reinterpret_cast<char*>(&exchange_type_)) + sizeof(auto_delete_));
+  _impl_.args_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  ::memset(&_impl_.exchange_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_delete_) -
+      reinterpret_cast<char*>(&_impl_.exchange_type_)) + sizeof(_impl_.auto_delete_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1234,7 +1925,7 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
       // bool durable = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1242,7 +1933,7 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
       // bool auto_delete = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1253,7 +1944,7 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&args_, ptr);
+            ptr = ctx->ParseMessage(&_impl_.args_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
@@ -1430,48 +2121,44 @@ size_t declareExchangeRequest::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData declareExchangeRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     declareExchangeRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*declareExchangeRequest::GetClassData() const { return &_class_data_; }
 
-void declareExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<declareExchangeRequest *>(to)->MergeFrom(
-      static_cast<const declareExchangeRequest &>(from));
-}
-
 
-void declareExchangeRequest::MergeFrom(const declareExchangeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.declareExchangeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void declareExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<declareExchangeRequest*>(&to_msg);
+  auto& from = static_cast<const declareExchangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.declareExchangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  args_.MergeFrom(from.args_);
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
   if (from._internal_exchange_type() != 0) {
-    _internal_set_exchange_type(from._internal_exchange_type());
+    _this->_internal_set_exchange_type(from._internal_exchange_type());
   }
   if (from._internal_durable() != 0) {
-    _internal_set_durable(from._internal_durable());
+    _this->_internal_set_durable(from._internal_durable());
   }
   if (from._internal_auto_delete() != 0) {
-    _internal_set_auto_delete(from._internal_auto_delete());
+    _this->_internal_set_auto_delete(from._internal_auto_delete());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void declareExchangeRequest::CopyFrom(const declareExchangeRequest& from) {
@@ -1490,25 +2177,25 @@ void declareExchangeRequest::InternalSwap(declareExchangeRequest* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  args_.InternalSwap(&other->args_);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(declareExchangeRequest, auto_delete_)
-      + sizeof(declareExchangeRequest::auto_delete_)
-      - PROTOBUF_FIELD_OFFSET(declareExchangeRequest, exchange_type_)>(
-          reinterpret_cast<char*>(&exchange_type_),
-          reinterpret_cast<char*>(&other->exchange_type_));
+      PROTOBUF_FIELD_OFFSET(declareExchangeRequest, _impl_.auto_delete_)
+      + sizeof(declareExchangeRequest::_impl_.auto_delete_)
+      - PROTOBUF_FIELD_OFFSET(declareExchangeRequest, _impl_.exchange_type_)>(
+          reinterpret_cast<char*>(&_impl_.exchange_type_),
+          reinterpret_cast<char*>(&other->_impl_.exchange_type_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata declareExchangeRequest::GetMetadata() const {
@@ -1526,52 +2213,68 @@ class deleteExchangeRequest::_Internal {
 deleteExchangeRequest::deleteExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.deleteExchangeRequest)
 }
 deleteExchangeRequest::deleteExchangeRequest(const deleteExchangeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  deleteExchangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.deleteExchangeRequest)
 }
 
-inline void deleteExchangeRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void deleteExchangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 deleteExchangeRequest::~deleteExchangeRequest() {
@@ -1585,13 +2288,13 @@ deleteExchangeRequest::~deleteExchangeRequest() {
 
 inline void deleteExchangeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.exchange_name_.Destroy();
 }
 
 void deleteExchangeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void deleteExchangeRequest::Clear() {
@@ -1600,9 +2303,9 @@ void deleteExchangeRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1738,38 +2441,34 @@ size_t deleteExchangeRequest::ByteSizeLong() const {
         this->_internal_exchange_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData deleteExchangeRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     deleteExchangeRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*deleteExchangeRequest::GetClassData() const { return &_class_data_; }
 
-void deleteExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<deleteExchangeRequest *>(to)->MergeFrom(
-      static_cast<const deleteExchangeRequest &>(from));
-}
-
 
-void deleteExchangeRequest::MergeFrom(const deleteExchangeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.deleteExchangeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void deleteExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<deleteExchangeRequest*>(&to_msg);
+  auto& from = static_cast<const deleteExchangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.deleteExchangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void deleteExchangeRequest::CopyFrom(const deleteExchangeRequest& from) {
@@ -1789,16 +2488,16 @@ void deleteExchangeRequest::InternalSwap(deleteExchangeRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
 }
 
@@ -1830,9 +2529,8 @@ class declareQueueRequest::_Internal {
 
 declareQueueRequest::declareQueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  args_(arena) {
-  SharedCtor();
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   if (arena != nullptr && !is_message_owned) {
     arena->OwnCustomDestructor(this, &declareQueueRequest::ArenaDtor);
   }
@@ -1840,55 +2538,75 @@ declareQueueRequest::declareQueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
 }
 declareQueueRequest::declareQueueRequest(const declareQueueRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  declareQueueRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.exclusive_){}
+    , decltype(_impl_.durable_){}
+    , decltype(_impl_.auto_delete_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  args_.MergeFrom(from.args_);
-  rid_.InitDefault();
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&exclusive_, &from.exclusive_,
-    static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exclusive_)) + sizeof(auto_delete_));
+  ::memcpy(&_impl_.exclusive_, &from._impl_.exclusive_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_delete_) -
+    reinterpret_cast<char*>(&_impl_.exclusive_)) + sizeof(_impl_.auto_delete_));
   // @@protoc_insertion_point(copy_constructor:hare_mq.declareQueueRequest)
 }
 
-inline void declareQueueRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&exclusive_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exclusive_)) + sizeof(auto_delete_));
+inline void declareQueueRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.exclusive_){false}
+    , decltype(_impl_.durable_){false}
+    , decltype(_impl_.auto_delete_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 declareQueueRequest::~declareQueueRequest() {
@@ -1903,18 +2621,19 @@ declareQueueRequest::~declareQueueRequest() {
 
 inline void declareQueueRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  args_.Destruct();
-  rid_.Destroy();
-  cid_.Destroy();
-  queue_name_.Destroy();
+  _impl_.args_.Destruct();
+  _impl_.args_.~MapField();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
 void declareQueueRequest::ArenaDtor(void* object) {
   declareQueueRequest* _this = reinterpret_cast< declareQueueRequest* >(object);
-  _this->args_.Destruct();
+  _this->_impl_.args_.Destruct();
 }
 void declareQueueRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void declareQueueRequest::Clear() {
@@ -1923,13 +2642,13 @@ void declareQueueRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  args_.Clear();
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  ::memset(&exclusive_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&auto_delete_) -
-      reinterpret_cast<char*>(&exclusive_)) + sizeof(auto_delete_));
+  _impl_.args_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  ::memset(&_impl_.exclusive_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_delete_) -
+      reinterpret_cast<char*>(&_impl_.exclusive_)) + sizeof(_impl_.auto_delete_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1972,7 +2691,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
       // bool exclusive = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          exclusive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.exclusive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1980,7 +2699,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
       // bool durable = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1988,7 +2707,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
       // bool auto_delete = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1999,7 +2718,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&args_, ptr);
+            ptr = ctx->ParseMessage(&_impl_.args_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
@@ -2174,48 +2893,44 @@ size_t declareQueueRequest::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData declareQueueRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     declareQueueRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*declareQueueRequest::GetClassData() const { return &_class_data_; }
 
-void declareQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<declareQueueRequest *>(to)->MergeFrom(
-      static_cast<const declareQueueRequest &>(from));
-}
-
 
-void declareQueueRequest::MergeFrom(const declareQueueRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.declareQueueRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void declareQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<declareQueueRequest*>(&to_msg);
+  auto& from = static_cast<const declareQueueRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.declareQueueRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  args_.MergeFrom(from.args_);
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
   if (from._internal_exclusive() != 0) {
-    _internal_set_exclusive(from._internal_exclusive());
+    _this->_internal_set_exclusive(from._internal_exclusive());
   }
   if (from._internal_durable() != 0) {
-    _internal_set_durable(from._internal_durable());
+    _this->_internal_set_durable(from._internal_durable());
   }
   if (from._internal_auto_delete() != 0) {
-    _internal_set_auto_delete(from._internal_auto_delete());
+    _this->_internal_set_auto_delete(from._internal_auto_delete());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void declareQueueRequest::CopyFrom(const declareQueueRequest& from) {
@@ -2234,25 +2949,25 @@ void declareQueueRequest::InternalSwap(declareQueueRequest* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  args_.InternalSwap(&other->args_);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(declareQueueRequest, auto_delete_)
-      + sizeof(declareQueueRequest::auto_delete_)
-      - PROTOBUF_FIELD_OFFSET(declareQueueRequest, exclusive_)>(
-          reinterpret_cast<char*>(&exclusive_),
-          reinterpret_cast<char*>(&other->exclusive_));
+      PROTOBUF_FIELD_OFFSET(declareQueueRequest, _impl_.auto_delete_)
+      + sizeof(declareQueueRequest::_impl_.auto_delete_)
+      - PROTOBUF_FIELD_OFFSET(declareQueueRequest, _impl_.exclusive_)>(
+          reinterpret_cast<char*>(&_impl_.exclusive_),
+          reinterpret_cast<char*>(&other->_impl_.exclusive_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata declareQueueRequest::GetMetadata() const {
@@ -2270,52 +2985,68 @@ class deleteQueueRequest::_Internal {
 deleteQueueRequest::deleteQueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.deleteQueueRequest)
 }
 deleteQueueRequest::deleteQueueRequest(const deleteQueueRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  deleteQueueRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.deleteQueueRequest)
 }
 
-inline void deleteQueueRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void deleteQueueRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 deleteQueueRequest::~deleteQueueRequest() {
@@ -2329,13 +3060,13 @@ deleteQueueRequest::~deleteQueueRequest() {
 
 inline void deleteQueueRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
 void deleteQueueRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void deleteQueueRequest::Clear() {
@@ -2344,9 +3075,9 @@ void deleteQueueRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2482,38 +3213,34 @@ size_t deleteQueueRequest::ByteSizeLong() const {
         this->_internal_queue_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData deleteQueueRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     deleteQueueRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*deleteQueueRequest::GetClassData() const { return &_class_data_; }
 
-void deleteQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<deleteQueueRequest *>(to)->MergeFrom(
-      static_cast<const deleteQueueRequest &>(from));
-}
-
 
-void deleteQueueRequest::MergeFrom(const deleteQueueRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.deleteQueueRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void deleteQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<deleteQueueRequest*>(&to_msg);
+  auto& from = static_cast<const deleteQueueRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.deleteQueueRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void deleteQueueRequest::CopyFrom(const deleteQueueRequest& from) {
@@ -2533,16 +3260,16 @@ void deleteQueueRequest::InternalSwap(deleteQueueRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
 }
 
@@ -2561,76 +3288,96 @@ class bindRequest::_Internal {
 bindRequest::bindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.bindRequest)
 }
 bindRequest::bindRequest(const bindRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  bindRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  binding_key_.InitDefault();
+  _impl_.binding_key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    binding_key_.Set("", GetArenaForAllocation());
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_binding_key().empty()) {
-    binding_key_.Set(from._internal_binding_key(), 
-      GetArenaForAllocation());
+    _this->_impl_.binding_key_.Set(from._internal_binding_key(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.bindRequest)
 }
 
-inline void bindRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-binding_key_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  binding_key_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void bindRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 bindRequest::~bindRequest() {
@@ -2644,15 +3391,15 @@ bindRequest::~bindRequest() {
 
 inline void bindRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
-  queue_name_.Destroy();
-  binding_key_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.exchange_name_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.binding_key_.Destroy();
 }
 
 void bindRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void bindRequest::Clear() {
@@ -2661,11 +3408,11 @@ void bindRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  binding_key_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.binding_key_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2855,44 +3602,40 @@ size_t bindRequest::ByteSizeLong() const {
         this->_internal_binding_key());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData bindRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     bindRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*bindRequest::GetClassData() const { return &_class_data_; }
 
-void bindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<bindRequest *>(to)->MergeFrom(
-      static_cast<const bindRequest &>(from));
-}
-
 
-void bindRequest::MergeFrom(const bindRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.bindRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void bindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<bindRequest*>(&to_msg);
+  auto& from = static_cast<const bindRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.bindRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
   if (!from._internal_binding_key().empty()) {
-    _internal_set_binding_key(from._internal_binding_key());
+    _this->_internal_set_binding_key(from._internal_binding_key());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void bindRequest::CopyFrom(const bindRequest& from) {
@@ -2912,24 +3655,24 @@ void bindRequest::InternalSwap(bindRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &binding_key_, lhs_arena,
-      &other->binding_key_, rhs_arena
+      &_impl_.binding_key_, lhs_arena,
+      &other->_impl_.binding_key_, rhs_arena
   );
 }
 
@@ -2948,67 +3691,85 @@ class unbindRequest::_Internal {
 unbindRequest::unbindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.unbindRequest)
 }
 unbindRequest::unbindRequest(const unbindRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  unbindRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.unbindRequest)
 }
 
-inline void unbindRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-unbindRequest::~unbindRequest() {
+inline void unbindRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+unbindRequest::~unbindRequest() {
   // @@protoc_insertion_point(destructor:hare_mq.unbindRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
@@ -3019,14 +3780,14 @@ unbindRequest::~unbindRequest() {
 
 inline void unbindRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.exchange_name_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
 void unbindRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void unbindRequest::Clear() {
@@ -3035,10 +3796,10 @@ void unbindRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3201,41 +3962,37 @@ size_t unbindRequest::ByteSizeLong() const {
         this->_internal_queue_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData unbindRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     unbindRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*unbindRequest::GetClassData() const { return &_class_data_; }
 
-void unbindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<unbindRequest *>(to)->MergeFrom(
-      static_cast<const unbindRequest &>(from));
-}
-
 
-void unbindRequest::MergeFrom(const unbindRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.unbindRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void unbindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<unbindRequest*>(&to_msg);
+  auto& from = static_cast<const unbindRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.unbindRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void unbindRequest::CopyFrom(const unbindRequest& from) {
@@ -3255,20 +4012,20 @@ void unbindRequest::InternalSwap(unbindRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
 }
 
@@ -3287,81 +4044,98 @@ class basicPublishRequest::_Internal {
 
 const ::hare_mq::BasicProperties&
 basicPublishRequest::_Internal::properties(const basicPublishRequest* msg) {
-  return *msg->properties_;
+  return *msg->_impl_.properties_;
 }
 void basicPublishRequest::clear_properties() {
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
   }
-  properties_ = nullptr;
+  _impl_.properties_ = nullptr;
 }
 basicPublishRequest::basicPublishRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.basicPublishRequest)
 }
 basicPublishRequest::basicPublishRequest(const basicPublishRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicPublishRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  body_.InitDefault();
+  _impl_.body_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set("", GetArenaForAllocation());
+    _impl_.body_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_body().empty()) {
-    body_.Set(from._internal_body(), 
-      GetArenaForAllocation());
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_properties()) {
-    properties_ = new ::hare_mq::BasicProperties(*from.properties_);
-  } else {
-    properties_ = nullptr;
+    _this->_impl_.properties_ = new ::hare_mq::BasicProperties(*from._impl_.properties_);
   }
   // @@protoc_insertion_point(copy_constructor:hare_mq.basicPublishRequest)
 }
 
-inline void basicPublishRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-body_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-properties_ = nullptr;
+inline void basicPublishRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 basicPublishRequest::~basicPublishRequest() {
@@ -3375,15 +4149,15 @@ basicPublishRequest::~basicPublishRequest() {
 
 inline void basicPublishRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
-  body_.Destroy();
-  if (this != internal_default_instance()) delete properties_;
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.exchange_name_.Destroy();
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
 }
 
 void basicPublishRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void basicPublishRequest::Clear() {
@@ -3392,14 +4166,14 @@ void basicPublishRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  body_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
   }
-  properties_ = nullptr;
+  _impl_.properties_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3581,47 +4355,44 @@ size_t basicPublishRequest::ByteSizeLong() const {
   if (this->_internal_has_properties()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *properties_);
+        *_impl_.properties_);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicPublishRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     basicPublishRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicPublishRequest::GetClassData() const { return &_class_data_; }
 
-void basicPublishRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicPublishRequest *>(to)->MergeFrom(
-      static_cast<const basicPublishRequest &>(from));
-}
-
 
-void basicPublishRequest::MergeFrom(const basicPublishRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicPublishRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicPublishRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicPublishRequest*>(&to_msg);
+  auto& from = static_cast<const basicPublishRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicPublishRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
   if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
+    _this->_internal_set_body(from._internal_body());
   }
   if (from._internal_has_properties()) {
-    _internal_mutable_properties()->::hare_mq::BasicProperties::MergeFrom(from._internal_properties());
+    _this->_internal_mutable_properties()->::hare_mq::BasicProperties::MergeFrom(
+        from._internal_properties());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void basicPublishRequest::CopyFrom(const basicPublishRequest& from) {
@@ -3641,22 +4412,22 @@ void basicPublishRequest::InternalSwap(basicPublishRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
   );
-  swap(properties_, other->properties_);
+  swap(_impl_.properties_, other->_impl_.properties_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata basicPublishRequest::GetMetadata() const {
@@ -3674,64 +4445,89 @@ class basicAckRequest::_Internal {
 basicAckRequest::basicAckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:hare_mq.basicAckRequest)
 }
 basicAckRequest::basicAckRequest(const basicAckRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicAckRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.delivery_tag_){}
+    , decltype(_impl_.multiple_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  message_id_.InitDefault();
+  _impl_.message_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    message_id_.Set("", GetArenaForAllocation());
+    _impl_.message_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_message_id().empty()) {
-    message_id_.Set(from._internal_message_id(), 
-      GetArenaForAllocation());
+    _this->_impl_.message_id_.Set(from._internal_message_id(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.delivery_tag_, &from._impl_.delivery_tag_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.multiple_) -
+    reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.multiple_));
   // @@protoc_insertion_point(copy_constructor:hare_mq.basicAckRequest)
 }
 
-inline void basicAckRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-message_id_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  message_id_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void basicAckRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.delivery_tag_){uint64_t{0u}}
+    , decltype(_impl_.multiple_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 basicAckRequest::~basicAckRequest() {
@@ -3745,14 +4541,14 @@ basicAckRequest::~basicAckRequest() {
 
 inline void basicAckRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  queue_name_.Destroy();
-  message_id_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.message_id_.Destroy();
 }
 
 void basicAckRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void basicAckRequest::Clear() {
@@ -3761,10 +4557,13 @@ void basicAckRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  message_id_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.message_id_.ClearToEmpty();
+  ::memset(&_impl_.delivery_tag_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.multiple_) -
+      reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.multiple_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3814,6 +4613,22 @@ const char* basicAckRequest::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // uint64 delivery_tag = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.delivery_tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiple = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3883,6 +4698,18 @@ uint8_t* basicAckRequest::_InternalSerialize(
         4, this->_internal_message_id(), target);
   }
 
+  // uint64 delivery_tag = 5;
+  if (this->_internal_delivery_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_delivery_tag(), target);
+  }
+
+  // bool multiple = 6;
+  if (this->_internal_multiple() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_multiple(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3927,41 +4754,53 @@ size_t basicAckRequest::ByteSizeLong() const {
         this->_internal_message_id());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint64 delivery_tag = 5;
+  if (this->_internal_delivery_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivery_tag());
+  }
+
+  // bool multiple = 6;
+  if (this->_internal_multiple() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicAckRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     basicAckRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicAckRequest::GetClassData() const { return &_class_data_; }
 
-void basicAckRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicAckRequest *>(to)->MergeFrom(
-      static_cast<const basicAckRequest &>(from));
-}
-
 
-void basicAckRequest::MergeFrom(const basicAckRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicAckRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicAckRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicAckRequest*>(&to_msg);
+  auto& from = static_cast<const basicAckRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicAckRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
   if (!from._internal_message_id().empty()) {
-    _internal_set_message_id(from._internal_message_id());
+    _this->_internal_set_message_id(from._internal_message_id());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_delivery_tag() != 0) {
+    _this->_internal_set_delivery_tag(from._internal_delivery_tag());
+  }
+  if (from._internal_multiple() != 0) {
+    _this->_internal_set_multiple(from._internal_multiple());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void basicAckRequest::CopyFrom(const basicAckRequest& from) {
@@ -3981,21 +4820,27 @@ void basicAckRequest::InternalSwap(basicAckRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &message_id_, lhs_arena,
-      &other->message_id_, rhs_arena
+      &_impl_.message_id_, lhs_arena,
+      &other->_impl_.message_id_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicAckRequest, _impl_.multiple_)
+      + sizeof(basicAckRequest::_impl_.multiple_)
+      - PROTOBUF_FIELD_OFFSET(basicAckRequest, _impl_.delivery_tag_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_tag_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_tag_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata basicAckRequest::GetMetadata() const {
@@ -4006,77 +4851,102 @@ void basicAckRequest::InternalSwap(basicAckRequest* other) {
 
 // ===================================================================
 
-class basicConsumeRequest::_Internal {
+class basicNackRequest::_Internal {
  public:
 };
 
-basicConsumeRequest::basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+basicNackRequest::basicNackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:hare_mq.basicConsumeRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicNackRequest)
 }
-basicConsumeRequest::basicConsumeRequest(const basicConsumeRequest& from)
+basicNackRequest::basicNackRequest(const basicNackRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicNackRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.delivery_tag_){}
+    , decltype(_impl_.requeue_){}
+    , decltype(_impl_.multiple_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  consumer_tag_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    consumer_tag_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_consumer_tag().empty()) {
-    consumer_tag_.Set(from._internal_consumer_tag(), 
-      GetArenaForAllocation());
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.message_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.message_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+  if (!from._internal_message_id().empty()) {
+    _this->_impl_.message_id_.Set(from._internal_message_id(), 
+      _this->GetArenaForAllocation());
   }
-  auto_ack_ = from.auto_ack_;
-  // @@protoc_insertion_point(copy_constructor:hare_mq.basicConsumeRequest)
+  ::memcpy(&_impl_.delivery_tag_, &from._impl_.delivery_tag_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.multiple_) -
+    reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.multiple_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicNackRequest)
 }
 
-inline void basicConsumeRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-consumer_tag_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  consumer_tag_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-auto_ack_ = false;
+inline void basicNackRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.delivery_tag_){uint64_t{0u}}
+    , decltype(_impl_.requeue_){false}
+    , decltype(_impl_.multiple_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicConsumeRequest::~basicConsumeRequest() {
-  // @@protoc_insertion_point(destructor:hare_mq.basicConsumeRequest)
+basicNackRequest::~basicNackRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicNackRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4084,33 +4954,35 @@ basicConsumeRequest::~basicConsumeRequest() {
   SharedDtor();
 }
 
-inline void basicConsumeRequest::SharedDtor() {
+inline void basicNackRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  consumer_tag_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.message_id_.Destroy();
 }
 
-void basicConsumeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicNackRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicConsumeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hare_mq.basicConsumeRequest)
+void basicNackRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicNackRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  consumer_tag_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  auto_ack_ = false;
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.message_id_.ClearToEmpty();
+  ::memset(&_impl_.delivery_tag_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.multiple_) -
+      reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.multiple_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicNackRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4122,7 +4994,7 @@ const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicNackRequest.rid"));
         } else
           goto handle_unusual;
         continue;
@@ -4132,34 +5004,50 @@ const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_cid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.cid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicNackRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string consumer_tag = 3;
+      // string queue_name = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_consumer_tag();
+          auto str = _internal_mutable_queue_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.consumer_tag"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicNackRequest.queue_name"));
         } else
           goto handle_unusual;
         continue;
-      // string queue_name = 4;
+      // string message_id = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_queue_name();
+          auto str = _internal_mutable_message_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.queue_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicNackRequest.message_id"));
         } else
           goto handle_unusual;
         continue;
-      // bool auto_ack = 5;
+      // bool requeue = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          auto_ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.requeue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivery_tag = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.delivery_tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiple = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -4187,9 +5075,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicConsumeRequest::_InternalSerialize(
+uint8_t* basicNackRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicConsumeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicNackRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4198,7 +5086,7 @@ uint8_t* basicConsumeRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeRequest.rid");
+      "hare_mq.basicNackRequest.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
@@ -4208,47 +5096,59 @@ uint8_t* basicConsumeRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeRequest.cid");
+      "hare_mq.basicNackRequest.cid");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_cid(), target);
   }
 
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeRequest.consumer_tag");
+      "hare_mq.basicNackRequest.queue_name");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_consumer_tag(), target);
+        3, this->_internal_queue_name(), target);
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // string message_id = 4;
+  if (!this->_internal_message_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      this->_internal_message_id().data(), static_cast<int>(this->_internal_message_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeRequest.queue_name");
+      "hare_mq.basicNackRequest.message_id");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_queue_name(), target);
+        4, this->_internal_message_id(), target);
   }
 
-  // bool auto_ack = 5;
-  if (this->_internal_auto_ack() != 0) {
+  // bool requeue = 5;
+  if (this->_internal_requeue() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_auto_ack(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_requeue(), target);
+  }
+
+  // uint64 delivery_tag = 6;
+  if (this->_internal_delivery_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_delivery_tag(), target);
+  }
+
+  // bool multiple = 7;
+  if (this->_internal_multiple() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_multiple(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicConsumeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicNackRequest)
   return target;
 }
 
-size_t basicConsumeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicConsumeRequest)
+size_t basicNackRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicNackRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -4269,101 +5169,118 @@ size_t basicConsumeRequest::ByteSizeLong() const {
         this->_internal_cid());
   }
 
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_consumer_tag());
+        this->_internal_queue_name());
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // string message_id = 4;
+  if (!this->_internal_message_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_queue_name());
+        this->_internal_message_id());
   }
 
-  // bool auto_ack = 5;
-  if (this->_internal_auto_ack() != 0) {
+  // uint64 delivery_tag = 6;
+  if (this->_internal_delivery_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivery_tag());
+  }
+
+  // bool requeue = 5;
+  if (this->_internal_requeue() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool multiple = 7;
+  if (this->_internal_multiple() != 0) {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicConsumeRequest::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicNackRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicNackRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeRequest::GetClassData() const { return &_class_data_; }
-
-void basicConsumeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicConsumeRequest *>(to)->MergeFrom(
-      static_cast<const basicConsumeRequest &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicNackRequest::GetClassData() const { return &_class_data_; }
 
 
-void basicConsumeRequest::MergeFrom(const basicConsumeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicConsumeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicNackRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicNackRequest*>(&to_msg);
+  auto& from = static_cast<const basicNackRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicNackRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
-  }
-  if (!from._internal_consumer_tag().empty()) {
-    _internal_set_consumer_tag(from._internal_consumer_tag());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  if (from._internal_auto_ack() != 0) {
-    _internal_set_auto_ack(from._internal_auto_ack());
+  if (!from._internal_message_id().empty()) {
+    _this->_internal_set_message_id(from._internal_message_id());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_delivery_tag() != 0) {
+    _this->_internal_set_delivery_tag(from._internal_delivery_tag());
+  }
+  if (from._internal_requeue() != 0) {
+    _this->_internal_set_requeue(from._internal_requeue());
+  }
+  if (from._internal_multiple() != 0) {
+    _this->_internal_set_multiple(from._internal_multiple());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicConsumeRequest::CopyFrom(const basicConsumeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicConsumeRequest)
+void basicNackRequest::CopyFrom(const basicNackRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicNackRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicConsumeRequest::IsInitialized() const {
+bool basicNackRequest::IsInitialized() const {
   return true;
 }
 
-void basicConsumeRequest::InternalSwap(basicConsumeRequest* other) {
+void basicNackRequest::InternalSwap(basicNackRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &consumer_tag_, lhs_arena,
-      &other->consumer_tag_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.message_id_, lhs_arena,
+      &other->_impl_.message_id_, rhs_arena
   );
-  swap(auto_ack_, other->auto_ack_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicNackRequest, _impl_.multiple_)
+      + sizeof(basicNackRequest::_impl_.multiple_)
+      - PROTOBUF_FIELD_OFFSET(basicNackRequest, _impl_.delivery_tag_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_tag_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_tag_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata basicNackRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
       file_level_metadata_protocol_2eproto[12]);
@@ -4371,75 +5288,100 @@ void basicConsumeRequest::InternalSwap(basicConsumeRequest* other) {
 
 // ===================================================================
 
-class basicCancelRequest::_Internal {
+class basicRejectRequest::_Internal {
  public:
 };
 
-basicCancelRequest::basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+basicRejectRequest::basicRejectRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:hare_mq.basicCancelRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicRejectRequest)
 }
-basicCancelRequest::basicCancelRequest(const basicCancelRequest& from)
+basicRejectRequest::basicRejectRequest(const basicRejectRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicRejectRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.delivery_tag_){}
+    , decltype(_impl_.requeue_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  consumer_tag_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    consumer_tag_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_consumer_tag().empty()) {
-    consumer_tag_.Set(from._internal_consumer_tag(), 
-      GetArenaForAllocation());
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.message_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.message_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+  if (!from._internal_message_id().empty()) {
+    _this->_impl_.message_id_.Set(from._internal_message_id(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:hare_mq.basicCancelRequest)
+  ::memcpy(&_impl_.delivery_tag_, &from._impl_.delivery_tag_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requeue_) -
+    reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.requeue_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicRejectRequest)
 }
 
-inline void basicCancelRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-consumer_tag_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  consumer_tag_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void basicRejectRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.delivery_tag_){uint64_t{0u}}
+    , decltype(_impl_.requeue_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicCancelRequest::~basicCancelRequest() {
-  // @@protoc_insertion_point(destructor:hare_mq.basicCancelRequest)
+basicRejectRequest::~basicRejectRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicRejectRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4447,32 +5389,35 @@ basicCancelRequest::~basicCancelRequest() {
   SharedDtor();
 }
 
-inline void basicCancelRequest::SharedDtor() {
+inline void basicRejectRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  consumer_tag_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.message_id_.Destroy();
 }
 
-void basicCancelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicRejectRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicCancelRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hare_mq.basicCancelRequest)
+void basicRejectRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicRejectRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  consumer_tag_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.message_id_.ClearToEmpty();
+  ::memset(&_impl_.delivery_tag_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requeue_) -
+      reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.requeue_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicRejectRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4484,7 +5429,7 @@ const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicRejectRequest.rid"));
         } else
           goto handle_unusual;
         continue;
@@ -4494,27 +5439,43 @@ const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
           auto str = _internal_mutable_cid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.cid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicRejectRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string consumer_tag = 3;
+      // string queue_name = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_consumer_tag();
+          auto str = _internal_mutable_queue_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.consumer_tag"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicRejectRequest.queue_name"));
         } else
           goto handle_unusual;
         continue;
-      // string queue_name = 4;
+      // string message_id = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_queue_name();
+          auto str = _internal_mutable_message_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.queue_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicRejectRequest.message_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool requeue = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.requeue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivery_tag = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.delivery_tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -4541,9 +5502,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicCancelRequest::_InternalSerialize(
+uint8_t* basicRejectRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicCancelRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicRejectRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4552,7 +5513,7 @@ uint8_t* basicCancelRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicCancelRequest.rid");
+      "hare_mq.basicRejectRequest.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
@@ -4562,41 +5523,53 @@ uint8_t* basicCancelRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicCancelRequest.cid");
+      "hare_mq.basicRejectRequest.cid");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_cid(), target);
   }
 
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicCancelRequest.consumer_tag");
+      "hare_mq.basicRejectRequest.queue_name");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_consumer_tag(), target);
+        3, this->_internal_queue_name(), target);
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // string message_id = 4;
+  if (!this->_internal_message_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      this->_internal_message_id().data(), static_cast<int>(this->_internal_message_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicCancelRequest.queue_name");
+      "hare_mq.basicRejectRequest.message_id");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_queue_name(), target);
+        4, this->_internal_message_id(), target);
+  }
+
+  // bool requeue = 5;
+  if (this->_internal_requeue() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_requeue(), target);
+  }
+
+  // uint64 delivery_tag = 6;
+  if (this->_internal_delivery_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_delivery_tag(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicCancelRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicRejectRequest)
   return target;
 }
 
-size_t basicCancelRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicCancelRequest)
+size_t basicRejectRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicRejectRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -4617,92 +5590,110 @@ size_t basicCancelRequest::ByteSizeLong() const {
         this->_internal_cid());
   }
 
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_consumer_tag());
+        this->_internal_queue_name());
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // string message_id = 4;
+  if (!this->_internal_message_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_queue_name());
+        this->_internal_message_id());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
+  // uint64 delivery_tag = 6;
+  if (this->_internal_delivery_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivery_tag());
+  }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCancelRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicCancelRequest::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCancelRequest::GetClassData() const { return &_class_data_; }
+  // bool requeue = 5;
+  if (this->_internal_requeue() != 0) {
+    total_size += 1 + 1;
+  }
 
-void basicCancelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicCancelRequest *>(to)->MergeFrom(
-      static_cast<const basicCancelRequest &>(from));
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicRejectRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicRejectRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicRejectRequest::GetClassData() const { return &_class_data_; }
+
 
-void basicCancelRequest::MergeFrom(const basicCancelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicCancelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicRejectRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicRejectRequest*>(&to_msg);
+  auto& from = static_cast<const basicRejectRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicRejectRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
-  }
-  if (!from._internal_consumer_tag().empty()) {
-    _internal_set_consumer_tag(from._internal_consumer_tag());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (!from._internal_message_id().empty()) {
+    _this->_internal_set_message_id(from._internal_message_id());
+  }
+  if (from._internal_delivery_tag() != 0) {
+    _this->_internal_set_delivery_tag(from._internal_delivery_tag());
+  }
+  if (from._internal_requeue() != 0) {
+    _this->_internal_set_requeue(from._internal_requeue());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicCancelRequest::CopyFrom(const basicCancelRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicCancelRequest)
+void basicRejectRequest::CopyFrom(const basicRejectRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicRejectRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicCancelRequest::IsInitialized() const {
+bool basicRejectRequest::IsInitialized() const {
   return true;
 }
 
-void basicCancelRequest::InternalSwap(basicCancelRequest* other) {
+void basicRejectRequest::InternalSwap(basicRejectRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &consumer_tag_, lhs_arena,
-      &other->consumer_tag_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.message_id_, lhs_arena,
+      &other->_impl_.message_id_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicRejectRequest, _impl_.requeue_)
+      + sizeof(basicRejectRequest::_impl_.requeue_)
+      - PROTOBUF_FIELD_OFFSET(basicRejectRequest, _impl_.delivery_tag_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_tag_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_tag_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicCancelRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata basicRejectRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
       file_level_metadata_protocol_2eproto[13]);
@@ -4710,80 +5701,96 @@ void basicCancelRequest::InternalSwap(basicCancelRequest* other) {
 
 // ===================================================================
 
-class basicConsumeResponse::_Internal {
+class basicConsumeRequest::_Internal {
  public:
-  static const ::hare_mq::BasicProperties& properties(const basicConsumeResponse* msg);
 };
 
-const ::hare_mq::BasicProperties&
-basicConsumeResponse::_Internal::properties(const basicConsumeResponse* msg) {
-  return *msg->properties_;
-}
-void basicConsumeResponse::clear_properties() {
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
-  }
-  properties_ = nullptr;
-}
-basicConsumeResponse::basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+basicConsumeRequest::basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:hare_mq.basicConsumeResponse)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicConsumeRequest)
 }
-basicConsumeResponse::basicConsumeResponse(const basicConsumeResponse& from)
+basicConsumeRequest::basicConsumeRequest(const basicConsumeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConsumeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.auto_ack_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  cid_.InitDefault();
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  consumer_tag_.InitDefault();
+  _impl_.consumer_tag_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    consumer_tag_.Set("", GetArenaForAllocation());
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_consumer_tag().empty()) {
-    consumer_tag_.Set(from._internal_consumer_tag(), 
-      GetArenaForAllocation());
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
   }
-  body_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_body().empty()) {
-    body_.Set(from._internal_body(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_properties()) {
-    properties_ = new ::hare_mq::BasicProperties(*from.properties_);
-  } else {
-    properties_ = nullptr;
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:hare_mq.basicConsumeResponse)
+  _this->_impl_.auto_ack_ = from._impl_.auto_ack_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicConsumeRequest)
 }
 
-inline void basicConsumeResponse::SharedCtor() {
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-consumer_tag_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  consumer_tag_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-body_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-properties_ = nullptr;
+inline void basicConsumeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.auto_ack_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicConsumeResponse::~basicConsumeResponse() {
-  // @@protoc_insertion_point(destructor:hare_mq.basicConsumeResponse)
+basicConsumeRequest::~basicConsumeRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicConsumeRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4791,74 +5798,82 @@ basicConsumeResponse::~basicConsumeResponse() {
   SharedDtor();
 }
 
-inline void basicConsumeResponse::SharedDtor() {
+inline void basicConsumeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  cid_.Destroy();
-  consumer_tag_.Destroy();
-  body_.Destroy();
-  if (this != internal_default_instance()) delete properties_;
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.consumer_tag_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
-void basicConsumeResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicConsumeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicConsumeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:hare_mq.basicConsumeResponse)
+void basicConsumeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicConsumeRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cid_.ClearToEmpty();
-  consumer_tag_.ClearToEmpty();
-  body_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
-  }
-  properties_ = nullptr;
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.auto_ack_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicConsumeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string cid = 1;
+      // string rid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_cid();
+          auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeResponse.cid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.rid"));
         } else
           goto handle_unusual;
         continue;
-      // string consumer_tag = 2;
+      // string cid = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_consumer_tag();
+          auto str = _internal_mutable_cid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeResponse.consumer_tag"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string body = 3;
+      // string consumer_tag = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_body();
+          auto str = _internal_mutable_consumer_tag();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeResponse.body"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.consumer_tag"));
         } else
           goto handle_unusual;
         continue;
-      // .hare_mq.BasicProperties properties = 4;
+      // string queue_name = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeRequest.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_ack = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.auto_ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -4886,162 +5901,179 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicConsumeResponse::_InternalSerialize(
+uint8_t* basicConsumeRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicConsumeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicConsumeRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string cid = 1;
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicConsumeRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
   if (!this->_internal_cid().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeResponse.cid");
+      "hare_mq.basicConsumeRequest.cid");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_cid(), target);
+        2, this->_internal_cid(), target);
   }
 
-  // string consumer_tag = 2;
+  // string consumer_tag = 3;
   if (!this->_internal_consumer_tag().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeResponse.consumer_tag");
+      "hare_mq.basicConsumeRequest.consumer_tag");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_consumer_tag(), target);
+        3, this->_internal_consumer_tag(), target);
   }
 
-  // string body = 3;
-  if (!this->_internal_body().empty()) {
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicConsumeResponse.body");
+      "hare_mq.basicConsumeRequest.queue_name");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_body(), target);
+        4, this->_internal_queue_name(), target);
   }
 
-  // .hare_mq.BasicProperties properties = 4;
-  if (this->_internal_has_properties()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::properties(this),
-        _Internal::properties(this).GetCachedSize(), target, stream);
+  // bool auto_ack = 5;
+  if (this->_internal_auto_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_auto_ack(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicConsumeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicConsumeRequest)
   return target;
 }
 
-size_t basicConsumeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicConsumeResponse)
+size_t basicConsumeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicConsumeRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string cid = 1;
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
   if (!this->_internal_cid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_cid());
   }
 
-  // string consumer_tag = 2;
+  // string consumer_tag = 3;
   if (!this->_internal_consumer_tag().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_consumer_tag());
   }
 
-  // string body = 3;
-  if (!this->_internal_body().empty()) {
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_body());
+        this->_internal_queue_name());
   }
 
-  // .hare_mq.BasicProperties properties = 4;
-  if (this->_internal_has_properties()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *properties_);
+  // bool auto_ack = 5;
+  if (this->_internal_auto_ack() != 0) {
+    total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicConsumeResponse::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConsumeRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeResponse::GetClassData() const { return &_class_data_; }
-
-void basicConsumeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicConsumeResponse *>(to)->MergeFrom(
-      static_cast<const basicConsumeResponse &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeRequest::GetClassData() const { return &_class_data_; }
 
 
-void basicConsumeResponse::MergeFrom(const basicConsumeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicConsumeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicConsumeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConsumeRequest*>(&to_msg);
+  auto& from = static_cast<const basicConsumeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicConsumeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (!from._internal_consumer_tag().empty()) {
-    _internal_set_consumer_tag(from._internal_consumer_tag());
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
   }
-  if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  if (from._internal_has_properties()) {
-    _internal_mutable_properties()->::hare_mq::BasicProperties::MergeFrom(from._internal_properties());
+  if (from._internal_auto_ack() != 0) {
+    _this->_internal_set_auto_ack(from._internal_auto_ack());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicConsumeResponse::CopyFrom(const basicConsumeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicConsumeResponse)
+void basicConsumeRequest::CopyFrom(const basicConsumeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicConsumeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicConsumeResponse::IsInitialized() const {
+bool basicConsumeRequest::IsInitialized() const {
   return true;
 }
 
-void basicConsumeResponse::InternalSwap(basicConsumeResponse* other) {
+void basicConsumeRequest::InternalSwap(basicConsumeRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &consumer_tag_, lhs_arena,
-      &other->consumer_tag_, rhs_arena
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
-  swap(properties_, other->properties_);
+  swap(_impl_.auto_ack_, other->_impl_.auto_ack_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
       file_level_metadata_protocol_2eproto[14]);
@@ -5049,83 +6081,126 @@ void basicConsumeResponse::InternalSwap(basicConsumeResponse* other) {
 
 // ===================================================================
 
-class basicCommonResponse::_Internal {
+class basicCancelRequest::_Internal {
  public:
 };
 
-basicCommonResponse::basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+basicCancelRequest::basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:hare_mq.basicCommonResponse)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicCancelRequest)
 }
-basicCommonResponse::basicCommonResponse(const basicCommonResponse& from)
+basicCancelRequest::basicCancelRequest(const basicCancelRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicCancelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  ok_ = from.ok_;
-  // @@protoc_insertion_point(copy_constructor:hare_mq.basicCommonResponse)
-}
-
-inline void basicCommonResponse::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-ok_ = false;
-}
-
-basicCommonResponse::~basicCommonResponse() {
-  // @@protoc_insertion_point(destructor:hare_mq.basicCommonResponse)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicCancelRequest)
+}
+
+inline void basicCancelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicCancelRequest::~basicCancelRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicCancelRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
   SharedDtor();
 }
 
-inline void basicCommonResponse::SharedDtor() {
+inline void basicCancelRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.consumer_tag_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
-void basicCommonResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicCancelRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicCommonResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:hare_mq.basicCommonResponse)
+void basicCancelRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicCancelRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  ok_ = false;
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicCommonResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5137,7 +6212,7 @@ const char* basicCommonResponse::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCommonResponse.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.rid"));
         } else
           goto handle_unusual;
         continue;
@@ -5147,15 +6222,27 @@ const char* basicCommonResponse::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_cid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCommonResponse.cid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // bool ok = 3;
+      // string consumer_tag = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_consumer_tag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.consumer_tag"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string queue_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCancelRequest.queue_name"));
         } else
           goto handle_unusual;
         continue;
@@ -5182,9 +6269,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicCommonResponse::_InternalSerialize(
+uint8_t* basicCancelRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicCommonResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicCancelRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5193,7 +6280,7 @@ uint8_t* basicCommonResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicCommonResponse.rid");
+      "hare_mq.basicCancelRequest.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
@@ -5203,27 +6290,41 @@ uint8_t* basicCommonResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicCommonResponse.cid");
+      "hare_mq.basicCancelRequest.cid");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_cid(), target);
   }
 
-  // bool ok = 3;
-  if (this->_internal_ok() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ok(), target);
+  // string consumer_tag = 3;
+  if (!this->_internal_consumer_tag().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicCancelRequest.consumer_tag");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_consumer_tag(), target);
+  }
+
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicCancelRequest.queue_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_queue_name(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicCommonResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicCancelRequest)
   return target;
 }
 
-size_t basicCommonResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicCommonResponse)
+size_t basicCancelRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicCancelRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -5244,73 +6345,88 @@ size_t basicCommonResponse::ByteSizeLong() const {
         this->_internal_cid());
   }
 
-  // bool ok = 3;
-  if (this->_internal_ok() != 0) {
-    total_size += 1 + 1;
+  // string consumer_tag = 3;
+  if (!this->_internal_consumer_tag().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_consumer_tag());
+  }
+
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCommonResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicCommonResponse::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCancelRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicCancelRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCommonResponse::GetClassData() const { return &_class_data_; }
-
-void basicCommonResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicCommonResponse *>(to)->MergeFrom(
-      static_cast<const basicCommonResponse &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCancelRequest::GetClassData() const { return &_class_data_; }
 
 
-void basicCommonResponse::MergeFrom(const basicCommonResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicCommonResponse)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicCancelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicCancelRequest*>(&to_msg);
+  auto& from = static_cast<const basicCancelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicCancelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
-  if (from._internal_ok() != 0) {
-    _internal_set_ok(from._internal_ok());
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicCommonResponse::CopyFrom(const basicCommonResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicCommonResponse)
+void basicCancelRequest::CopyFrom(const basicCancelRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicCancelRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicCommonResponse::IsInitialized() const {
+bool basicCancelRequest::IsInitialized() const {
   return true;
 }
 
-void basicCommonResponse::InternalSwap(basicCommonResponse* other) {
+void basicCancelRequest::InternalSwap(basicCancelRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
-  swap(ok_, other->ok_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicCommonResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata basicCancelRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
       file_level_metadata_protocol_2eproto[15]);
@@ -5318,51 +6434,98 @@ void basicCommonResponse::InternalSwap(basicCommonResponse* other) {
 
 // ===================================================================
 
-class basicQueryRequest::_Internal {
+class basicConsumeResponse::_Internal {
  public:
+  static const ::hare_mq::BasicProperties& properties(const basicConsumeResponse* msg);
 };
 
-basicQueryRequest::basicQueryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::hare_mq::BasicProperties&
+basicConsumeResponse::_Internal::properties(const basicConsumeResponse* msg) {
+  return *msg->_impl_.properties_;
+}
+void basicConsumeResponse::clear_properties() {
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+}
+basicConsumeResponse::basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:hare_mq.basicQueryRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicConsumeResponse)
 }
-basicQueryRequest::basicQueryRequest(const basicQueryRequest& from)
+basicConsumeResponse::basicConsumeResponse(const basicConsumeResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConsumeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , decltype(_impl_.delivery_tag_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.consumer_tag_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:hare_mq.basicQueryRequest)
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_properties()) {
+    _this->_impl_.properties_ = new ::hare_mq::BasicProperties(*from._impl_.properties_);
+  }
+  _this->_impl_.delivery_tag_ = from._impl_.delivery_tag_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicConsumeResponse)
 }
 
-inline void basicQueryRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void basicConsumeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , decltype(_impl_.delivery_tag_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicQueryRequest::~basicQueryRequest() {
-  // @@protoc_insertion_point(destructor:hare_mq.basicQueryRequest)
+basicConsumeResponse::~basicConsumeResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicConsumeResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5370,50 +6533,5812 @@ basicQueryRequest::~basicQueryRequest() {
   SharedDtor();
 }
 
-inline void basicQueryRequest::SharedDtor() {
+inline void basicConsumeResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.consumer_tag_.Destroy();
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
 }
 
-void basicQueryRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicConsumeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicQueryRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hare_mq.basicQueryRequest)
+void basicConsumeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicConsumeResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+  _impl_.delivery_tag_ = uint64_t{0u};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicQueryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicConsumeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string rid = 1;
+      // string cid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeResponse.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string consumer_tag = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_consumer_tag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeResponse.consumer_tag"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string body = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicConsumeResponse.body"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .hare_mq.BasicProperties properties = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivery_tag = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.delivery_tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicConsumeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicConsumeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string cid = 1;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicConsumeResponse.cid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_cid(), target);
+  }
+
+  // string consumer_tag = 2;
+  if (!this->_internal_consumer_tag().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicConsumeResponse.consumer_tag");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_consumer_tag(), target);
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicConsumeResponse.body");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_body(), target);
+  }
+
+  // .hare_mq.BasicProperties properties = 4;
+  if (this->_internal_has_properties()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::properties(this),
+        _Internal::properties(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 delivery_tag = 5;
+  if (this->_internal_delivery_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_delivery_tag(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicConsumeResponse)
+  return target;
+}
+
+size_t basicConsumeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicConsumeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string cid = 1;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // string consumer_tag = 2;
+  if (!this->_internal_consumer_tag().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_consumer_tag());
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_body());
+  }
+
+  // .hare_mq.BasicProperties properties = 4;
+  if (this->_internal_has_properties()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.properties_);
+  }
+
+  // uint64 delivery_tag = 5;
+  if (this->_internal_delivery_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivery_tag());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConsumeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeResponse::GetClassData() const { return &_class_data_; }
+
+
+void basicConsumeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConsumeResponse*>(&to_msg);
+  auto& from = static_cast<const basicConsumeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicConsumeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
+  }
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
+  }
+  if (from._internal_has_properties()) {
+    _this->_internal_mutable_properties()->::hare_mq::BasicProperties::MergeFrom(
+        from._internal_properties());
+  }
+  if (from._internal_delivery_tag() != 0) {
+    _this->_internal_set_delivery_tag(from._internal_delivery_tag());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicConsumeResponse::CopyFrom(const basicConsumeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicConsumeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicConsumeResponse::IsInitialized() const {
+  return true;
+}
+
+void basicConsumeResponse::InternalSwap(basicConsumeResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicConsumeResponse, _impl_.delivery_tag_)
+      + sizeof(basicConsumeResponse::_impl_.delivery_tag_)
+      - PROTOBUF_FIELD_OFFSET(basicConsumeResponse, _impl_.properties_)>(
+          reinterpret_cast<char*>(&_impl_.properties_),
+          reinterpret_cast<char*>(&other->_impl_.properties_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[16]);
+}
+
+// ===================================================================
+
+class basicGetRequest::_Internal {
+ public:
+};
+
+basicGetRequest::basicGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicGetRequest)
+}
+basicGetRequest::basicGetRequest(const basicGetRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicGetRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.max_bytes_){}
+    , decltype(_impl_.max_count_){}
+    , decltype(_impl_.auto_ack_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.max_bytes_, &from._impl_.max_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_ack_) -
+    reinterpret_cast<char*>(&_impl_.max_bytes_)) + sizeof(_impl_.auto_ack_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicGetRequest)
+}
+
+inline void basicGetRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.max_bytes_){uint64_t{0u}}
+    , decltype(_impl_.max_count_){0u}
+    , decltype(_impl_.auto_ack_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicGetRequest::~basicGetRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicGetRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicGetRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.queue_name_.Destroy();
+}
+
+void basicGetRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicGetRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicGetRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  ::memset(&_impl_.max_bytes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_ack_) -
+      reinterpret_cast<char*>(&_impl_.max_bytes_)) + sizeof(_impl_.auto_ack_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicGetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicGetRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicGetRequest.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string queue_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicGetRequest.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.max_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_ack = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.auto_ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicGetRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicGetRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicGetRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicGetRequest.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicGetRequest.queue_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_queue_name(), target);
+  }
+
+  // uint32 max_count = 4;
+  if (this->_internal_max_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_max_count(), target);
+  }
+
+  // uint64 max_bytes = 5;
+  if (this->_internal_max_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_max_bytes(), target);
+  }
+
+  // bool auto_ack = 6;
+  if (this->_internal_auto_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_auto_ack(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicGetRequest)
+  return target;
+}
+
+size_t basicGetRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicGetRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue_name());
+  }
+
+  // uint64 max_bytes = 5;
+  if (this->_internal_max_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_bytes());
+  }
+
+  // uint32 max_count = 4;
+  if (this->_internal_max_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_count());
+  }
+
+  // bool auto_ack = 6;
+  if (this->_internal_auto_ack() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicGetRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicGetRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicGetRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicGetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicGetRequest*>(&to_msg);
+  auto& from = static_cast<const basicGetRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicGetRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  if (from._internal_max_bytes() != 0) {
+    _this->_internal_set_max_bytes(from._internal_max_bytes());
+  }
+  if (from._internal_max_count() != 0) {
+    _this->_internal_set_max_count(from._internal_max_count());
+  }
+  if (from._internal_auto_ack() != 0) {
+    _this->_internal_set_auto_ack(from._internal_auto_ack());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicGetRequest::CopyFrom(const basicGetRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicGetRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicGetRequest::IsInitialized() const {
+  return true;
+}
+
+void basicGetRequest::InternalSwap(basicGetRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicGetRequest, _impl_.auto_ack_)
+      + sizeof(basicGetRequest::_impl_.auto_ack_)
+      - PROTOBUF_FIELD_OFFSET(basicGetRequest, _impl_.max_bytes_)>(
+          reinterpret_cast<char*>(&_impl_.max_bytes_),
+          reinterpret_cast<char*>(&other->_impl_.max_bytes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicGetRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[17]);
+}
+
+// ===================================================================
+
+class basicGetResponse::_Internal {
+ public:
+};
+
+basicGetResponse::basicGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicGetResponse)
+}
+basicGetResponse::basicGetResponse(const basicGetResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicGetResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.ok_ = from._impl_.ok_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicGetResponse)
+}
+
+inline void basicGetResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicGetResponse::~basicGetResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicGetResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicGetResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+}
+
+void basicGetResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicGetResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicGetResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.ok_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicGetResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicGetResponse.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicGetResponse.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ok = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.basicConsumeResponse messages = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicGetResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicGetResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicGetResponse.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicGetResponse.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ok(), target);
+  }
+
+  // repeated .hare_mq.basicConsumeResponse messages = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicGetResponse)
+  return target;
+}
+
+size_t basicGetResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicGetResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hare_mq.basicConsumeResponse messages = 4;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicGetResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicGetResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicGetResponse::GetClassData() const { return &_class_data_; }
+
+
+void basicGetResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicGetResponse*>(&to_msg);
+  auto& from = static_cast<const basicGetResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicGetResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_internal_set_ok(from._internal_ok());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicGetResponse::CopyFrom(const basicGetResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicGetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicGetResponse::IsInitialized() const {
+  return true;
+}
+
+void basicGetResponse::InternalSwap(basicGetResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  swap(_impl_.ok_, other->_impl_.ok_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicGetResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[18]);
+}
+
+// ===================================================================
+
+class basicCommonResponse::_Internal {
+ public:
+};
+
+basicCommonResponse::basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicCommonResponse)
+}
+basicCommonResponse::basicCommonResponse(const basicCommonResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicCommonResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.ok_ = from._impl_.ok_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicCommonResponse)
+}
+
+inline void basicCommonResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicCommonResponse::~basicCommonResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicCommonResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicCommonResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+}
+
+void basicCommonResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicCommonResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicCommonResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.ok_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicCommonResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCommonResponse.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicCommonResponse.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ok = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicCommonResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicCommonResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicCommonResponse.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicCommonResponse.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ok(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicCommonResponse)
+  return target;
+}
+
+size_t basicCommonResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicCommonResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCommonResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicCommonResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCommonResponse::GetClassData() const { return &_class_data_; }
+
+
+void basicCommonResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicCommonResponse*>(&to_msg);
+  auto& from = static_cast<const basicCommonResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicCommonResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_internal_set_ok(from._internal_ok());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicCommonResponse::CopyFrom(const basicCommonResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicCommonResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicCommonResponse::IsInitialized() const {
+  return true;
+}
+
+void basicCommonResponse::InternalSwap(basicCommonResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  swap(_impl_.ok_, other->_impl_.ok_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicCommonResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[19]);
+}
+
+// ===================================================================
+
+class basicQueryRequest::_Internal {
+ public:
+};
+
+basicQueryRequest::basicQueryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicQueryRequest)
+}
+basicQueryRequest::basicQueryRequest(const basicQueryRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicQueryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicQueryRequest)
+}
+
+inline void basicQueryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicQueryRequest::~basicQueryRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicQueryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicQueryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+}
+
+void basicQueryRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicQueryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicQueryRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicQueryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryRequest.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicQueryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicQueryRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicQueryRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicQueryRequest.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicQueryRequest)
+  return target;
+}
+
+size_t basicQueryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicQueryRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicQueryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicQueryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicQueryRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicQueryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicQueryRequest*>(&to_msg);
+  auto& from = static_cast<const basicQueryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicQueryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicQueryRequest::CopyFrom(const basicQueryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicQueryRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicQueryRequest::IsInitialized() const {
+  return true;
+}
+
+void basicQueryRequest::InternalSwap(basicQueryRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicQueryRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[20]);
+}
+
+// ===================================================================
+
+class basicQueryResponse::_Internal {
+ public:
+};
+
+basicQueryResponse::basicQueryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.basicQueryResponse)
+}
+basicQueryResponse::basicQueryResponse(const basicQueryResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicQueryResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.body_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:hare_mq.basicQueryResponse)
+}
+
+inline void basicQueryResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.body_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicQueryResponse::~basicQueryResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.basicQueryResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicQueryResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.body_.Destroy();
+}
+
+void basicQueryResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicQueryResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.basicQueryResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicQueryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryResponse.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryResponse.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string body = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryResponse.body"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicQueryResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicQueryResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicQueryResponse.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicQueryResponse.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.basicQueryResponse.body");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_body(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicQueryResponse)
+  return target;
+}
+
+size_t basicQueryResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicQueryResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_body());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicQueryResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicQueryResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicQueryResponse::GetClassData() const { return &_class_data_; }
+
+
+void basicQueryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicQueryResponse*>(&to_msg);
+  auto& from = static_cast<const basicQueryResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicQueryResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicQueryResponse::CopyFrom(const basicQueryResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicQueryResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicQueryResponse::IsInitialized() const {
+  return true;
+}
+
+void basicQueryResponse::InternalSwap(basicQueryResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicQueryResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[21]);
+}
+
+// ===================================================================
+
+class heartbeatRequest::_Internal {
+ public:
+};
+
+heartbeatRequest::heartbeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.heartbeatRequest)
+}
+heartbeatRequest::heartbeatRequest(const heartbeatRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  heartbeatRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.interval_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.interval_ = from._impl_.interval_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.heartbeatRequest)
+}
+
+inline void heartbeatRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.interval_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+heartbeatRequest::~heartbeatRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.heartbeatRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void heartbeatRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+}
+
+void heartbeatRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void heartbeatRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.heartbeatRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.interval_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* heartbeatRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.heartbeatRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 interval = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* heartbeatRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.heartbeatRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.heartbeatRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 interval = 2;
+  if (this->_internal_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_interval(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.heartbeatRequest)
+  return target;
+}
+
+size_t heartbeatRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.heartbeatRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // uint32 interval = 2;
+  if (this->_internal_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_interval());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData heartbeatRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    heartbeatRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*heartbeatRequest::GetClassData() const { return &_class_data_; }
+
+
+void heartbeatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<heartbeatRequest*>(&to_msg);
+  auto& from = static_cast<const heartbeatRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.heartbeatRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (from._internal_interval() != 0) {
+    _this->_internal_set_interval(from._internal_interval());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void heartbeatRequest::CopyFrom(const heartbeatRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.heartbeatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool heartbeatRequest::IsInitialized() const {
+  return true;
+}
+
+void heartbeatRequest::InternalSwap(heartbeatRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  swap(_impl_.interval_, other->_impl_.interval_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata heartbeatRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[22]);
+}
+
+// ===================================================================
+
+class heartbeatResponse::_Internal {
+ public:
+};
+
+heartbeatResponse::heartbeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.heartbeatResponse)
+}
+heartbeatResponse::heartbeatResponse(const heartbeatResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  heartbeatResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.interval_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.interval_ = from._impl_.interval_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.heartbeatResponse)
+}
+
+inline void heartbeatResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.interval_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+heartbeatResponse::~heartbeatResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.heartbeatResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void heartbeatResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+}
+
+void heartbeatResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void heartbeatResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.heartbeatResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.interval_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* heartbeatResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.heartbeatResponse.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 interval = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* heartbeatResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.heartbeatResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.heartbeatResponse.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 interval = 2;
+  if (this->_internal_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_interval(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.heartbeatResponse)
+  return target;
+}
+
+size_t heartbeatResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.heartbeatResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // uint32 interval = 2;
+  if (this->_internal_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_interval());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData heartbeatResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    heartbeatResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*heartbeatResponse::GetClassData() const { return &_class_data_; }
+
+
+void heartbeatResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<heartbeatResponse*>(&to_msg);
+  auto& from = static_cast<const heartbeatResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.heartbeatResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (from._internal_interval() != 0) {
+    _this->_internal_set_interval(from._internal_interval());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void heartbeatResponse::CopyFrom(const heartbeatResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.heartbeatResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool heartbeatResponse::IsInitialized() const {
+  return true;
+}
+
+void heartbeatResponse::InternalSwap(heartbeatResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  swap(_impl_.interval_, other->_impl_.interval_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata heartbeatResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[23]);
+}
+
+// ===================================================================
+
+class heartbeat::_Internal {
+ public:
+};
+
+heartbeat::heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.heartbeat)
+}
+heartbeat::heartbeat(const heartbeat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  heartbeat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.heartbeat)
+}
+
+inline void heartbeat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+heartbeat::~heartbeat() {
+  // @@protoc_insertion_point(destructor:hare_mq.heartbeat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void heartbeat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void heartbeat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void heartbeat::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.heartbeat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.timestamp_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* heartbeat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* heartbeat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.heartbeat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.heartbeat)
+  return target;
+}
+
+size_t heartbeat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.heartbeat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData heartbeat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    heartbeat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*heartbeat::GetClassData() const { return &_class_data_; }
+
+
+void heartbeat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<heartbeat*>(&to_msg);
+  auto& from = static_cast<const heartbeat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.heartbeat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void heartbeat::CopyFrom(const heartbeat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.heartbeat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool heartbeat::IsInitialized() const {
+  return true;
+}
+
+void heartbeat::InternalSwap(heartbeat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.timestamp_, other->_impl_.timestamp_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata heartbeat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[24]);
+}
+
+// ===================================================================
+
+class metricsRequest::_Internal {
+ public:
+};
+
+metricsRequest::metricsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.metricsRequest)
+}
+metricsRequest::metricsRequest(const metricsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  metricsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.prometheus_text_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.prometheus_text_ = from._impl_.prometheus_text_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.metricsRequest)
+}
+
+inline void metricsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.prometheus_text_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+metricsRequest::~metricsRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.metricsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void metricsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+}
+
+void metricsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void metricsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.metricsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.prometheus_text_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* metricsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricsRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricsRequest.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool prometheus_text = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prometheus_text_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* metricsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.metricsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricsRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricsRequest.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // bool prometheus_text = 3;
+  if (this->_internal_prometheus_text() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_prometheus_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.metricsRequest)
+  return target;
+}
+
+size_t metricsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.metricsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // bool prometheus_text = 3;
+  if (this->_internal_prometheus_text() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData metricsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    metricsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*metricsRequest::GetClassData() const { return &_class_data_; }
+
+
+void metricsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<metricsRequest*>(&to_msg);
+  auto& from = static_cast<const metricsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.metricsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_prometheus_text() != 0) {
+    _this->_internal_set_prometheus_text(from._internal_prometheus_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void metricsRequest::CopyFrom(const metricsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.metricsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool metricsRequest::IsInitialized() const {
+  return true;
+}
+
+void metricsRequest::InternalSwap(metricsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  swap(_impl_.prometheus_text_, other->_impl_.prometheus_text_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata metricsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[25]);
+}
+
+// ===================================================================
+
+class metricCounter::_Internal {
+ public:
+};
+
+metricCounter::metricCounter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.metricCounter)
+}
+metricCounter::metricCounter(const metricCounter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  metricCounter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.value_ = from._impl_.value_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.metricCounter)
+}
+
+inline void metricCounter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+metricCounter::~metricCounter() {
+  // @@protoc_insertion_point(destructor:hare_mq.metricCounter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void metricCounter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void metricCounter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void metricCounter::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.metricCounter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.value_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* metricCounter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricCounter.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* metricCounter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.metricCounter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricCounter.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 value = 2;
+  if (this->_internal_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.metricCounter)
+  return target;
+}
+
+size_t metricCounter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.metricCounter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 value = 2;
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData metricCounter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    metricCounter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*metricCounter::GetClassData() const { return &_class_data_; }
+
+
+void metricCounter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<metricCounter*>(&to_msg);
+  auto& from = static_cast<const metricCounter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.metricCounter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void metricCounter::CopyFrom(const metricCounter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.metricCounter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool metricCounter::IsInitialized() const {
+  return true;
+}
+
+void metricCounter::InternalSwap(metricCounter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata metricCounter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[26]);
+}
+
+// ===================================================================
+
+class metricHistogram::_Internal {
+ public:
+};
+
+metricHistogram::metricHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.metricHistogram)
+}
+metricHistogram::metricHistogram(const metricHistogram& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  metricHistogram* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.sum_){}
+    , decltype(_impl_.p50_){}
+    , decltype(_impl_.p90_){}
+    , decltype(_impl_.p99_){}
+    , decltype(_impl_.p999_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.metricHistogram)
+}
+
+inline void metricHistogram::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.sum_){uint64_t{0u}}
+    , decltype(_impl_.p50_){uint64_t{0u}}
+    , decltype(_impl_.p90_){uint64_t{0u}}
+    , decltype(_impl_.p99_){uint64_t{0u}}
+    , decltype(_impl_.p999_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+metricHistogram::~metricHistogram() {
+  // @@protoc_insertion_point(destructor:hare_mq.metricHistogram)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void metricHistogram::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void metricHistogram::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void metricHistogram::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.metricHistogram)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* metricHistogram::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricHistogram.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.p50_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.p90_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p99_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p999_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* metricHistogram::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.metricHistogram)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricHistogram.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  // uint64 sum = 3;
+  if (this->_internal_sum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sum(), target);
+  }
+
+  // uint64 p50 = 4;
+  if (this->_internal_p50() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_p50(), target);
+  }
+
+  // uint64 p90 = 5;
+  if (this->_internal_p90() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_p90(), target);
+  }
+
+  // uint64 p99 = 6;
+  if (this->_internal_p99() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p99(), target);
+  }
+
+  // uint64 p999 = 7;
+  if (this->_internal_p999() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p999(), target);
+  }
+
+  // uint64 max = 8;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.metricHistogram)
+  return target;
+}
+
+size_t metricHistogram::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.metricHistogram)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 sum = 3;
+  if (this->_internal_sum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sum());
+  }
+
+  // uint64 p50 = 4;
+  if (this->_internal_p50() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50());
+  }
+
+  // uint64 p90 = 5;
+  if (this->_internal_p90() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90());
+  }
+
+  // uint64 p99 = 6;
+  if (this->_internal_p99() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99());
+  }
+
+  // uint64 p999 = 7;
+  if (this->_internal_p999() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999());
+  }
+
+  // uint64 max = 8;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData metricHistogram::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    metricHistogram::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*metricHistogram::GetClassData() const { return &_class_data_; }
+
+
+void metricHistogram::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<metricHistogram*>(&to_msg);
+  auto& from = static_cast<const metricHistogram&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.metricHistogram)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_sum() != 0) {
+    _this->_internal_set_sum(from._internal_sum());
+  }
+  if (from._internal_p50() != 0) {
+    _this->_internal_set_p50(from._internal_p50());
+  }
+  if (from._internal_p90() != 0) {
+    _this->_internal_set_p90(from._internal_p90());
+  }
+  if (from._internal_p99() != 0) {
+    _this->_internal_set_p99(from._internal_p99());
+  }
+  if (from._internal_p999() != 0) {
+    _this->_internal_set_p999(from._internal_p999());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void metricHistogram::CopyFrom(const metricHistogram& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.metricHistogram)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool metricHistogram::IsInitialized() const {
+  return true;
+}
+
+void metricHistogram::InternalSwap(metricHistogram* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(metricHistogram, _impl_.max_)
+      + sizeof(metricHistogram::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(metricHistogram, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata metricHistogram::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[27]);
+}
+
+// ===================================================================
+
+class queueMetrics::_Internal {
+ public:
+};
+
+queueMetrics::queueMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.queueMetrics)
+}
+queueMetrics::queueMetrics(const queueMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  queueMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.depth_){}
+    , decltype(_impl_.unacked_){}
+    , decltype(_impl_.disk_bytes_){}
+    , decltype(_impl_.published_){}
+    , decltype(_impl_.delivered_){}
+    , decltype(_impl_.acked_){}
+    , decltype(_impl_.redelivered_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.depth_, &from._impl_.depth_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.redelivered_) -
+    reinterpret_cast<char*>(&_impl_.depth_)) + sizeof(_impl_.redelivered_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.queueMetrics)
+}
+
+inline void queueMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.depth_){uint64_t{0u}}
+    , decltype(_impl_.unacked_){uint64_t{0u}}
+    , decltype(_impl_.disk_bytes_){uint64_t{0u}}
+    , decltype(_impl_.published_){uint64_t{0u}}
+    , decltype(_impl_.delivered_){uint64_t{0u}}
+    , decltype(_impl_.acked_){uint64_t{0u}}
+    , decltype(_impl_.redelivered_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+queueMetrics::~queueMetrics() {
+  // @@protoc_insertion_point(destructor:hare_mq.queueMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void queueMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void queueMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void queueMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.queueMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.depth_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.redelivered_) -
+      reinterpret_cast<char*>(&_impl_.depth_)) + sizeof(_impl_.redelivered_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* queueMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.queueMetrics.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 depth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 unacked = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.unacked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 disk_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.disk_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 published = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.published_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivered = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.delivered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 acked = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.acked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 redelivered = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.redelivered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* queueMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.queueMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.queueMetrics.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 depth = 2;
+  if (this->_internal_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_depth(), target);
+  }
+
+  // uint64 unacked = 3;
+  if (this->_internal_unacked() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_unacked(), target);
+  }
+
+  // uint64 disk_bytes = 4;
+  if (this->_internal_disk_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_disk_bytes(), target);
+  }
+
+  // uint64 published = 5;
+  if (this->_internal_published() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_published(), target);
+  }
+
+  // uint64 delivered = 6;
+  if (this->_internal_delivered() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_delivered(), target);
+  }
+
+  // uint64 acked = 7;
+  if (this->_internal_acked() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_acked(), target);
+  }
+
+  // uint64 redelivered = 8;
+  if (this->_internal_redelivered() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_redelivered(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.queueMetrics)
+  return target;
+}
+
+size_t queueMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.queueMetrics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 depth = 2;
+  if (this->_internal_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_depth());
+  }
+
+  // uint64 unacked = 3;
+  if (this->_internal_unacked() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_unacked());
+  }
+
+  // uint64 disk_bytes = 4;
+  if (this->_internal_disk_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_disk_bytes());
+  }
+
+  // uint64 published = 5;
+  if (this->_internal_published() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_published());
+  }
+
+  // uint64 delivered = 6;
+  if (this->_internal_delivered() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivered());
+  }
+
+  // uint64 acked = 7;
+  if (this->_internal_acked() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_acked());
+  }
+
+  // uint64 redelivered = 8;
+  if (this->_internal_redelivered() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_redelivered());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData queueMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    queueMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*queueMetrics::GetClassData() const { return &_class_data_; }
+
+
+void queueMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<queueMetrics*>(&to_msg);
+  auto& from = static_cast<const queueMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.queueMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_depth() != 0) {
+    _this->_internal_set_depth(from._internal_depth());
+  }
+  if (from._internal_unacked() != 0) {
+    _this->_internal_set_unacked(from._internal_unacked());
+  }
+  if (from._internal_disk_bytes() != 0) {
+    _this->_internal_set_disk_bytes(from._internal_disk_bytes());
+  }
+  if (from._internal_published() != 0) {
+    _this->_internal_set_published(from._internal_published());
+  }
+  if (from._internal_delivered() != 0) {
+    _this->_internal_set_delivered(from._internal_delivered());
+  }
+  if (from._internal_acked() != 0) {
+    _this->_internal_set_acked(from._internal_acked());
+  }
+  if (from._internal_redelivered() != 0) {
+    _this->_internal_set_redelivered(from._internal_redelivered());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void queueMetrics::CopyFrom(const queueMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.queueMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool queueMetrics::IsInitialized() const {
+  return true;
+}
+
+void queueMetrics::InternalSwap(queueMetrics* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(queueMetrics, _impl_.redelivered_)
+      + sizeof(queueMetrics::_impl_.redelivered_)
+      - PROTOBUF_FIELD_OFFSET(queueMetrics, _impl_.depth_)>(
+          reinterpret_cast<char*>(&_impl_.depth_),
+          reinterpret_cast<char*>(&other->_impl_.depth_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata queueMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[28]);
+}
+
+// ===================================================================
+
+class metricsResponse::_Internal {
+ public:
+};
+
+metricsResponse::metricsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.metricsResponse)
+}
+metricsResponse::metricsResponse(const metricsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  metricsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.counters_){from._impl_.counters_}
+    , decltype(_impl_.histograms_){from._impl_.histograms_}
+    , decltype(_impl_.queues_){from._impl_.queues_}
+    , decltype(_impl_.requests_){from._impl_.requests_}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.ok_ = from._impl_.ok_;
+  // @@protoc_insertion_point(copy_constructor:hare_mq.metricsResponse)
+}
+
+inline void metricsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.counters_){arena}
+    , decltype(_impl_.histograms_){arena}
+    , decltype(_impl_.queues_){arena}
+    , decltype(_impl_.requests_){arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+metricsResponse::~metricsResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.metricsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void metricsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.counters_.~RepeatedPtrField();
+  _impl_.histograms_.~RepeatedPtrField();
+  _impl_.queues_.~RepeatedPtrField();
+  _impl_.requests_.~RepeatedPtrField();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.text_.Destroy();
+}
+
+void metricsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void metricsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.metricsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.counters_.Clear();
+  _impl_.histograms_.Clear();
+  _impl_.queues_.Clear();
+  _impl_.requests_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.text_.ClearToEmpty();
+  _impl_.ok_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* metricsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricsResponse.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricsResponse.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ok = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.metricCounter counters = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_counters(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.metricHistogram histograms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_histograms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.queueMetrics queues = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queues(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.metricsResponse.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.metricHistogram requests = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* metricsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.metricsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricsResponse.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricsResponse.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ok(), target);
+  }
+
+  // repeated .hare_mq.metricCounter counters = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_counters_size()); i < n; i++) {
+    const auto& repfield = this->_internal_counters(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .hare_mq.metricHistogram histograms = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_histograms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_histograms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .hare_mq.queueMetrics queues = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queues_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queues(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string text = 7;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.metricsResponse.text");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_text(), target);
+  }
+
+  // repeated .hare_mq.metricHistogram requests = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_requests_size()); i < n; i++) {
+    const auto& repfield = this->_internal_requests(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.metricsResponse)
+  return target;
+}
+
+size_t metricsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.metricsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hare_mq.metricCounter counters = 4;
+  total_size += 1UL * this->_internal_counters_size();
+  for (const auto& msg : this->_impl_.counters_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .hare_mq.metricHistogram histograms = 5;
+  total_size += 1UL * this->_internal_histograms_size();
+  for (const auto& msg : this->_impl_.histograms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .hare_mq.queueMetrics queues = 6;
+  total_size += 1UL * this->_internal_queues_size();
+  for (const auto& msg : this->_impl_.queues_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .hare_mq.metricHistogram requests = 8;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->_impl_.requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // string text = 7;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData metricsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    metricsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*metricsResponse::GetClassData() const { return &_class_data_; }
+
+
+void metricsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<metricsResponse*>(&to_msg);
+  auto& from = static_cast<const metricsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.metricsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.counters_.MergeFrom(from._impl_.counters_);
+  _this->_impl_.histograms_.MergeFrom(from._impl_.histograms_);
+  _this->_impl_.queues_.MergeFrom(from._impl_.queues_);
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_internal_set_ok(from._internal_ok());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void metricsResponse::CopyFrom(const metricsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.metricsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool metricsResponse::IsInitialized() const {
+  return true;
+}
+
+void metricsResponse::InternalSwap(metricsResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.counters_.InternalSwap(&other->_impl_.counters_);
+  _impl_.histograms_.InternalSwap(&other->_impl_.histograms_);
+  _impl_.queues_.InternalSwap(&other->_impl_.queues_);
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  swap(_impl_.ok_, other->_impl_.ok_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata metricsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[29]);
+}
+
+// ===================================================================
+
+class statsRequest::_Internal {
+ public:
+};
+
+statsRequest::statsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.statsRequest)
+}
+statsRequest::statsRequest(const statsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  statsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.name_prefix_){}
+    , decltype(_impl_.section_){}
+    , decltype(_impl_.include_bindings_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cid().empty()) {
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name_prefix().empty()) {
+    _this->_impl_.name_prefix_.Set(from._internal_name_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.section_, &from._impl_.section_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.limit_) -
+    reinterpret_cast<char*>(&_impl_.section_)) + sizeof(_impl_.limit_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.statsRequest)
+}
+
+inline void statsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.name_prefix_){}
+    , decltype(_impl_.section_){0}
+    , decltype(_impl_.include_bindings_){false}
+    , decltype(_impl_.offset_){0u}
+    , decltype(_impl_.limit_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+statsRequest::~statsRequest() {
+  // @@protoc_insertion_point(destructor:hare_mq.statsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void statsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
+  _impl_.name_prefix_.Destroy();
+}
+
+void statsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void statsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.statsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  _impl_.name_prefix_.ClearToEmpty();
+  ::memset(&_impl_.section_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.limit_) -
+      reinterpret_cast<char*>(&_impl_.section_)) + sizeof(_impl_.limit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* statsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.statsRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.statsRequest.cid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .hare_mq.StatsSection section = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_section(static_cast<::hare_mq::StatsSection>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name_prefix = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.statsRequest.name_prefix"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool include_bindings = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.include_bindings_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 limit = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* statsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.statsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.statsRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.statsRequest.cid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cid(), target);
+  }
+
+  // .hare_mq.StatsSection section = 3;
+  if (this->_internal_section() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_section(), target);
+  }
+
+  // string name_prefix = 4;
+  if (!this->_internal_name_prefix().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name_prefix().data(), static_cast<int>(this->_internal_name_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.statsRequest.name_prefix");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name_prefix(), target);
+  }
+
+  // bool include_bindings = 5;
+  if (this->_internal_include_bindings() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_include_bindings(), target);
+  }
+
+  // uint32 offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_offset(), target);
+  }
+
+  // uint32 limit = 7;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.statsRequest)
+  return target;
+}
+
+size_t statsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.statsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string cid = 2;
+  if (!this->_internal_cid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cid());
+  }
+
+  // string name_prefix = 4;
+  if (!this->_internal_name_prefix().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name_prefix());
+  }
+
+  // .hare_mq.StatsSection section = 3;
+  if (this->_internal_section() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_section());
+  }
+
+  // bool include_bindings = 5;
+  if (this->_internal_include_bindings() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+  }
+
+  // uint32 limit = 7;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData statsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    statsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*statsRequest::GetClassData() const { return &_class_data_; }
+
+
+void statsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<statsRequest*>(&to_msg);
+  auto& from = static_cast<const statsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.statsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_cid().empty()) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (!from._internal_name_prefix().empty()) {
+    _this->_internal_set_name_prefix(from._internal_name_prefix());
+  }
+  if (from._internal_section() != 0) {
+    _this->_internal_set_section(from._internal_section());
+  }
+  if (from._internal_include_bindings() != 0) {
+    _this->_internal_set_include_bindings(from._internal_include_bindings());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void statsRequest::CopyFrom(const statsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.statsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool statsRequest::IsInitialized() const {
+  return true;
+}
+
+void statsRequest::InternalSwap(statsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_prefix_, lhs_arena,
+      &other->_impl_.name_prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(statsRequest, _impl_.limit_)
+      + sizeof(statsRequest::_impl_.limit_)
+      - PROTOBUF_FIELD_OFFSET(statsRequest, _impl_.section_)>(
+          reinterpret_cast<char*>(&_impl_.section_),
+          reinterpret_cast<char*>(&other->_impl_.section_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata statsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[30]);
+}
+
+// ===================================================================
+
+class bindingStats::_Internal {
+ public:
+};
+
+bindingStats::bindingStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.bindingStats)
+}
+bindingStats::bindingStats(const bindingStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  bindingStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_binding_key().empty()) {
+    _this->_impl_.binding_key_.Set(from._internal_binding_key(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:hare_mq.bindingStats)
+}
+
+inline void bindingStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+bindingStats::~bindingStats() {
+  // @@protoc_insertion_point(destructor:hare_mq.bindingStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void bindingStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queue_name_.Destroy();
+  _impl_.binding_key_.Destroy();
+}
+
+void bindingStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void bindingStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.bindingStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.binding_key_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* bindingStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string queue_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.bindingStats.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string binding_key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_binding_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.bindingStats.binding_key"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* bindingStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.bindingStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string queue_name = 1;
+  if (!this->_internal_queue_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.bindingStats.queue_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_queue_name(), target);
+  }
+
+  // string binding_key = 2;
+  if (!this->_internal_binding_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_binding_key().data(), static_cast<int>(this->_internal_binding_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.bindingStats.binding_key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_binding_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.bindingStats)
+  return target;
+}
+
+size_t bindingStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.bindingStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string queue_name = 1;
+  if (!this->_internal_queue_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue_name());
+  }
+
+  // string binding_key = 2;
+  if (!this->_internal_binding_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_binding_key());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData bindingStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    bindingStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*bindingStats::GetClassData() const { return &_class_data_; }
+
+
+void bindingStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<bindingStats*>(&to_msg);
+  auto& from = static_cast<const bindingStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.bindingStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  if (!from._internal_binding_key().empty()) {
+    _this->_internal_set_binding_key(from._internal_binding_key());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void bindingStats::CopyFrom(const bindingStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.bindingStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool bindingStats::IsInitialized() const {
+  return true;
+}
+
+void bindingStats::InternalSwap(bindingStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.binding_key_, lhs_arena,
+      &other->_impl_.binding_key_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata bindingStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[31]);
+}
+
+// ===================================================================
+
+class exchangeStats::_Internal {
+ public:
+};
+
+exchangeStats::exchangeStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.exchangeStats)
+}
+exchangeStats::exchangeStats(const exchangeStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  exchangeStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bindings_){from._impl_.bindings_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.durable_){}
+    , decltype(_impl_.auto_delete_){}
+    , decltype(_impl_.binding_count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.binding_count_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.binding_count_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.exchangeStats)
+}
+
+inline void exchangeStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bindings_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.durable_){false}
+    , decltype(_impl_.auto_delete_){false}
+    , decltype(_impl_.binding_count_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+exchangeStats::~exchangeStats() {
+  // @@protoc_insertion_point(destructor:hare_mq.exchangeStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void exchangeStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bindings_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void exchangeStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void exchangeStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.exchangeStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bindings_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.binding_count_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.binding_count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* exchangeStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.exchangeStats.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .hare_mq.ExchangeType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::hare_mq::ExchangeType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool durable = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_delete = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 binding_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.binding_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.bindingStats bindings = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_bindings(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* exchangeStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.exchangeStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.exchangeStats.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .hare_mq.ExchangeType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // bool durable = 3;
+  if (this->_internal_durable() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_durable(), target);
+  }
+
+  // bool auto_delete = 4;
+  if (this->_internal_auto_delete() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_auto_delete(), target);
+  }
+
+  // uint64 binding_count = 5;
+  if (this->_internal_binding_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_binding_count(), target);
+  }
+
+  // repeated .hare_mq.bindingStats bindings = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bindings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bindings(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.exchangeStats)
+  return target;
+}
+
+size_t exchangeStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.exchangeStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hare_mq.bindingStats bindings = 6;
+  total_size += 1UL * this->_internal_bindings_size();
+  for (const auto& msg : this->_impl_.bindings_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .hare_mq.ExchangeType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // bool durable = 3;
+  if (this->_internal_durable() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool auto_delete = 4;
+  if (this->_internal_auto_delete() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 binding_count = 5;
+  if (this->_internal_binding_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_binding_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData exchangeStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    exchangeStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*exchangeStats::GetClassData() const { return &_class_data_; }
+
+
+void exchangeStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<exchangeStats*>(&to_msg);
+  auto& from = static_cast<const exchangeStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.exchangeStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bindings_.MergeFrom(from._impl_.bindings_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_durable() != 0) {
+    _this->_internal_set_durable(from._internal_durable());
+  }
+  if (from._internal_auto_delete() != 0) {
+    _this->_internal_set_auto_delete(from._internal_auto_delete());
+  }
+  if (from._internal_binding_count() != 0) {
+    _this->_internal_set_binding_count(from._internal_binding_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void exchangeStats::CopyFrom(const exchangeStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.exchangeStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool exchangeStats::IsInitialized() const {
+  return true;
+}
+
+void exchangeStats::InternalSwap(exchangeStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bindings_.InternalSwap(&other->_impl_.bindings_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(exchangeStats, _impl_.binding_count_)
+      + sizeof(exchangeStats::_impl_.binding_count_)
+      - PROTOBUF_FIELD_OFFSET(exchangeStats, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata exchangeStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[32]);
+}
+
+// ===================================================================
+
+class queueStats::_Internal {
+ public:
+};
+
+queueStats::queueStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.queueStats)
+}
+queueStats::queueStats(const queueStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  queueStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.depth_){}
+    , decltype(_impl_.unacked_){}
+    , decltype(_impl_.consumer_count_){}
+    , decltype(_impl_.published_){}
+    , decltype(_impl_.delivered_){}
+    , decltype(_impl_.acked_){}
+    , decltype(_impl_.redelivered_){}
+    , decltype(_impl_.durable_){}
+    , decltype(_impl_.exclusive_){}
+    , decltype(_impl_.auto_delete_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.depth_, &from._impl_.depth_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_delete_) -
+    reinterpret_cast<char*>(&_impl_.depth_)) + sizeof(_impl_.auto_delete_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.queueStats)
+}
+
+inline void queueStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.depth_){uint64_t{0u}}
+    , decltype(_impl_.unacked_){uint64_t{0u}}
+    , decltype(_impl_.consumer_count_){uint64_t{0u}}
+    , decltype(_impl_.published_){uint64_t{0u}}
+    , decltype(_impl_.delivered_){uint64_t{0u}}
+    , decltype(_impl_.acked_){uint64_t{0u}}
+    , decltype(_impl_.redelivered_){uint64_t{0u}}
+    , decltype(_impl_.durable_){false}
+    , decltype(_impl_.exclusive_){false}
+    , decltype(_impl_.auto_delete_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+queueStats::~queueStats() {
+  // @@protoc_insertion_point(destructor:hare_mq.queueStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void queueStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void queueStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void queueStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.queueStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.depth_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_delete_) -
+      reinterpret_cast<char*>(&_impl_.depth_)) + sizeof(_impl_.auto_delete_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* queueStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.queueStats.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool durable = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool exclusive = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.exclusive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_delete = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 depth = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 unacked = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.unacked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 consumer_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.consumer_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 published = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.published_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivered = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.delivered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 acked = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.acked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 redelivered = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.redelivered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* queueStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.queueStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hare_mq.queueStats.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // bool durable = 2;
+  if (this->_internal_durable() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_durable(), target);
+  }
+
+  // bool exclusive = 3;
+  if (this->_internal_exclusive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_exclusive(), target);
+  }
+
+  // bool auto_delete = 4;
+  if (this->_internal_auto_delete() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_auto_delete(), target);
+  }
+
+  // uint64 depth = 5;
+  if (this->_internal_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_depth(), target);
+  }
+
+  // uint64 unacked = 6;
+  if (this->_internal_unacked() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_unacked(), target);
+  }
+
+  // uint64 consumer_count = 7;
+  if (this->_internal_consumer_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_consumer_count(), target);
+  }
+
+  // uint64 published = 8;
+  if (this->_internal_published() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_published(), target);
+  }
+
+  // uint64 delivered = 9;
+  if (this->_internal_delivered() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_delivered(), target);
+  }
+
+  // uint64 acked = 10;
+  if (this->_internal_acked() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_acked(), target);
+  }
+
+  // uint64 redelivered = 11;
+  if (this->_internal_redelivered() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_redelivered(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.queueStats)
+  return target;
+}
+
+size_t queueStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.queueStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 depth = 5;
+  if (this->_internal_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_depth());
+  }
+
+  // uint64 unacked = 6;
+  if (this->_internal_unacked() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_unacked());
+  }
+
+  // uint64 consumer_count = 7;
+  if (this->_internal_consumer_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_consumer_count());
+  }
+
+  // uint64 published = 8;
+  if (this->_internal_published() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_published());
+  }
+
+  // uint64 delivered = 9;
+  if (this->_internal_delivered() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivered());
+  }
+
+  // uint64 acked = 10;
+  if (this->_internal_acked() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_acked());
+  }
+
+  // uint64 redelivered = 11;
+  if (this->_internal_redelivered() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_redelivered());
+  }
+
+  // bool durable = 2;
+  if (this->_internal_durable() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool exclusive = 3;
+  if (this->_internal_exclusive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool auto_delete = 4;
+  if (this->_internal_auto_delete() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData queueStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    queueStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*queueStats::GetClassData() const { return &_class_data_; }
+
+
+void queueStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<queueStats*>(&to_msg);
+  auto& from = static_cast<const queueStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.queueStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_depth() != 0) {
+    _this->_internal_set_depth(from._internal_depth());
+  }
+  if (from._internal_unacked() != 0) {
+    _this->_internal_set_unacked(from._internal_unacked());
+  }
+  if (from._internal_consumer_count() != 0) {
+    _this->_internal_set_consumer_count(from._internal_consumer_count());
+  }
+  if (from._internal_published() != 0) {
+    _this->_internal_set_published(from._internal_published());
+  }
+  if (from._internal_delivered() != 0) {
+    _this->_internal_set_delivered(from._internal_delivered());
+  }
+  if (from._internal_acked() != 0) {
+    _this->_internal_set_acked(from._internal_acked());
+  }
+  if (from._internal_redelivered() != 0) {
+    _this->_internal_set_redelivered(from._internal_redelivered());
+  }
+  if (from._internal_durable() != 0) {
+    _this->_internal_set_durable(from._internal_durable());
+  }
+  if (from._internal_exclusive() != 0) {
+    _this->_internal_set_exclusive(from._internal_exclusive());
+  }
+  if (from._internal_auto_delete() != 0) {
+    _this->_internal_set_auto_delete(from._internal_auto_delete());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void queueStats::CopyFrom(const queueStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.queueStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool queueStats::IsInitialized() const {
+  return true;
+}
+
+void queueStats::InternalSwap(queueStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(queueStats, _impl_.auto_delete_)
+      + sizeof(queueStats::_impl_.auto_delete_)
+      - PROTOBUF_FIELD_OFFSET(queueStats, _impl_.depth_)>(
+          reinterpret_cast<char*>(&_impl_.depth_),
+          reinterpret_cast<char*>(&other->_impl_.depth_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata queueStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[33]);
+}
+
+// ===================================================================
+
+class consumerStats::_Internal {
+ public:
+};
+
+consumerStats::consumerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.consumerStats)
+}
+consumerStats::consumerStats(const consumerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  consumerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.unacked_){}
+    , decltype(_impl_.auto_ack_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tag().empty()) {
+    _this->_impl_.tag_.Set(from._internal_tag(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.unacked_, &from._impl_.unacked_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_ack_) -
+    reinterpret_cast<char*>(&_impl_.unacked_)) + sizeof(_impl_.auto_ack_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.consumerStats)
+}
+
+inline void consumerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.unacked_){uint64_t{0u}}
+    , decltype(_impl_.auto_ack_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+consumerStats::~consumerStats() {
+  // @@protoc_insertion_point(destructor:hare_mq.consumerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void consumerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tag_.Destroy();
+  _impl_.queue_name_.Destroy();
+}
+
+void consumerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void consumerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.consumerStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tag_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  ::memset(&_impl_.unacked_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_ack_) -
+      reinterpret_cast<char*>(&_impl_.unacked_)) + sizeof(_impl_.auto_ack_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* consumerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string tag = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_rid();
+          auto str = _internal_mutable_tag();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryRequest.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.consumerStats.tag"));
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // string queue_name = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
+          auto str = _internal_mutable_queue_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryRequest.cid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.consumerStats.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_ack = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.auto_ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 unacked = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.unacked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -5440,184 +12365,235 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicQueryRequest::_InternalSerialize(
+uint8_t* consumerStats::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicQueryRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.consumerStats)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string rid = 1;
-  if (!this->_internal_rid().empty()) {
+  // string tag = 1;
+  if (!this->_internal_tag().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      this->_internal_tag().data(), static_cast<int>(this->_internal_tag().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicQueryRequest.rid");
+      "hare_mq.consumerStats.tag");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_rid(), target);
+        1, this->_internal_tag(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
+  // string queue_name = 2;
+  if (!this->_internal_queue_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicQueryRequest.cid");
+      "hare_mq.consumerStats.queue_name");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+        2, this->_internal_queue_name(), target);
+  }
+
+  // bool auto_ack = 3;
+  if (this->_internal_auto_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_auto_ack(), target);
+  }
+
+  // uint64 unacked = 4;
+  if (this->_internal_unacked() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_unacked(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicQueryRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.consumerStats)
   return target;
 }
 
-size_t basicQueryRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicQueryRequest)
+size_t consumerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.consumerStats)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string rid = 1;
-  if (!this->_internal_rid().empty()) {
+  // string tag = 1;
+  if (!this->_internal_tag().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_rid());
+        this->_internal_tag());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
+  // string queue_name = 2;
+  if (!this->_internal_queue_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+        this->_internal_queue_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
+  // uint64 unacked = 4;
+  if (this->_internal_unacked() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_unacked());
+  }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicQueryRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicQueryRequest::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicQueryRequest::GetClassData() const { return &_class_data_; }
+  // bool auto_ack = 3;
+  if (this->_internal_auto_ack() != 0) {
+    total_size += 1 + 1;
+  }
 
-void basicQueryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicQueryRequest *>(to)->MergeFrom(
-      static_cast<const basicQueryRequest &>(from));
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData consumerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    consumerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*consumerStats::GetClassData() const { return &_class_data_; }
+
 
-void basicQueryRequest::MergeFrom(const basicQueryRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicQueryRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void consumerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<consumerStats*>(&to_msg);
+  auto& from = static_cast<const consumerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.consumerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+  if (!from._internal_tag().empty()) {
+    _this->_internal_set_tag(from._internal_tag());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_unacked() != 0) {
+    _this->_internal_set_unacked(from._internal_unacked());
+  }
+  if (from._internal_auto_ack() != 0) {
+    _this->_internal_set_auto_ack(from._internal_auto_ack());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicQueryRequest::CopyFrom(const basicQueryRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicQueryRequest)
+void consumerStats::CopyFrom(const consumerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.consumerStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicQueryRequest::IsInitialized() const {
+bool consumerStats::IsInitialized() const {
   return true;
 }
 
-void basicQueryRequest::InternalSwap(basicQueryRequest* other) {
+void consumerStats::InternalSwap(consumerStats* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.tag_, lhs_arena,
+      &other->_impl_.tag_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(consumerStats, _impl_.auto_ack_)
+      + sizeof(consumerStats::_impl_.auto_ack_)
+      - PROTOBUF_FIELD_OFFSET(consumerStats, _impl_.unacked_)>(
+          reinterpret_cast<char*>(&_impl_.unacked_),
+          reinterpret_cast<char*>(&other->_impl_.unacked_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicQueryRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata consumerStats::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
-      file_level_metadata_protocol_2eproto[16]);
+      file_level_metadata_protocol_2eproto[34]);
 }
 
 // ===================================================================
 
-class basicQueryResponse::_Internal {
+class statsResponse::_Internal {
  public:
 };
 
-basicQueryResponse::basicQueryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+statsResponse::statsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:hare_mq.basicQueryResponse)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:hare_mq.statsResponse)
 }
-basicQueryResponse::basicQueryResponse(const basicQueryResponse& from)
+statsResponse::statsResponse(const statsResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  statsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exchanges_){from._impl_.exchanges_}
+    , decltype(_impl_.queues_){from._impl_.queues_}
+    , decltype(_impl_.consumers_){from._impl_.consumers_}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.total_exchanges_){}
+    , decltype(_impl_.total_queues_){}
+    , decltype(_impl_.total_consumers_){}
+    , decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.cid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.cid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.cid_.Set(from._internal_cid(), 
+      _this->GetArenaForAllocation());
   }
-  body_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_body().empty()) {
-    body_.Set(from._internal_body(), 
-      GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:hare_mq.basicQueryResponse)
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ok_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.ok_));
+  // @@protoc_insertion_point(copy_constructor:hare_mq.statsResponse)
 }
 
-inline void basicQueryResponse::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-body_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void statsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exchanges_){arena}
+    , decltype(_impl_.queues_){arena}
+    , decltype(_impl_.consumers_){arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.total_exchanges_){uint64_t{0u}}
+    , decltype(_impl_.total_queues_){uint64_t{0u}}
+    , decltype(_impl_.total_consumers_){uint64_t{0u}}
+    , decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicQueryResponse::~basicQueryResponse() {
-  // @@protoc_insertion_point(destructor:hare_mq.basicQueryResponse)
+statsResponse::~statsResponse() {
+  // @@protoc_insertion_point(destructor:hare_mq.statsResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5625,30 +12601,37 @@ basicQueryResponse::~basicQueryResponse() {
   SharedDtor();
 }
 
-inline void basicQueryResponse::SharedDtor() {
+inline void statsResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  body_.Destroy();
+  _impl_.exchanges_.~RepeatedPtrField();
+  _impl_.queues_.~RepeatedPtrField();
+  _impl_.consumers_.~RepeatedPtrField();
+  _impl_.rid_.Destroy();
+  _impl_.cid_.Destroy();
 }
 
-void basicQueryResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void statsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicQueryResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:hare_mq.basicQueryResponse)
+void statsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hare_mq.statsResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  body_.ClearToEmpty();
+  _impl_.exchanges_.Clear();
+  _impl_.queues_.Clear();
+  _impl_.consumers_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_.ClearToEmpty();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ok_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.ok_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicQueryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* statsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5660,7 +12643,7 @@ const char* basicQueryResponse::_InternalParse(const char* ptr, ::_pbi::ParseCon
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryResponse.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.statsResponse.rid"));
         } else
           goto handle_unusual;
         continue;
@@ -5670,17 +12653,86 @@ const char* basicQueryResponse::_InternalParse(const char* ptr, ::_pbi::ParseCon
           auto str = _internal_mutable_cid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryResponse.cid"));
+          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.statsResponse.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string body = 3;
+      // bool ok = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_body();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.exchangeStats exchanges = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_exchanges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.queueStats queues = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queues(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .hare_mq.consumerStats consumers = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_consumers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_exchanges = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.total_exchanges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_queues = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.total_queues_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_consumers = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.total_consumers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "hare_mq.basicQueryResponse.body"));
         } else
           goto handle_unusual;
         continue;
@@ -5707,9 +12759,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicQueryResponse::_InternalSerialize(
+uint8_t* statsResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.basicQueryResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:hare_mq.statsResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5718,7 +12770,7 @@ uint8_t* basicQueryResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicQueryResponse.rid");
+      "hare_mq.statsResponse.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
@@ -5728,37 +12780,102 @@ uint8_t* basicQueryResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicQueryResponse.cid");
+      "hare_mq.statsResponse.cid");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_cid(), target);
   }
 
-  // string body = 3;
-  if (!this->_internal_body().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hare_mq.basicQueryResponse.body");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_body(), target);
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ok(), target);
+  }
+
+  // uint64 version = 4;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_version(), target);
+  }
+
+  // repeated .hare_mq.exchangeStats exchanges = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_exchanges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_exchanges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .hare_mq.queueStats queues = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queues_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queues(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .hare_mq.consumerStats consumers = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_consumers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_consumers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 total_exchanges = 8;
+  if (this->_internal_total_exchanges() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_total_exchanges(), target);
+  }
+
+  // uint64 total_queues = 9;
+  if (this->_internal_total_queues() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_total_queues(), target);
+  }
+
+  // uint64 total_consumers = 10;
+  if (this->_internal_total_consumers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_total_consumers(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.basicQueryResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:hare_mq.statsResponse)
   return target;
 }
 
-size_t basicQueryResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hare_mq.basicQueryResponse)
+size_t statsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hare_mq.statsResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .hare_mq.exchangeStats exchanges = 5;
+  total_size += 1UL * this->_internal_exchanges_size();
+  for (const auto& msg : this->_impl_.exchanges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .hare_mq.queueStats queues = 6;
+  total_size += 1UL * this->_internal_queues_size();
+  for (const auto& msg : this->_impl_.queues_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .hare_mq.consumerStats consumers = 7;
+  total_size += 1UL * this->_internal_consumers_size();
+  for (const auto& msg : this->_impl_.consumers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // string rid = 1;
   if (!this->_internal_rid().empty()) {
     total_size += 1 +
@@ -5773,81 +12890,115 @@ size_t basicQueryResponse::ByteSizeLong() const {
         this->_internal_cid());
   }
 
-  // string body = 3;
-  if (!this->_internal_body().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_body());
+  // uint64 version = 4;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
+  // uint64 total_exchanges = 8;
+  if (this->_internal_total_exchanges() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_exchanges());
+  }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicQueryResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicQueryResponse::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicQueryResponse::GetClassData() const { return &_class_data_; }
+  // uint64 total_queues = 9;
+  if (this->_internal_total_queues() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_queues());
+  }
+
+  // uint64 total_consumers = 10;
+  if (this->_internal_total_consumers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_consumers());
+  }
+
+  // bool ok = 3;
+  if (this->_internal_ok() != 0) {
+    total_size += 1 + 1;
+  }
 
-void basicQueryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicQueryResponse *>(to)->MergeFrom(
-      static_cast<const basicQueryResponse &>(from));
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData statsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    statsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*statsResponse::GetClassData() const { return &_class_data_; }
+
 
-void basicQueryResponse::MergeFrom(const basicQueryResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.basicQueryResponse)
-  GOOGLE_DCHECK_NE(&from, this);
+void statsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<statsResponse*>(&to_msg);
+  auto& from = static_cast<const statsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:hare_mq.statsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.exchanges_.MergeFrom(from._impl_.exchanges_);
+  _this->_impl_.queues_.MergeFrom(from._impl_.queues_);
+  _this->_impl_.consumers_.MergeFrom(from._impl_.consumers_);
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_cid(from._internal_cid());
   }
-  if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_total_exchanges() != 0) {
+    _this->_internal_set_total_exchanges(from._internal_total_exchanges());
+  }
+  if (from._internal_total_queues() != 0) {
+    _this->_internal_set_total_queues(from._internal_total_queues());
+  }
+  if (from._internal_total_consumers() != 0) {
+    _this->_internal_set_total_consumers(from._internal_total_consumers());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_internal_set_ok(from._internal_ok());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicQueryResponse::CopyFrom(const basicQueryResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.basicQueryResponse)
+void statsResponse::CopyFrom(const statsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hare_mq.statsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicQueryResponse::IsInitialized() const {
+bool statsResponse::IsInitialized() const {
   return true;
 }
 
-void basicQueryResponse::InternalSwap(basicQueryResponse* other) {
+void statsResponse::InternalSwap(statsResponse* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.exchanges_.InternalSwap(&other->_impl_.exchanges_);
+  _impl_.queues_.InternalSwap(&other->_impl_.queues_);
+  _impl_.consumers_.InternalSwap(&other->_impl_.consumers_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
+      &_impl_.cid_, lhs_arena,
+      &other->_impl_.cid_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(statsResponse, _impl_.ok_)
+      + sizeof(statsResponse::_impl_.ok_)
+      - PROTOBUF_FIELD_OFFSET(statsResponse, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicQueryResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata statsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
-      file_level_metadata_protocol_2eproto[17]);
+      file_level_metadata_protocol_2eproto[35]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -5901,6 +13052,14 @@ template<> PROTOBUF_NOINLINE ::hare_mq::basicAckRequest*
 Arena::CreateMaybeMessage< ::hare_mq::basicAckRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hare_mq::basicAckRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::hare_mq::basicNackRequest*
+Arena::CreateMaybeMessage< ::hare_mq::basicNackRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::basicNackRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::basicRejectRequest*
+Arena::CreateMaybeMessage< ::hare_mq::basicRejectRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::basicRejectRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::hare_mq::basicConsumeRequest*
 Arena::CreateMaybeMessage< ::hare_mq::basicConsumeRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hare_mq::basicConsumeRequest >(arena);
@@ -5913,6 +13072,14 @@ template<> PROTOBUF_NOINLINE ::hare_mq::basicConsumeResponse*
 Arena::CreateMaybeMessage< ::hare_mq::basicConsumeResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hare_mq::basicConsumeResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::hare_mq::basicGetRequest*
+Arena::CreateMaybeMessage< ::hare_mq::basicGetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::basicGetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::basicGetResponse*
+Arena::CreateMaybeMessage< ::hare_mq::basicGetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::basicGetResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::hare_mq::basicCommonResponse*
 Arena::CreateMaybeMessage< ::hare_mq::basicCommonResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hare_mq::basicCommonResponse >(arena);
@@ -5925,6 +13092,62 @@ template<> PROTOBUF_NOINLINE ::hare_mq::basicQueryResponse*
 Arena::CreateMaybeMessage< ::hare_mq::basicQueryResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hare_mq::basicQueryResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::hare_mq::heartbeatRequest*
+Arena::CreateMaybeMessage< ::hare_mq::heartbeatRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::heartbeatRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::heartbeatResponse*
+Arena::CreateMaybeMessage< ::hare_mq::heartbeatResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::heartbeatResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::heartbeat*
+Arena::CreateMaybeMessage< ::hare_mq::heartbeat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::heartbeat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::metricsRequest*
+Arena::CreateMaybeMessage< ::hare_mq::metricsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::metricsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::metricCounter*
+Arena::CreateMaybeMessage< ::hare_mq::metricCounter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::metricCounter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::metricHistogram*
+Arena::CreateMaybeMessage< ::hare_mq::metricHistogram >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::metricHistogram >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::queueMetrics*
+Arena::CreateMaybeMessage< ::hare_mq::queueMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::queueMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::metricsResponse*
+Arena::CreateMaybeMessage< ::hare_mq::metricsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::metricsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::statsRequest*
+Arena::CreateMaybeMessage< ::hare_mq::statsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::statsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::bindingStats*
+Arena::CreateMaybeMessage< ::hare_mq::bindingStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::bindingStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::exchangeStats*
+Arena::CreateMaybeMessage< ::hare_mq::exchangeStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::exchangeStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::queueStats*
+Arena::CreateMaybeMessage< ::hare_mq::queueStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::queueStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::consumerStats*
+Arena::CreateMaybeMessage< ::hare_mq::consumerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::consumerStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hare_mq::statsResponse*
+Arena::CreateMaybeMessage< ::hare_mq::statsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hare_mq::statsResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
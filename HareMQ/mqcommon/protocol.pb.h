@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3020002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -32,6 +32,7 @@
 #include <google/protobuf/map.h>  // IWYU pragma: export
 #include <google/protobuf/map_entry.h>
 #include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include "msg.pb.h"
 // @@protoc_insertion_point(includes)
@@ -64,6 +65,15 @@ extern basicConsumeRequestDefaultTypeInternal _basicConsumeRequest_default_insta
 class basicConsumeResponse;
 struct basicConsumeResponseDefaultTypeInternal;
 extern basicConsumeResponseDefaultTypeInternal _basicConsumeResponse_default_instance_;
+class basicGetRequest;
+struct basicGetRequestDefaultTypeInternal;
+extern basicGetRequestDefaultTypeInternal _basicGetRequest_default_instance_;
+class basicGetResponse;
+struct basicGetResponseDefaultTypeInternal;
+extern basicGetResponseDefaultTypeInternal _basicGetResponse_default_instance_;
+class basicNackRequest;
+struct basicNackRequestDefaultTypeInternal;
+extern basicNackRequestDefaultTypeInternal _basicNackRequest_default_instance_;
 class basicPublishRequest;
 struct basicPublishRequestDefaultTypeInternal;
 extern basicPublishRequestDefaultTypeInternal _basicPublishRequest_default_instance_;
@@ -73,12 +83,21 @@ extern basicQueryRequestDefaultTypeInternal _basicQueryRequest_default_instance_
 class basicQueryResponse;
 struct basicQueryResponseDefaultTypeInternal;
 extern basicQueryResponseDefaultTypeInternal _basicQueryResponse_default_instance_;
+class basicRejectRequest;
+struct basicRejectRequestDefaultTypeInternal;
+extern basicRejectRequestDefaultTypeInternal _basicRejectRequest_default_instance_;
 class bindRequest;
 struct bindRequestDefaultTypeInternal;
 extern bindRequestDefaultTypeInternal _bindRequest_default_instance_;
+class bindingStats;
+struct bindingStatsDefaultTypeInternal;
+extern bindingStatsDefaultTypeInternal _bindingStats_default_instance_;
 class closeChannelRequest;
 struct closeChannelRequestDefaultTypeInternal;
 extern closeChannelRequestDefaultTypeInternal _closeChannelRequest_default_instance_;
+class consumerStats;
+struct consumerStatsDefaultTypeInternal;
+extern consumerStatsDefaultTypeInternal _consumerStats_default_instance_;
 class declareExchangeRequest;
 struct declareExchangeRequestDefaultTypeInternal;
 extern declareExchangeRequestDefaultTypeInternal _declareExchangeRequest_default_instance_;
@@ -97,9 +116,45 @@ extern deleteExchangeRequestDefaultTypeInternal _deleteExchangeRequest_default_i
 class deleteQueueRequest;
 struct deleteQueueRequestDefaultTypeInternal;
 extern deleteQueueRequestDefaultTypeInternal _deleteQueueRequest_default_instance_;
+class exchangeStats;
+struct exchangeStatsDefaultTypeInternal;
+extern exchangeStatsDefaultTypeInternal _exchangeStats_default_instance_;
+class heartbeat;
+struct heartbeatDefaultTypeInternal;
+extern heartbeatDefaultTypeInternal _heartbeat_default_instance_;
+class heartbeatRequest;
+struct heartbeatRequestDefaultTypeInternal;
+extern heartbeatRequestDefaultTypeInternal _heartbeatRequest_default_instance_;
+class heartbeatResponse;
+struct heartbeatResponseDefaultTypeInternal;
+extern heartbeatResponseDefaultTypeInternal _heartbeatResponse_default_instance_;
+class metricCounter;
+struct metricCounterDefaultTypeInternal;
+extern metricCounterDefaultTypeInternal _metricCounter_default_instance_;
+class metricHistogram;
+struct metricHistogramDefaultTypeInternal;
+extern metricHistogramDefaultTypeInternal _metricHistogram_default_instance_;
+class metricsRequest;
+struct metricsRequestDefaultTypeInternal;
+extern metricsRequestDefaultTypeInternal _metricsRequest_default_instance_;
+class metricsResponse;
+struct metricsResponseDefaultTypeInternal;
+extern metricsResponseDefaultTypeInternal _metricsResponse_default_instance_;
 class openChannelRequest;
 struct openChannelRequestDefaultTypeInternal;
 extern openChannelRequestDefaultTypeInternal _openChannelRequest_default_instance_;
+class queueMetrics;
+struct queueMetricsDefaultTypeInternal;
+extern queueMetricsDefaultTypeInternal _queueMetrics_default_instance_;
+class queueStats;
+struct queueStatsDefaultTypeInternal;
+extern queueStatsDefaultTypeInternal _queueStats_default_instance_;
+class statsRequest;
+struct statsRequestDefaultTypeInternal;
+extern statsRequestDefaultTypeInternal _statsRequest_default_instance_;
+class statsResponse;
+struct statsResponseDefaultTypeInternal;
+extern statsResponseDefaultTypeInternal _statsResponse_default_instance_;
 class unbindRequest;
 struct unbindRequestDefaultTypeInternal;
 extern unbindRequestDefaultTypeInternal _unbindRequest_default_instance_;
@@ -110,22 +165,67 @@ template<> ::hare_mq::basicCancelRequest* Arena::CreateMaybeMessage<::hare_mq::b
 template<> ::hare_mq::basicCommonResponse* Arena::CreateMaybeMessage<::hare_mq::basicCommonResponse>(Arena*);
 template<> ::hare_mq::basicConsumeRequest* Arena::CreateMaybeMessage<::hare_mq::basicConsumeRequest>(Arena*);
 template<> ::hare_mq::basicConsumeResponse* Arena::CreateMaybeMessage<::hare_mq::basicConsumeResponse>(Arena*);
+template<> ::hare_mq::basicGetRequest* Arena::CreateMaybeMessage<::hare_mq::basicGetRequest>(Arena*);
+template<> ::hare_mq::basicGetResponse* Arena::CreateMaybeMessage<::hare_mq::basicGetResponse>(Arena*);
+template<> ::hare_mq::basicNackRequest* Arena::CreateMaybeMessage<::hare_mq::basicNackRequest>(Arena*);
 template<> ::hare_mq::basicPublishRequest* Arena::CreateMaybeMessage<::hare_mq::basicPublishRequest>(Arena*);
 template<> ::hare_mq::basicQueryRequest* Arena::CreateMaybeMessage<::hare_mq::basicQueryRequest>(Arena*);
 template<> ::hare_mq::basicQueryResponse* Arena::CreateMaybeMessage<::hare_mq::basicQueryResponse>(Arena*);
+template<> ::hare_mq::basicRejectRequest* Arena::CreateMaybeMessage<::hare_mq::basicRejectRequest>(Arena*);
 template<> ::hare_mq::bindRequest* Arena::CreateMaybeMessage<::hare_mq::bindRequest>(Arena*);
+template<> ::hare_mq::bindingStats* Arena::CreateMaybeMessage<::hare_mq::bindingStats>(Arena*);
 template<> ::hare_mq::closeChannelRequest* Arena::CreateMaybeMessage<::hare_mq::closeChannelRequest>(Arena*);
+template<> ::hare_mq::consumerStats* Arena::CreateMaybeMessage<::hare_mq::consumerStats>(Arena*);
 template<> ::hare_mq::declareExchangeRequest* Arena::CreateMaybeMessage<::hare_mq::declareExchangeRequest>(Arena*);
 template<> ::hare_mq::declareExchangeRequest_ArgsEntry_DoNotUse* Arena::CreateMaybeMessage<::hare_mq::declareExchangeRequest_ArgsEntry_DoNotUse>(Arena*);
 template<> ::hare_mq::declareQueueRequest* Arena::CreateMaybeMessage<::hare_mq::declareQueueRequest>(Arena*);
 template<> ::hare_mq::declareQueueRequest_ArgsEntry_DoNotUse* Arena::CreateMaybeMessage<::hare_mq::declareQueueRequest_ArgsEntry_DoNotUse>(Arena*);
 template<> ::hare_mq::deleteExchangeRequest* Arena::CreateMaybeMessage<::hare_mq::deleteExchangeRequest>(Arena*);
 template<> ::hare_mq::deleteQueueRequest* Arena::CreateMaybeMessage<::hare_mq::deleteQueueRequest>(Arena*);
+template<> ::hare_mq::exchangeStats* Arena::CreateMaybeMessage<::hare_mq::exchangeStats>(Arena*);
+template<> ::hare_mq::heartbeat* Arena::CreateMaybeMessage<::hare_mq::heartbeat>(Arena*);
+template<> ::hare_mq::heartbeatRequest* Arena::CreateMaybeMessage<::hare_mq::heartbeatRequest>(Arena*);
+template<> ::hare_mq::heartbeatResponse* Arena::CreateMaybeMessage<::hare_mq::heartbeatResponse>(Arena*);
+template<> ::hare_mq::metricCounter* Arena::CreateMaybeMessage<::hare_mq::metricCounter>(Arena*);
+template<> ::hare_mq::metricHistogram* Arena::CreateMaybeMessage<::hare_mq::metricHistogram>(Arena*);
+template<> ::hare_mq::metricsRequest* Arena::CreateMaybeMessage<::hare_mq::metricsRequest>(Arena*);
+template<> ::hare_mq::metricsResponse* Arena::CreateMaybeMessage<::hare_mq::metricsResponse>(Arena*);
 template<> ::hare_mq::openChannelRequest* Arena::CreateMaybeMessage<::hare_mq::openChannelRequest>(Arena*);
+template<> ::hare_mq::queueMetrics* Arena::CreateMaybeMessage<::hare_mq::queueMetrics>(Arena*);
+template<> ::hare_mq::queueStats* Arena::CreateMaybeMessage<::hare_mq::queueStats>(Arena*);
+template<> ::hare_mq::statsRequest* Arena::CreateMaybeMessage<::hare_mq::statsRequest>(Arena*);
+template<> ::hare_mq::statsResponse* Arena::CreateMaybeMessage<::hare_mq::statsResponse>(Arena*);
 template<> ::hare_mq::unbindRequest* Arena::CreateMaybeMessage<::hare_mq::unbindRequest>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace hare_mq {
 
+enum StatsSection : int {
+  STATS_ALL = 0,
+  STATS_EXCHANGES = 1,
+  STATS_QUEUES = 2,
+  STATS_CONSUMERS = 3,
+  StatsSection_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatsSection_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StatsSection_IsValid(int value);
+constexpr StatsSection StatsSection_MIN = STATS_ALL;
+constexpr StatsSection StatsSection_MAX = STATS_CONSUMERS;
+constexpr int StatsSection_ARRAYSIZE = StatsSection_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatsSection_descriptor();
+template<typename T>
+inline const std::string& StatsSection_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatsSection>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatsSection_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatsSection_descriptor(), enum_t_value);
+}
+inline bool StatsSection_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatsSection* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatsSection>(
+    StatsSection_descriptor(), name, value);
+}
 // ===================================================================
 
 class openChannelRequest final :
@@ -208,9 +308,11 @@ class openChannelRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const openChannelRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const openChannelRequest& from);
+  void MergeFrom( const openChannelRequest& from) {
+    openChannelRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -219,10 +321,10 @@ class openChannelRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(openChannelRequest* other);
@@ -285,9 +387,12 @@ class openChannelRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -372,9 +477,11 @@ class closeChannelRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const closeChannelRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const closeChannelRequest& from);
+  void MergeFrom( const closeChannelRequest& from) {
+    closeChannelRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -383,10 +490,10 @@ class closeChannelRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(closeChannelRequest* other);
@@ -449,9 +556,12 @@ class closeChannelRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -564,9 +674,11 @@ class declareExchangeRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const declareExchangeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const declareExchangeRequest& from);
+  void MergeFrom( const declareExchangeRequest& from) {
+    declareExchangeRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -575,10 +687,10 @@ class declareExchangeRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(declareExchangeRequest* other);
@@ -707,18 +819,21 @@ class declareExchangeRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      declareExchangeRequest_ArgsEntry_DoNotUse,
-      std::string, std::string,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  int exchange_type_;
-  bool durable_;
-  bool auto_delete_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        declareExchangeRequest_ArgsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    int exchange_type_;
+    bool durable_;
+    bool auto_delete_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -803,9 +918,11 @@ class deleteExchangeRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const deleteExchangeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const deleteExchangeRequest& from);
+  void MergeFrom( const deleteExchangeRequest& from) {
+    deleteExchangeRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -814,10 +931,10 @@ class deleteExchangeRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(deleteExchangeRequest* other);
@@ -895,10 +1012,13 @@ class deleteExchangeRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1011,9 +1131,11 @@ class declareQueueRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const declareQueueRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const declareQueueRequest& from);
+  void MergeFrom( const declareQueueRequest& from) {
+    declareQueueRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1022,10 +1144,10 @@ class declareQueueRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(declareQueueRequest* other);
@@ -1154,18 +1276,21 @@ class declareQueueRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      declareQueueRequest_ArgsEntry_DoNotUse,
-      std::string, std::string,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  bool exclusive_;
-  bool durable_;
-  bool auto_delete_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        declareQueueRequest_ArgsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    bool exclusive_;
+    bool durable_;
+    bool auto_delete_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1250,9 +1375,11 @@ class deleteQueueRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const deleteQueueRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const deleteQueueRequest& from);
+  void MergeFrom( const deleteQueueRequest& from) {
+    deleteQueueRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1261,10 +1388,10 @@ class deleteQueueRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(deleteQueueRequest* other);
@@ -1342,10 +1469,13 @@ class deleteQueueRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1430,9 +1560,11 @@ class bindRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const bindRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const bindRequest& from);
+  void MergeFrom( const bindRequest& from) {
+    bindRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1441,10 +1573,10 @@ class bindRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(bindRequest* other);
@@ -1552,12 +1684,15 @@ class bindRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1642,9 +1777,11 @@ class unbindRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const unbindRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const unbindRequest& from);
+  void MergeFrom( const unbindRequest& from) {
+    unbindRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1653,10 +1790,10 @@ class unbindRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(unbindRequest* other);
@@ -1749,11 +1886,14 @@ class unbindRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1838,9 +1978,11 @@ class basicPublishRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const basicPublishRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicPublishRequest& from);
+  void MergeFrom( const basicPublishRequest& from) {
+    basicPublishRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1849,10 +1991,10 @@ class basicPublishRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(basicPublishRequest* other);
@@ -1964,12 +2106,15 @@ class basicPublishRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  ::hare_mq::BasicProperties* properties_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::hare_mq::BasicProperties* properties_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -2054,9 +2199,11 @@ class basicAckRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const basicAckRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicAckRequest& from);
+  void MergeFrom( const basicAckRequest& from) {
+    basicAckRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2065,10 +2212,10 @@ class basicAckRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(basicAckRequest* other);
@@ -2097,6 +2244,8 @@ class basicAckRequest final :
     kCidFieldNumber = 2,
     kQueueNameFieldNumber = 3,
     kMessageIdFieldNumber = 4,
+    kDeliveryTagFieldNumber = 5,
+    kMultipleFieldNumber = 6,
   };
   // string rid = 1;
   void clear_rid();
@@ -2154,6 +2303,24 @@ class basicAckRequest final :
   std::string* _internal_mutable_message_id();
   public:
 
+  // uint64 delivery_tag = 5;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
+  // bool multiple = 6;
+  void clear_multiple();
+  bool multiple() const;
+  void set_multiple(bool value);
+  private:
+  bool _internal_multiple() const;
+  void _internal_set_multiple(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:hare_mq.basicAckRequest)
  private:
   class _Internal;
@@ -2161,33 +2328,38 @@ class basicAckRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_id_;
+    uint64_t delivery_tag_;
+    bool multiple_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicConsumeRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicConsumeRequest) */ {
+class basicNackRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicNackRequest) */ {
  public:
-  inline basicConsumeRequest() : basicConsumeRequest(nullptr) {}
-  ~basicConsumeRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicNackRequest() : basicNackRequest(nullptr) {}
+  ~basicNackRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicNackRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicConsumeRequest(const basicConsumeRequest& from);
-  basicConsumeRequest(basicConsumeRequest&& from) noexcept
-    : basicConsumeRequest() {
+  basicNackRequest(const basicNackRequest& from);
+  basicNackRequest(basicNackRequest&& from) noexcept
+    : basicNackRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicConsumeRequest& operator=(const basicConsumeRequest& from) {
+  inline basicNackRequest& operator=(const basicNackRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicConsumeRequest& operator=(basicConsumeRequest&& from) noexcept {
+  inline basicNackRequest& operator=(basicNackRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2210,20 +2382,20 @@ class basicConsumeRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicConsumeRequest& default_instance() {
+  static const basicNackRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicConsumeRequest* internal_default_instance() {
-    return reinterpret_cast<const basicConsumeRequest*>(
-               &_basicConsumeRequest_default_instance_);
+  static inline const basicNackRequest* internal_default_instance() {
+    return reinterpret_cast<const basicNackRequest*>(
+               &_basicNackRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(basicConsumeRequest& a, basicConsumeRequest& b) {
+  friend void swap(basicNackRequest& a, basicNackRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicConsumeRequest* other) {
+  inline void Swap(basicNackRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2236,7 +2408,7 @@ class basicConsumeRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicConsumeRequest* other) {
+  void UnsafeArenaSwap(basicNackRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2244,15 +2416,17 @@ class basicConsumeRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicConsumeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicConsumeRequest>(arena);
+  basicNackRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicNackRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicConsumeRequest& from);
+  void CopyFrom(const basicNackRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicConsumeRequest& from);
+  void MergeFrom( const basicNackRequest& from) {
+    basicNackRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2261,21 +2435,21 @@ class basicConsumeRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicConsumeRequest* other);
+  void InternalSwap(basicNackRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "hare_mq.basicConsumeRequest";
+    return "hare_mq.basicNackRequest";
   }
   protected:
-  explicit basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicNackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2291,9 +2465,11 @@ class basicConsumeRequest final :
   enum : int {
     kRidFieldNumber = 1,
     kCidFieldNumber = 2,
-    kConsumerTagFieldNumber = 3,
-    kQueueNameFieldNumber = 4,
-    kAutoAckFieldNumber = 5,
+    kQueueNameFieldNumber = 3,
+    kMessageIdFieldNumber = 4,
+    kDeliveryTagFieldNumber = 6,
+    kRequeueFieldNumber = 5,
+    kMultipleFieldNumber = 7,
   };
   // string rid = 1;
   void clear_rid();
@@ -2323,21 +2499,7 @@ class basicConsumeRequest final :
   std::string* _internal_mutable_cid();
   public:
 
-  // string consumer_tag = 3;
-  void clear_consumer_tag();
-  const std::string& consumer_tag() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_consumer_tag();
-  PROTOBUF_NODISCARD std::string* release_consumer_tag();
-  void set_allocated_consumer_tag(std::string* consumer_tag);
-  private:
-  const std::string& _internal_consumer_tag() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
-  std::string* _internal_mutable_consumer_tag();
-  public:
-
-  // string queue_name = 4;
+  // string queue_name = 3;
   void clear_queue_name();
   const std::string& queue_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -2351,50 +2513,87 @@ class basicConsumeRequest final :
   std::string* _internal_mutable_queue_name();
   public:
 
-  // bool auto_ack = 5;
-  void clear_auto_ack();
-  bool auto_ack() const;
-  void set_auto_ack(bool value);
+  // string message_id = 4;
+  void clear_message_id();
+  const std::string& message_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message_id();
+  PROTOBUF_NODISCARD std::string* release_message_id();
+  void set_allocated_message_id(std::string* message_id);
   private:
-  bool _internal_auto_ack() const;
-  void _internal_set_auto_ack(bool value);
+  const std::string& _internal_message_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_id(const std::string& value);
+  std::string* _internal_mutable_message_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:hare_mq.basicConsumeRequest)
+  // uint64 delivery_tag = 6;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
+  // bool requeue = 5;
+  void clear_requeue();
+  bool requeue() const;
+  void set_requeue(bool value);
+  private:
+  bool _internal_requeue() const;
+  void _internal_set_requeue(bool value);
+  public:
+
+  // bool multiple = 7;
+  void clear_multiple();
+  bool multiple() const;
+  void set_multiple(bool value);
+  private:
+  bool _internal_multiple() const;
+  void _internal_set_multiple(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicNackRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  bool auto_ack_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_id_;
+    uint64_t delivery_tag_;
+    bool requeue_;
+    bool multiple_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicCancelRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicCancelRequest) */ {
+class basicRejectRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicRejectRequest) */ {
  public:
-  inline basicCancelRequest() : basicCancelRequest(nullptr) {}
-  ~basicCancelRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicCancelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicRejectRequest() : basicRejectRequest(nullptr) {}
+  ~basicRejectRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicRejectRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicCancelRequest(const basicCancelRequest& from);
-  basicCancelRequest(basicCancelRequest&& from) noexcept
-    : basicCancelRequest() {
+  basicRejectRequest(const basicRejectRequest& from);
+  basicRejectRequest(basicRejectRequest&& from) noexcept
+    : basicRejectRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicCancelRequest& operator=(const basicCancelRequest& from) {
+  inline basicRejectRequest& operator=(const basicRejectRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicCancelRequest& operator=(basicCancelRequest&& from) noexcept {
+  inline basicRejectRequest& operator=(basicRejectRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2417,20 +2616,20 @@ class basicCancelRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicCancelRequest& default_instance() {
+  static const basicRejectRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicCancelRequest* internal_default_instance() {
-    return reinterpret_cast<const basicCancelRequest*>(
-               &_basicCancelRequest_default_instance_);
+  static inline const basicRejectRequest* internal_default_instance() {
+    return reinterpret_cast<const basicRejectRequest*>(
+               &_basicRejectRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(basicCancelRequest& a, basicCancelRequest& b) {
+  friend void swap(basicRejectRequest& a, basicRejectRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicCancelRequest* other) {
+  inline void Swap(basicRejectRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2443,7 +2642,7 @@ class basicCancelRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicCancelRequest* other) {
+  void UnsafeArenaSwap(basicRejectRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2451,15 +2650,17 @@ class basicCancelRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicCancelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicCancelRequest>(arena);
+  basicRejectRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicRejectRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicCancelRequest& from);
+  void CopyFrom(const basicRejectRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicCancelRequest& from);
+  void MergeFrom( const basicRejectRequest& from) {
+    basicRejectRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2468,21 +2669,21 @@ class basicCancelRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicCancelRequest* other);
+  void InternalSwap(basicRejectRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "hare_mq.basicCancelRequest";
+    return "hare_mq.basicRejectRequest";
   }
   protected:
-  explicit basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicRejectRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2498,8 +2699,10 @@ class basicCancelRequest final :
   enum : int {
     kRidFieldNumber = 1,
     kCidFieldNumber = 2,
-    kConsumerTagFieldNumber = 3,
-    kQueueNameFieldNumber = 4,
+    kQueueNameFieldNumber = 3,
+    kMessageIdFieldNumber = 4,
+    kDeliveryTagFieldNumber = 6,
+    kRequeueFieldNumber = 5,
   };
   // string rid = 1;
   void clear_rid();
@@ -2529,21 +2732,7 @@ class basicCancelRequest final :
   std::string* _internal_mutable_cid();
   public:
 
-  // string consumer_tag = 3;
-  void clear_consumer_tag();
-  const std::string& consumer_tag() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_consumer_tag();
-  PROTOBUF_NODISCARD std::string* release_consumer_tag();
-  void set_allocated_consumer_tag(std::string* consumer_tag);
-  private:
-  const std::string& _internal_consumer_tag() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
-  std::string* _internal_mutable_consumer_tag();
-  public:
-
-  // string queue_name = 4;
+  // string queue_name = 3;
   void clear_queue_name();
   const std::string& queue_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -2557,40 +2746,77 @@ class basicCancelRequest final :
   std::string* _internal_mutable_queue_name();
   public:
 
-  // @@protoc_insertion_point(class_scope:hare_mq.basicCancelRequest)
+  // string message_id = 4;
+  void clear_message_id();
+  const std::string& message_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message_id();
+  PROTOBUF_NODISCARD std::string* release_message_id();
+  void set_allocated_message_id(std::string* message_id);
+  private:
+  const std::string& _internal_message_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_id(const std::string& value);
+  std::string* _internal_mutable_message_id();
+  public:
+
+  // uint64 delivery_tag = 6;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
+  // bool requeue = 5;
+  void clear_requeue();
+  bool requeue() const;
+  void set_requeue(bool value);
+  private:
+  bool _internal_requeue() const;
+  void _internal_set_requeue(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicRejectRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_id_;
+    uint64_t delivery_tag_;
+    bool requeue_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicConsumeResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicConsumeResponse) */ {
+class basicConsumeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicConsumeRequest) */ {
  public:
-  inline basicConsumeResponse() : basicConsumeResponse(nullptr) {}
-  ~basicConsumeResponse() override;
-  explicit PROTOBUF_CONSTEXPR basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicConsumeRequest() : basicConsumeRequest(nullptr) {}
+  ~basicConsumeRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicConsumeResponse(const basicConsumeResponse& from);
-  basicConsumeResponse(basicConsumeResponse&& from) noexcept
-    : basicConsumeResponse() {
+  basicConsumeRequest(const basicConsumeRequest& from);
+  basicConsumeRequest(basicConsumeRequest&& from) noexcept
+    : basicConsumeRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicConsumeResponse& operator=(const basicConsumeResponse& from) {
+  inline basicConsumeRequest& operator=(const basicConsumeRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicConsumeResponse& operator=(basicConsumeResponse&& from) noexcept {
+  inline basicConsumeRequest& operator=(basicConsumeRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2613,20 +2839,20 @@ class basicConsumeResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicConsumeResponse& default_instance() {
+  static const basicConsumeRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicConsumeResponse* internal_default_instance() {
-    return reinterpret_cast<const basicConsumeResponse*>(
-               &_basicConsumeResponse_default_instance_);
+  static inline const basicConsumeRequest* internal_default_instance() {
+    return reinterpret_cast<const basicConsumeRequest*>(
+               &_basicConsumeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(basicConsumeResponse& a, basicConsumeResponse& b) {
+  friend void swap(basicConsumeRequest& a, basicConsumeRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicConsumeResponse* other) {
+  inline void Swap(basicConsumeRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2639,7 +2865,7 @@ class basicConsumeResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicConsumeResponse* other) {
+  void UnsafeArenaSwap(basicConsumeRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2647,15 +2873,17 @@ class basicConsumeResponse final :
 
   // implements Message ----------------------------------------------
 
-  basicConsumeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicConsumeResponse>(arena);
+  basicConsumeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConsumeRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicConsumeResponse& from);
+  void CopyFrom(const basicConsumeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicConsumeResponse& from);
+  void MergeFrom( const basicConsumeRequest& from) {
+    basicConsumeRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2664,21 +2892,21 @@ class basicConsumeResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicConsumeResponse* other);
+  void InternalSwap(basicConsumeRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "hare_mq.basicConsumeResponse";
+    return "hare_mq.basicConsumeRequest";
   }
   protected:
-  explicit basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2692,12 +2920,27 @@ class basicConsumeResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCidFieldNumber = 1,
-    kConsumerTagFieldNumber = 2,
-    kBodyFieldNumber = 3,
-    kPropertiesFieldNumber = 4,
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kConsumerTagFieldNumber = 3,
+    kQueueNameFieldNumber = 4,
+    kAutoAckFieldNumber = 5,
   };
-  // string cid = 1;
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
   void clear_cid();
   const std::string& cid() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -2711,7 +2954,7 @@ class basicConsumeResponse final :
   std::string* _internal_mutable_cid();
   public:
 
-  // string consumer_tag = 2;
+  // string consumer_tag = 3;
   void clear_consumer_tag();
   const std::string& consumer_tag() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -2725,72 +2968,67 @@ class basicConsumeResponse final :
   std::string* _internal_mutable_consumer_tag();
   public:
 
-  // string body = 3;
-  void clear_body();
-  const std::string& body() const;
+  // string queue_name = 4;
+  void clear_queue_name();
+  const std::string& queue_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_body(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_body();
-  PROTOBUF_NODISCARD std::string* release_body();
-  void set_allocated_body(std::string* body);
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
   private:
-  const std::string& _internal_body() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
-  std::string* _internal_mutable_body();
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
   public:
 
-  // .hare_mq.BasicProperties properties = 4;
-  bool has_properties() const;
-  private:
-  bool _internal_has_properties() const;
-  public:
-  void clear_properties();
-  const ::hare_mq::BasicProperties& properties() const;
-  PROTOBUF_NODISCARD ::hare_mq::BasicProperties* release_properties();
-  ::hare_mq::BasicProperties* mutable_properties();
-  void set_allocated_properties(::hare_mq::BasicProperties* properties);
+  // bool auto_ack = 5;
+  void clear_auto_ack();
+  bool auto_ack() const;
+  void set_auto_ack(bool value);
   private:
-  const ::hare_mq::BasicProperties& _internal_properties() const;
-  ::hare_mq::BasicProperties* _internal_mutable_properties();
+  bool _internal_auto_ack() const;
+  void _internal_set_auto_ack(bool value);
   public:
-  void unsafe_arena_set_allocated_properties(
-      ::hare_mq::BasicProperties* properties);
-  ::hare_mq::BasicProperties* unsafe_arena_release_properties();
 
-  // @@protoc_insertion_point(class_scope:hare_mq.basicConsumeResponse)
+  // @@protoc_insertion_point(class_scope:hare_mq.basicConsumeRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  ::hare_mq::BasicProperties* properties_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    bool auto_ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicCommonResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicCommonResponse) */ {
+class basicCancelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicCancelRequest) */ {
  public:
-  inline basicCommonResponse() : basicCommonResponse(nullptr) {}
-  ~basicCommonResponse() override;
-  explicit PROTOBUF_CONSTEXPR basicCommonResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicCancelRequest() : basicCancelRequest(nullptr) {}
+  ~basicCancelRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicCancelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicCommonResponse(const basicCommonResponse& from);
-  basicCommonResponse(basicCommonResponse&& from) noexcept
-    : basicCommonResponse() {
+  basicCancelRequest(const basicCancelRequest& from);
+  basicCancelRequest(basicCancelRequest&& from) noexcept
+    : basicCancelRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicCommonResponse& operator=(const basicCommonResponse& from) {
+  inline basicCancelRequest& operator=(const basicCancelRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicCommonResponse& operator=(basicCommonResponse&& from) noexcept {
+  inline basicCancelRequest& operator=(basicCancelRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2813,20 +3051,20 @@ class basicCommonResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicCommonResponse& default_instance() {
+  static const basicCancelRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicCommonResponse* internal_default_instance() {
-    return reinterpret_cast<const basicCommonResponse*>(
-               &_basicCommonResponse_default_instance_);
+  static inline const basicCancelRequest* internal_default_instance() {
+    return reinterpret_cast<const basicCancelRequest*>(
+               &_basicCancelRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(basicCommonResponse& a, basicCommonResponse& b) {
+  friend void swap(basicCancelRequest& a, basicCancelRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicCommonResponse* other) {
+  inline void Swap(basicCancelRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2839,7 +3077,7 @@ class basicCommonResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicCommonResponse* other) {
+  void UnsafeArenaSwap(basicCancelRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2847,15 +3085,17 @@ class basicCommonResponse final :
 
   // implements Message ----------------------------------------------
 
-  basicCommonResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicCommonResponse>(arena);
+  basicCancelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicCancelRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicCommonResponse& from);
+  void CopyFrom(const basicCancelRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicCommonResponse& from);
+  void MergeFrom( const basicCancelRequest& from) {
+    basicCancelRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2864,21 +3104,21 @@ class basicCommonResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicCommonResponse* other);
+  void InternalSwap(basicCancelRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "hare_mq.basicCommonResponse";
+    return "hare_mq.basicCancelRequest";
   }
   protected:
-  explicit basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2894,7 +3134,8 @@ class basicCommonResponse final :
   enum : int {
     kRidFieldNumber = 1,
     kCidFieldNumber = 2,
-    kOkFieldNumber = 3,
+    kConsumerTagFieldNumber = 3,
+    kQueueNameFieldNumber = 4,
   };
   // string rid = 1;
   void clear_rid();
@@ -2924,48 +3165,71 @@ class basicCommonResponse final :
   std::string* _internal_mutable_cid();
   public:
 
-  // bool ok = 3;
-  void clear_ok();
-  bool ok() const;
-  void set_ok(bool value);
+  // string consumer_tag = 3;
+  void clear_consumer_tag();
+  const std::string& consumer_tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumer_tag();
+  PROTOBUF_NODISCARD std::string* release_consumer_tag();
+  void set_allocated_consumer_tag(std::string* consumer_tag);
   private:
-  bool _internal_ok() const;
-  void _internal_set_ok(bool value);
+  const std::string& _internal_consumer_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
+  std::string* _internal_mutable_consumer_tag();
   public:
 
-  // @@protoc_insertion_point(class_scope:hare_mq.basicCommonResponse)
+  // string queue_name = 4;
+  void clear_queue_name();
+  const std::string& queue_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
+  private:
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicCancelRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  bool ok_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicQueryRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicQueryRequest) */ {
+class basicConsumeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicConsumeResponse) */ {
  public:
-  inline basicQueryRequest() : basicQueryRequest(nullptr) {}
-  ~basicQueryRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicQueryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicConsumeResponse() : basicConsumeResponse(nullptr) {}
+  ~basicConsumeResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicQueryRequest(const basicQueryRequest& from);
-  basicQueryRequest(basicQueryRequest&& from) noexcept
-    : basicQueryRequest() {
+  basicConsumeResponse(const basicConsumeResponse& from);
+  basicConsumeResponse(basicConsumeResponse&& from) noexcept
+    : basicConsumeResponse() {
     *this = ::std::move(from);
   }
 
-  inline basicQueryRequest& operator=(const basicQueryRequest& from) {
+  inline basicConsumeResponse& operator=(const basicConsumeResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicQueryRequest& operator=(basicQueryRequest&& from) noexcept {
+  inline basicConsumeResponse& operator=(basicConsumeResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2988,20 +3252,20 @@ class basicQueryRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicQueryRequest& default_instance() {
+  static const basicConsumeResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicQueryRequest* internal_default_instance() {
-    return reinterpret_cast<const basicQueryRequest*>(
-               &_basicQueryRequest_default_instance_);
+  static inline const basicConsumeResponse* internal_default_instance() {
+    return reinterpret_cast<const basicConsumeResponse*>(
+               &_basicConsumeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(basicQueryRequest& a, basicQueryRequest& b) {
+  friend void swap(basicConsumeResponse& a, basicConsumeResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicQueryRequest* other) {
+  inline void Swap(basicConsumeResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3014,7 +3278,7 @@ class basicQueryRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicQueryRequest* other) {
+  void UnsafeArenaSwap(basicConsumeResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3022,15 +3286,17 @@ class basicQueryRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicQueryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicQueryRequest>(arena);
+  basicConsumeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConsumeResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicQueryRequest& from);
+  void CopyFrom(const basicConsumeResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicQueryRequest& from);
+  void MergeFrom( const basicConsumeResponse& from) {
+    basicConsumeResponse::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -3039,21 +3305,21 @@ class basicQueryRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicQueryRequest* other);
+  void InternalSwap(basicConsumeResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "hare_mq.basicQueryRequest";
+    return "hare_mq.basicConsumeResponse";
   }
   protected:
-  explicit basicQueryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3067,24 +3333,13 @@ class basicQueryRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
+    kCidFieldNumber = 1,
+    kConsumerTagFieldNumber = 2,
+    kBodyFieldNumber = 3,
+    kPropertiesFieldNumber = 4,
+    kDeliveryTagFieldNumber = 5,
   };
-  // string rid = 1;
-  void clear_rid();
-  const std::string& rid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_rid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_rid();
-  PROTOBUF_NODISCARD std::string* release_rid();
-  void set_allocated_rid(std::string* rid);
-  private:
-  const std::string& _internal_rid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
-  std::string* _internal_mutable_rid();
-  public:
-
-  // string cid = 2;
+  // string cid = 1;
   void clear_cid();
   const std::string& cid() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -3098,38 +3353,99 @@ class basicQueryRequest final :
   std::string* _internal_mutable_cid();
   public:
 
-  // @@protoc_insertion_point(class_scope:hare_mq.basicQueryRequest)
+  // string consumer_tag = 2;
+  void clear_consumer_tag();
+  const std::string& consumer_tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumer_tag();
+  PROTOBUF_NODISCARD std::string* release_consumer_tag();
+  void set_allocated_consumer_tag(std::string* consumer_tag);
+  private:
+  const std::string& _internal_consumer_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
+  std::string* _internal_mutable_consumer_tag();
+  public:
+
+  // string body = 3;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // .hare_mq.BasicProperties properties = 4;
+  bool has_properties() const;
+  private:
+  bool _internal_has_properties() const;
+  public:
+  void clear_properties();
+  const ::hare_mq::BasicProperties& properties() const;
+  PROTOBUF_NODISCARD ::hare_mq::BasicProperties* release_properties();
+  ::hare_mq::BasicProperties* mutable_properties();
+  void set_allocated_properties(::hare_mq::BasicProperties* properties);
+  private:
+  const ::hare_mq::BasicProperties& _internal_properties() const;
+  ::hare_mq::BasicProperties* _internal_mutable_properties();
+  public:
+  void unsafe_arena_set_allocated_properties(
+      ::hare_mq::BasicProperties* properties);
+  ::hare_mq::BasicProperties* unsafe_arena_release_properties();
+
+  // uint64 delivery_tag = 5;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicConsumeResponse)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::hare_mq::BasicProperties* properties_;
+    uint64_t delivery_tag_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicQueryResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicQueryResponse) */ {
+class basicGetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicGetRequest) */ {
  public:
-  inline basicQueryResponse() : basicQueryResponse(nullptr) {}
-  ~basicQueryResponse() override;
-  explicit PROTOBUF_CONSTEXPR basicQueryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicGetRequest() : basicGetRequest(nullptr) {}
+  ~basicGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicQueryResponse(const basicQueryResponse& from);
-  basicQueryResponse(basicQueryResponse&& from) noexcept
-    : basicQueryResponse() {
+  basicGetRequest(const basicGetRequest& from);
+  basicGetRequest(basicGetRequest&& from) noexcept
+    : basicGetRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicQueryResponse& operator=(const basicQueryResponse& from) {
+  inline basicGetRequest& operator=(const basicGetRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicQueryResponse& operator=(basicQueryResponse&& from) noexcept {
+  inline basicGetRequest& operator=(basicGetRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3152,20 +3468,20 @@ class basicQueryResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicQueryResponse& default_instance() {
+  static const basicGetRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicQueryResponse* internal_default_instance() {
-    return reinterpret_cast<const basicQueryResponse*>(
-               &_basicQueryResponse_default_instance_);
+  static inline const basicGetRequest* internal_default_instance() {
+    return reinterpret_cast<const basicGetRequest*>(
+               &_basicGetRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     17;
 
-  friend void swap(basicQueryResponse& a, basicQueryResponse& b) {
+  friend void swap(basicGetRequest& a, basicGetRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicQueryResponse* other) {
+  inline void Swap(basicGetRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3178,7 +3494,7 @@ class basicQueryResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicQueryResponse* other) {
+  void UnsafeArenaSwap(basicGetRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3186,15 +3502,17 @@ class basicQueryResponse final :
 
   // implements Message ----------------------------------------------
 
-  basicQueryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicQueryResponse>(arena);
+  basicGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicGetRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicQueryResponse& from);
+  void CopyFrom(const basicGetRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicQueryResponse& from);
+  void MergeFrom( const basicGetRequest& from) {
+    basicGetRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -3203,21 +3521,21 @@ class basicQueryResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicQueryResponse* other);
+  void InternalSwap(basicGetRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "hare_mq.basicQueryResponse";
+    return "hare_mq.basicGetRequest";
   }
   protected:
-  explicit basicQueryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3233,7 +3551,10 @@ class basicQueryResponse final :
   enum : int {
     kRidFieldNumber = 1,
     kCidFieldNumber = 2,
-    kBodyFieldNumber = 3,
+    kQueueNameFieldNumber = 3,
+    kMaxBytesFieldNumber = 5,
+    kMaxCountFieldNumber = 4,
+    kAutoAckFieldNumber = 6,
   };
   // string rid = 1;
   void clear_rid();
@@ -3263,3044 +3584,9992 @@ class basicQueryResponse final :
   std::string* _internal_mutable_cid();
   public:
 
-  // string body = 3;
-  void clear_body();
-  const std::string& body() const;
+  // string queue_name = 3;
+  void clear_queue_name();
+  const std::string& queue_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_body(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_body();
-  PROTOBUF_NODISCARD std::string* release_body();
-  void set_allocated_body(std::string* body);
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
   private:
-  const std::string& _internal_body() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
-  std::string* _internal_mutable_body();
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
   public:
 
-  // @@protoc_insertion_point(class_scope:hare_mq.basicQueryResponse)
+  // uint64 max_bytes = 5;
+  void clear_max_bytes();
+  uint64_t max_bytes() const;
+  void set_max_bytes(uint64_t value);
+  private:
+  uint64_t _internal_max_bytes() const;
+  void _internal_set_max_bytes(uint64_t value);
+  public:
+
+  // uint32 max_count = 4;
+  void clear_max_count();
+  uint32_t max_count() const;
+  void set_max_count(uint32_t value);
+  private:
+  uint32_t _internal_max_count() const;
+  void _internal_set_max_count(uint32_t value);
+  public:
+
+  // bool auto_ack = 6;
+  void clear_auto_ack();
+  bool auto_ack() const;
+  void set_auto_ack(bool value);
+  private:
+  bool _internal_auto_ack() const;
+  void _internal_set_auto_ack(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicGetRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    uint64_t max_bytes_;
+    uint32_t max_count_;
+    bool auto_ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
+
+class basicGetResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicGetResponse) */ {
+ public:
+  inline basicGetResponse() : basicGetResponse(nullptr) {}
+  ~basicGetResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicGetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicGetResponse(const basicGetResponse& from);
+  basicGetResponse(basicGetResponse&& from) noexcept
+    : basicGetResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicGetResponse& operator=(const basicGetResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicGetResponse& operator=(basicGetResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicGetResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicGetResponse* internal_default_instance() {
+    return reinterpret_cast<const basicGetResponse*>(
+               &_basicGetResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(basicGetResponse& a, basicGetResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicGetResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicGetResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicGetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicGetResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicGetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicGetResponse& from) {
+    basicGetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicGetResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.basicGetResponse";
+  }
+  protected:
+  explicit basicGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 4,
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kOkFieldNumber = 3,
+  };
+  // repeated .hare_mq.basicConsumeResponse messages = 4;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::hare_mq::basicConsumeResponse* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::basicConsumeResponse >*
+      mutable_messages();
+  private:
+  const ::hare_mq::basicConsumeResponse& _internal_messages(int index) const;
+  ::hare_mq::basicConsumeResponse* _internal_add_messages();
+  public:
+  const ::hare_mq::basicConsumeResponse& messages(int index) const;
+  ::hare_mq::basicConsumeResponse* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::basicConsumeResponse >&
+      messages() const;
+
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // bool ok = 3;
+  void clear_ok();
+  bool ok() const;
+  void set_ok(bool value);
+  private:
+  bool _internal_ok() const;
+  void _internal_set_ok(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicGetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::basicConsumeResponse > messages_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    bool ok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicCommonResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicCommonResponse) */ {
+ public:
+  inline basicCommonResponse() : basicCommonResponse(nullptr) {}
+  ~basicCommonResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicCommonResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicCommonResponse(const basicCommonResponse& from);
+  basicCommonResponse(basicCommonResponse&& from) noexcept
+    : basicCommonResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicCommonResponse& operator=(const basicCommonResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicCommonResponse& operator=(basicCommonResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicCommonResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicCommonResponse* internal_default_instance() {
+    return reinterpret_cast<const basicCommonResponse*>(
+               &_basicCommonResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(basicCommonResponse& a, basicCommonResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicCommonResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicCommonResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicCommonResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicCommonResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicCommonResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicCommonResponse& from) {
+    basicCommonResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicCommonResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.basicCommonResponse";
+  }
+  protected:
+  explicit basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kOkFieldNumber = 3,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // bool ok = 3;
+  void clear_ok();
+  bool ok() const;
+  void set_ok(bool value);
+  private:
+  bool _internal_ok() const;
+  void _internal_set_ok(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicCommonResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    bool ok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicQueryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicQueryRequest) */ {
+ public:
+  inline basicQueryRequest() : basicQueryRequest(nullptr) {}
+  ~basicQueryRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicQueryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicQueryRequest(const basicQueryRequest& from);
+  basicQueryRequest(basicQueryRequest&& from) noexcept
+    : basicQueryRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline basicQueryRequest& operator=(const basicQueryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicQueryRequest& operator=(basicQueryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicQueryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicQueryRequest* internal_default_instance() {
+    return reinterpret_cast<const basicQueryRequest*>(
+               &_basicQueryRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(basicQueryRequest& a, basicQueryRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicQueryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicQueryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicQueryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicQueryRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicQueryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicQueryRequest& from) {
+    basicQueryRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicQueryRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.basicQueryRequest";
+  }
+  protected:
+  explicit basicQueryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicQueryRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicQueryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.basicQueryResponse) */ {
+ public:
+  inline basicQueryResponse() : basicQueryResponse(nullptr) {}
+  ~basicQueryResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicQueryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicQueryResponse(const basicQueryResponse& from);
+  basicQueryResponse(basicQueryResponse&& from) noexcept
+    : basicQueryResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicQueryResponse& operator=(const basicQueryResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicQueryResponse& operator=(basicQueryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicQueryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicQueryResponse* internal_default_instance() {
+    return reinterpret_cast<const basicQueryResponse*>(
+               &_basicQueryResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(basicQueryResponse& a, basicQueryResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicQueryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicQueryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicQueryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicQueryResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicQueryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicQueryResponse& from) {
+    basicQueryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicQueryResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.basicQueryResponse";
+  }
+  protected:
+  explicit basicQueryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kBodyFieldNumber = 3,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // string body = 3;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.basicQueryResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class heartbeatRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.heartbeatRequest) */ {
+ public:
+  inline heartbeatRequest() : heartbeatRequest(nullptr) {}
+  ~heartbeatRequest() override;
+  explicit PROTOBUF_CONSTEXPR heartbeatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  heartbeatRequest(const heartbeatRequest& from);
+  heartbeatRequest(heartbeatRequest&& from) noexcept
+    : heartbeatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline heartbeatRequest& operator=(const heartbeatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline heartbeatRequest& operator=(heartbeatRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const heartbeatRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const heartbeatRequest* internal_default_instance() {
+    return reinterpret_cast<const heartbeatRequest*>(
+               &_heartbeatRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(heartbeatRequest& a, heartbeatRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(heartbeatRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(heartbeatRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  heartbeatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<heartbeatRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const heartbeatRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const heartbeatRequest& from) {
+    heartbeatRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(heartbeatRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.heartbeatRequest";
+  }
+  protected:
+  explicit heartbeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kIntervalFieldNumber = 2,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // uint32 interval = 2;
+  void clear_interval();
+  uint32_t interval() const;
+  void set_interval(uint32_t value);
+  private:
+  uint32_t _internal_interval() const;
+  void _internal_set_interval(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.heartbeatRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t interval_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class heartbeatResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.heartbeatResponse) */ {
+ public:
+  inline heartbeatResponse() : heartbeatResponse(nullptr) {}
+  ~heartbeatResponse() override;
+  explicit PROTOBUF_CONSTEXPR heartbeatResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  heartbeatResponse(const heartbeatResponse& from);
+  heartbeatResponse(heartbeatResponse&& from) noexcept
+    : heartbeatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline heartbeatResponse& operator=(const heartbeatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline heartbeatResponse& operator=(heartbeatResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const heartbeatResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const heartbeatResponse* internal_default_instance() {
+    return reinterpret_cast<const heartbeatResponse*>(
+               &_heartbeatResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(heartbeatResponse& a, heartbeatResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(heartbeatResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(heartbeatResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  heartbeatResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<heartbeatResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const heartbeatResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const heartbeatResponse& from) {
+    heartbeatResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(heartbeatResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.heartbeatResponse";
+  }
+  protected:
+  explicit heartbeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kIntervalFieldNumber = 2,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // uint32 interval = 2;
+  void clear_interval();
+  uint32_t interval() const;
+  void set_interval(uint32_t value);
+  private:
+  uint32_t _internal_interval() const;
+  void _internal_set_interval(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.heartbeatResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t interval_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class heartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.heartbeat) */ {
+ public:
+  inline heartbeat() : heartbeat(nullptr) {}
+  ~heartbeat() override;
+  explicit PROTOBUF_CONSTEXPR heartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  heartbeat(const heartbeat& from);
+  heartbeat(heartbeat&& from) noexcept
+    : heartbeat() {
+    *this = ::std::move(from);
+  }
+
+  inline heartbeat& operator=(const heartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline heartbeat& operator=(heartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const heartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const heartbeat* internal_default_instance() {
+    return reinterpret_cast<const heartbeat*>(
+               &_heartbeat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(heartbeat& a, heartbeat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(heartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(heartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  heartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<heartbeat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const heartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const heartbeat& from) {
+    heartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(heartbeat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.heartbeat";
+  }
+  protected:
+  explicit heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimestampFieldNumber = 1,
+  };
+  // uint64 timestamp = 1;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.heartbeat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class metricsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.metricsRequest) */ {
+ public:
+  inline metricsRequest() : metricsRequest(nullptr) {}
+  ~metricsRequest() override;
+  explicit PROTOBUF_CONSTEXPR metricsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  metricsRequest(const metricsRequest& from);
+  metricsRequest(metricsRequest&& from) noexcept
+    : metricsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline metricsRequest& operator=(const metricsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline metricsRequest& operator=(metricsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const metricsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const metricsRequest* internal_default_instance() {
+    return reinterpret_cast<const metricsRequest*>(
+               &_metricsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(metricsRequest& a, metricsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(metricsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(metricsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  metricsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<metricsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const metricsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const metricsRequest& from) {
+    metricsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(metricsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.metricsRequest";
+  }
+  protected:
+  explicit metricsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kPrometheusTextFieldNumber = 3,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // bool prometheus_text = 3;
+  void clear_prometheus_text();
+  bool prometheus_text() const;
+  void set_prometheus_text(bool value);
+  private:
+  bool _internal_prometheus_text() const;
+  void _internal_set_prometheus_text(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.metricsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    bool prometheus_text_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class metricCounter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.metricCounter) */ {
+ public:
+  inline metricCounter() : metricCounter(nullptr) {}
+  ~metricCounter() override;
+  explicit PROTOBUF_CONSTEXPR metricCounter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  metricCounter(const metricCounter& from);
+  metricCounter(metricCounter&& from) noexcept
+    : metricCounter() {
+    *this = ::std::move(from);
+  }
+
+  inline metricCounter& operator=(const metricCounter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline metricCounter& operator=(metricCounter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const metricCounter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const metricCounter* internal_default_instance() {
+    return reinterpret_cast<const metricCounter*>(
+               &_metricCounter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(metricCounter& a, metricCounter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(metricCounter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(metricCounter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  metricCounter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<metricCounter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const metricCounter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const metricCounter& from) {
+    metricCounter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(metricCounter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.metricCounter";
+  }
+  protected:
+  explicit metricCounter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 value = 2;
+  void clear_value();
+  uint64_t value() const;
+  void set_value(uint64_t value);
+  private:
+  uint64_t _internal_value() const;
+  void _internal_set_value(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.metricCounter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class metricHistogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.metricHistogram) */ {
+ public:
+  inline metricHistogram() : metricHistogram(nullptr) {}
+  ~metricHistogram() override;
+  explicit PROTOBUF_CONSTEXPR metricHistogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  metricHistogram(const metricHistogram& from);
+  metricHistogram(metricHistogram&& from) noexcept
+    : metricHistogram() {
+    *this = ::std::move(from);
+  }
+
+  inline metricHistogram& operator=(const metricHistogram& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline metricHistogram& operator=(metricHistogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const metricHistogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const metricHistogram* internal_default_instance() {
+    return reinterpret_cast<const metricHistogram*>(
+               &_metricHistogram_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(metricHistogram& a, metricHistogram& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(metricHistogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(metricHistogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  metricHistogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<metricHistogram>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const metricHistogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const metricHistogram& from) {
+    metricHistogram::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(metricHistogram* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.metricHistogram";
+  }
+  protected:
+  explicit metricHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kSumFieldNumber = 3,
+    kP50FieldNumber = 4,
+    kP90FieldNumber = 5,
+    kP99FieldNumber = 6,
+    kP999FieldNumber = 7,
+    kMaxFieldNumber = 8,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 sum = 3;
+  void clear_sum();
+  uint64_t sum() const;
+  void set_sum(uint64_t value);
+  private:
+  uint64_t _internal_sum() const;
+  void _internal_set_sum(uint64_t value);
+  public:
+
+  // uint64 p50 = 4;
+  void clear_p50();
+  uint64_t p50() const;
+  void set_p50(uint64_t value);
+  private:
+  uint64_t _internal_p50() const;
+  void _internal_set_p50(uint64_t value);
+  public:
+
+  // uint64 p90 = 5;
+  void clear_p90();
+  uint64_t p90() const;
+  void set_p90(uint64_t value);
+  private:
+  uint64_t _internal_p90() const;
+  void _internal_set_p90(uint64_t value);
+  public:
+
+  // uint64 p99 = 6;
+  void clear_p99();
+  uint64_t p99() const;
+  void set_p99(uint64_t value);
+  private:
+  uint64_t _internal_p99() const;
+  void _internal_set_p99(uint64_t value);
+  public:
+
+  // uint64 p999 = 7;
+  void clear_p999();
+  uint64_t p999() const;
+  void set_p999(uint64_t value);
+  private:
+  uint64_t _internal_p999() const;
+  void _internal_set_p999(uint64_t value);
+  public:
+
+  // uint64 max = 8;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.metricHistogram)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t count_;
+    uint64_t sum_;
+    uint64_t p50_;
+    uint64_t p90_;
+    uint64_t p99_;
+    uint64_t p999_;
+    uint64_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class queueMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.queueMetrics) */ {
+ public:
+  inline queueMetrics() : queueMetrics(nullptr) {}
+  ~queueMetrics() override;
+  explicit PROTOBUF_CONSTEXPR queueMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  queueMetrics(const queueMetrics& from);
+  queueMetrics(queueMetrics&& from) noexcept
+    : queueMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline queueMetrics& operator=(const queueMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline queueMetrics& operator=(queueMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const queueMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const queueMetrics* internal_default_instance() {
+    return reinterpret_cast<const queueMetrics*>(
+               &_queueMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(queueMetrics& a, queueMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(queueMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(queueMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  queueMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<queueMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const queueMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const queueMetrics& from) {
+    queueMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(queueMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.queueMetrics";
+  }
+  protected:
+  explicit queueMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kDepthFieldNumber = 2,
+    kUnackedFieldNumber = 3,
+    kDiskBytesFieldNumber = 4,
+    kPublishedFieldNumber = 5,
+    kDeliveredFieldNumber = 6,
+    kAckedFieldNumber = 7,
+    kRedeliveredFieldNumber = 8,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 depth = 2;
+  void clear_depth();
+  uint64_t depth() const;
+  void set_depth(uint64_t value);
+  private:
+  uint64_t _internal_depth() const;
+  void _internal_set_depth(uint64_t value);
+  public:
+
+  // uint64 unacked = 3;
+  void clear_unacked();
+  uint64_t unacked() const;
+  void set_unacked(uint64_t value);
+  private:
+  uint64_t _internal_unacked() const;
+  void _internal_set_unacked(uint64_t value);
+  public:
+
+  // uint64 disk_bytes = 4;
+  void clear_disk_bytes();
+  uint64_t disk_bytes() const;
+  void set_disk_bytes(uint64_t value);
+  private:
+  uint64_t _internal_disk_bytes() const;
+  void _internal_set_disk_bytes(uint64_t value);
+  public:
+
+  // uint64 published = 5;
+  void clear_published();
+  uint64_t published() const;
+  void set_published(uint64_t value);
+  private:
+  uint64_t _internal_published() const;
+  void _internal_set_published(uint64_t value);
+  public:
+
+  // uint64 delivered = 6;
+  void clear_delivered();
+  uint64_t delivered() const;
+  void set_delivered(uint64_t value);
+  private:
+  uint64_t _internal_delivered() const;
+  void _internal_set_delivered(uint64_t value);
+  public:
+
+  // uint64 acked = 7;
+  void clear_acked();
+  uint64_t acked() const;
+  void set_acked(uint64_t value);
+  private:
+  uint64_t _internal_acked() const;
+  void _internal_set_acked(uint64_t value);
+  public:
+
+  // uint64 redelivered = 8;
+  void clear_redelivered();
+  uint64_t redelivered() const;
+  void set_redelivered(uint64_t value);
+  private:
+  uint64_t _internal_redelivered() const;
+  void _internal_set_redelivered(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.queueMetrics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t depth_;
+    uint64_t unacked_;
+    uint64_t disk_bytes_;
+    uint64_t published_;
+    uint64_t delivered_;
+    uint64_t acked_;
+    uint64_t redelivered_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class metricsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.metricsResponse) */ {
+ public:
+  inline metricsResponse() : metricsResponse(nullptr) {}
+  ~metricsResponse() override;
+  explicit PROTOBUF_CONSTEXPR metricsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  metricsResponse(const metricsResponse& from);
+  metricsResponse(metricsResponse&& from) noexcept
+    : metricsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline metricsResponse& operator=(const metricsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline metricsResponse& operator=(metricsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const metricsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const metricsResponse* internal_default_instance() {
+    return reinterpret_cast<const metricsResponse*>(
+               &_metricsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(metricsResponse& a, metricsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(metricsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(metricsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  metricsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<metricsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const metricsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const metricsResponse& from) {
+    metricsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(metricsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.metricsResponse";
+  }
+  protected:
+  explicit metricsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountersFieldNumber = 4,
+    kHistogramsFieldNumber = 5,
+    kQueuesFieldNumber = 6,
+    kRequestsFieldNumber = 8,
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kTextFieldNumber = 7,
+    kOkFieldNumber = 3,
+  };
+  // repeated .hare_mq.metricCounter counters = 4;
+  int counters_size() const;
+  private:
+  int _internal_counters_size() const;
+  public:
+  void clear_counters();
+  ::hare_mq::metricCounter* mutable_counters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricCounter >*
+      mutable_counters();
+  private:
+  const ::hare_mq::metricCounter& _internal_counters(int index) const;
+  ::hare_mq::metricCounter* _internal_add_counters();
+  public:
+  const ::hare_mq::metricCounter& counters(int index) const;
+  ::hare_mq::metricCounter* add_counters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricCounter >&
+      counters() const;
+
+  // repeated .hare_mq.metricHistogram histograms = 5;
+  int histograms_size() const;
+  private:
+  int _internal_histograms_size() const;
+  public:
+  void clear_histograms();
+  ::hare_mq::metricHistogram* mutable_histograms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >*
+      mutable_histograms();
+  private:
+  const ::hare_mq::metricHistogram& _internal_histograms(int index) const;
+  ::hare_mq::metricHistogram* _internal_add_histograms();
+  public:
+  const ::hare_mq::metricHistogram& histograms(int index) const;
+  ::hare_mq::metricHistogram* add_histograms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >&
+      histograms() const;
+
+  // repeated .hare_mq.queueMetrics queues = 6;
+  int queues_size() const;
+  private:
+  int _internal_queues_size() const;
+  public:
+  void clear_queues();
+  ::hare_mq::queueMetrics* mutable_queues(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueMetrics >*
+      mutable_queues();
+  private:
+  const ::hare_mq::queueMetrics& _internal_queues(int index) const;
+  ::hare_mq::queueMetrics* _internal_add_queues();
+  public:
+  const ::hare_mq::queueMetrics& queues(int index) const;
+  ::hare_mq::queueMetrics* add_queues();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueMetrics >&
+      queues() const;
+
+  // repeated .hare_mq.metricHistogram requests = 8;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::hare_mq::metricHistogram* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >*
+      mutable_requests();
+  private:
+  const ::hare_mq::metricHistogram& _internal_requests(int index) const;
+  ::hare_mq::metricHistogram* _internal_add_requests();
+  public:
+  const ::hare_mq::metricHistogram& requests(int index) const;
+  ::hare_mq::metricHistogram* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >&
+      requests() const;
+
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // string text = 7;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // bool ok = 3;
+  void clear_ok();
+  bool ok() const;
+  void set_ok(bool value);
+  private:
+  bool _internal_ok() const;
+  void _internal_set_ok(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.metricsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricCounter > counters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram > histograms_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueMetrics > queues_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram > requests_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    bool ok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class statsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.statsRequest) */ {
+ public:
+  inline statsRequest() : statsRequest(nullptr) {}
+  ~statsRequest() override;
+  explicit PROTOBUF_CONSTEXPR statsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  statsRequest(const statsRequest& from);
+  statsRequest(statsRequest&& from) noexcept
+    : statsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline statsRequest& operator=(const statsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline statsRequest& operator=(statsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const statsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const statsRequest* internal_default_instance() {
+    return reinterpret_cast<const statsRequest*>(
+               &_statsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(statsRequest& a, statsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(statsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(statsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  statsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<statsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const statsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const statsRequest& from) {
+    statsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(statsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.statsRequest";
+  }
+  protected:
+  explicit statsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kNamePrefixFieldNumber = 4,
+    kSectionFieldNumber = 3,
+    kIncludeBindingsFieldNumber = 5,
+    kOffsetFieldNumber = 6,
+    kLimitFieldNumber = 7,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // string name_prefix = 4;
+  void clear_name_prefix();
+  const std::string& name_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name_prefix();
+  PROTOBUF_NODISCARD std::string* release_name_prefix();
+  void set_allocated_name_prefix(std::string* name_prefix);
+  private:
+  const std::string& _internal_name_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name_prefix(const std::string& value);
+  std::string* _internal_mutable_name_prefix();
+  public:
+
+  // .hare_mq.StatsSection section = 3;
+  void clear_section();
+  ::hare_mq::StatsSection section() const;
+  void set_section(::hare_mq::StatsSection value);
+  private:
+  ::hare_mq::StatsSection _internal_section() const;
+  void _internal_set_section(::hare_mq::StatsSection value);
+  public:
+
+  // bool include_bindings = 5;
+  void clear_include_bindings();
+  bool include_bindings() const;
+  void set_include_bindings(bool value);
+  private:
+  bool _internal_include_bindings() const;
+  void _internal_set_include_bindings(bool value);
+  public:
+
+  // uint32 offset = 6;
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // uint32 limit = 7;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
+  private:
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.statsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_prefix_;
+    int section_;
+    bool include_bindings_;
+    uint32_t offset_;
+    uint32_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class bindingStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.bindingStats) */ {
+ public:
+  inline bindingStats() : bindingStats(nullptr) {}
+  ~bindingStats() override;
+  explicit PROTOBUF_CONSTEXPR bindingStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  bindingStats(const bindingStats& from);
+  bindingStats(bindingStats&& from) noexcept
+    : bindingStats() {
+    *this = ::std::move(from);
+  }
+
+  inline bindingStats& operator=(const bindingStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline bindingStats& operator=(bindingStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const bindingStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const bindingStats* internal_default_instance() {
+    return reinterpret_cast<const bindingStats*>(
+               &_bindingStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(bindingStats& a, bindingStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(bindingStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(bindingStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  bindingStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<bindingStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const bindingStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const bindingStats& from) {
+    bindingStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(bindingStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.bindingStats";
+  }
+  protected:
+  explicit bindingStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueueNameFieldNumber = 1,
+    kBindingKeyFieldNumber = 2,
+  };
+  // string queue_name = 1;
+  void clear_queue_name();
+  const std::string& queue_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
+  private:
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
+  public:
+
+  // string binding_key = 2;
+  void clear_binding_key();
+  const std::string& binding_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_binding_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binding_key();
+  PROTOBUF_NODISCARD std::string* release_binding_key();
+  void set_allocated_binding_key(std::string* binding_key);
+  private:
+  const std::string& _internal_binding_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binding_key(const std::string& value);
+  std::string* _internal_mutable_binding_key();
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.bindingStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class exchangeStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.exchangeStats) */ {
+ public:
+  inline exchangeStats() : exchangeStats(nullptr) {}
+  ~exchangeStats() override;
+  explicit PROTOBUF_CONSTEXPR exchangeStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  exchangeStats(const exchangeStats& from);
+  exchangeStats(exchangeStats&& from) noexcept
+    : exchangeStats() {
+    *this = ::std::move(from);
+  }
+
+  inline exchangeStats& operator=(const exchangeStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline exchangeStats& operator=(exchangeStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const exchangeStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const exchangeStats* internal_default_instance() {
+    return reinterpret_cast<const exchangeStats*>(
+               &_exchangeStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(exchangeStats& a, exchangeStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(exchangeStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(exchangeStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  exchangeStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<exchangeStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const exchangeStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const exchangeStats& from) {
+    exchangeStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(exchangeStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.exchangeStats";
+  }
+  protected:
+  explicit exchangeStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBindingsFieldNumber = 6,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kDurableFieldNumber = 3,
+    kAutoDeleteFieldNumber = 4,
+    kBindingCountFieldNumber = 5,
+  };
+  // repeated .hare_mq.bindingStats bindings = 6;
+  int bindings_size() const;
+  private:
+  int _internal_bindings_size() const;
+  public:
+  void clear_bindings();
+  ::hare_mq::bindingStats* mutable_bindings(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::bindingStats >*
+      mutable_bindings();
+  private:
+  const ::hare_mq::bindingStats& _internal_bindings(int index) const;
+  ::hare_mq::bindingStats* _internal_add_bindings();
+  public:
+  const ::hare_mq::bindingStats& bindings(int index) const;
+  ::hare_mq::bindingStats* add_bindings();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::bindingStats >&
+      bindings() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .hare_mq.ExchangeType type = 2;
+  void clear_type();
+  ::hare_mq::ExchangeType type() const;
+  void set_type(::hare_mq::ExchangeType value);
+  private:
+  ::hare_mq::ExchangeType _internal_type() const;
+  void _internal_set_type(::hare_mq::ExchangeType value);
+  public:
+
+  // bool durable = 3;
+  void clear_durable();
+  bool durable() const;
+  void set_durable(bool value);
+  private:
+  bool _internal_durable() const;
+  void _internal_set_durable(bool value);
+  public:
+
+  // bool auto_delete = 4;
+  void clear_auto_delete();
+  bool auto_delete() const;
+  void set_auto_delete(bool value);
+  private:
+  bool _internal_auto_delete() const;
+  void _internal_set_auto_delete(bool value);
+  public:
+
+  // uint64 binding_count = 5;
+  void clear_binding_count();
+  uint64_t binding_count() const;
+  void set_binding_count(uint64_t value);
+  private:
+  uint64_t _internal_binding_count() const;
+  void _internal_set_binding_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.exchangeStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::bindingStats > bindings_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+    bool durable_;
+    bool auto_delete_;
+    uint64_t binding_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class queueStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.queueStats) */ {
+ public:
+  inline queueStats() : queueStats(nullptr) {}
+  ~queueStats() override;
+  explicit PROTOBUF_CONSTEXPR queueStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  queueStats(const queueStats& from);
+  queueStats(queueStats&& from) noexcept
+    : queueStats() {
+    *this = ::std::move(from);
+  }
+
+  inline queueStats& operator=(const queueStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline queueStats& operator=(queueStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const queueStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const queueStats* internal_default_instance() {
+    return reinterpret_cast<const queueStats*>(
+               &_queueStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(queueStats& a, queueStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(queueStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(queueStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  queueStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<queueStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const queueStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const queueStats& from) {
+    queueStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(queueStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.queueStats";
+  }
+  protected:
+  explicit queueStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kDepthFieldNumber = 5,
+    kUnackedFieldNumber = 6,
+    kConsumerCountFieldNumber = 7,
+    kPublishedFieldNumber = 8,
+    kDeliveredFieldNumber = 9,
+    kAckedFieldNumber = 10,
+    kRedeliveredFieldNumber = 11,
+    kDurableFieldNumber = 2,
+    kExclusiveFieldNumber = 3,
+    kAutoDeleteFieldNumber = 4,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 depth = 5;
+  void clear_depth();
+  uint64_t depth() const;
+  void set_depth(uint64_t value);
+  private:
+  uint64_t _internal_depth() const;
+  void _internal_set_depth(uint64_t value);
+  public:
+
+  // uint64 unacked = 6;
+  void clear_unacked();
+  uint64_t unacked() const;
+  void set_unacked(uint64_t value);
+  private:
+  uint64_t _internal_unacked() const;
+  void _internal_set_unacked(uint64_t value);
+  public:
+
+  // uint64 consumer_count = 7;
+  void clear_consumer_count();
+  uint64_t consumer_count() const;
+  void set_consumer_count(uint64_t value);
+  private:
+  uint64_t _internal_consumer_count() const;
+  void _internal_set_consumer_count(uint64_t value);
+  public:
+
+  // uint64 published = 8;
+  void clear_published();
+  uint64_t published() const;
+  void set_published(uint64_t value);
+  private:
+  uint64_t _internal_published() const;
+  void _internal_set_published(uint64_t value);
+  public:
+
+  // uint64 delivered = 9;
+  void clear_delivered();
+  uint64_t delivered() const;
+  void set_delivered(uint64_t value);
+  private:
+  uint64_t _internal_delivered() const;
+  void _internal_set_delivered(uint64_t value);
+  public:
+
+  // uint64 acked = 10;
+  void clear_acked();
+  uint64_t acked() const;
+  void set_acked(uint64_t value);
+  private:
+  uint64_t _internal_acked() const;
+  void _internal_set_acked(uint64_t value);
+  public:
+
+  // uint64 redelivered = 11;
+  void clear_redelivered();
+  uint64_t redelivered() const;
+  void set_redelivered(uint64_t value);
+  private:
+  uint64_t _internal_redelivered() const;
+  void _internal_set_redelivered(uint64_t value);
+  public:
+
+  // bool durable = 2;
+  void clear_durable();
+  bool durable() const;
+  void set_durable(bool value);
+  private:
+  bool _internal_durable() const;
+  void _internal_set_durable(bool value);
+  public:
+
+  // bool exclusive = 3;
+  void clear_exclusive();
+  bool exclusive() const;
+  void set_exclusive(bool value);
+  private:
+  bool _internal_exclusive() const;
+  void _internal_set_exclusive(bool value);
+  public:
+
+  // bool auto_delete = 4;
+  void clear_auto_delete();
+  bool auto_delete() const;
+  void set_auto_delete(bool value);
+  private:
+  bool _internal_auto_delete() const;
+  void _internal_set_auto_delete(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.queueStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t depth_;
+    uint64_t unacked_;
+    uint64_t consumer_count_;
+    uint64_t published_;
+    uint64_t delivered_;
+    uint64_t acked_;
+    uint64_t redelivered_;
+    bool durable_;
+    bool exclusive_;
+    bool auto_delete_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class consumerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.consumerStats) */ {
+ public:
+  inline consumerStats() : consumerStats(nullptr) {}
+  ~consumerStats() override;
+  explicit PROTOBUF_CONSTEXPR consumerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  consumerStats(const consumerStats& from);
+  consumerStats(consumerStats&& from) noexcept
+    : consumerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline consumerStats& operator=(const consumerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline consumerStats& operator=(consumerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const consumerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const consumerStats* internal_default_instance() {
+    return reinterpret_cast<const consumerStats*>(
+               &_consumerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(consumerStats& a, consumerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(consumerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(consumerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  consumerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<consumerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const consumerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const consumerStats& from) {
+    consumerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(consumerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.consumerStats";
+  }
+  protected:
+  explicit consumerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTagFieldNumber = 1,
+    kQueueNameFieldNumber = 2,
+    kUnackedFieldNumber = 4,
+    kAutoAckFieldNumber = 3,
+  };
+  // string tag = 1;
+  void clear_tag();
+  const std::string& tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tag();
+  PROTOBUF_NODISCARD std::string* release_tag();
+  void set_allocated_tag(std::string* tag);
+  private:
+  const std::string& _internal_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tag(const std::string& value);
+  std::string* _internal_mutable_tag();
+  public:
+
+  // string queue_name = 2;
+  void clear_queue_name();
+  const std::string& queue_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
+  private:
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
+  public:
+
+  // uint64 unacked = 4;
+  void clear_unacked();
+  uint64_t unacked() const;
+  void set_unacked(uint64_t value);
+  private:
+  uint64_t _internal_unacked() const;
+  void _internal_set_unacked(uint64_t value);
+  public:
+
+  // bool auto_ack = 3;
+  void clear_auto_ack();
+  bool auto_ack() const;
+  void set_auto_ack(bool value);
+  private:
+  bool _internal_auto_ack() const;
+  void _internal_set_auto_ack(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.consumerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    uint64_t unacked_;
+    bool auto_ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class statsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hare_mq.statsResponse) */ {
+ public:
+  inline statsResponse() : statsResponse(nullptr) {}
+  ~statsResponse() override;
+  explicit PROTOBUF_CONSTEXPR statsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  statsResponse(const statsResponse& from);
+  statsResponse(statsResponse&& from) noexcept
+    : statsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline statsResponse& operator=(const statsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline statsResponse& operator=(statsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const statsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const statsResponse* internal_default_instance() {
+    return reinterpret_cast<const statsResponse*>(
+               &_statsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(statsResponse& a, statsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(statsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(statsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  statsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<statsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const statsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const statsResponse& from) {
+    statsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(statsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hare_mq.statsResponse";
+  }
+  protected:
+  explicit statsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExchangesFieldNumber = 5,
+    kQueuesFieldNumber = 6,
+    kConsumersFieldNumber = 7,
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kVersionFieldNumber = 4,
+    kTotalExchangesFieldNumber = 8,
+    kTotalQueuesFieldNumber = 9,
+    kTotalConsumersFieldNumber = 10,
+    kOkFieldNumber = 3,
+  };
+  // repeated .hare_mq.exchangeStats exchanges = 5;
+  int exchanges_size() const;
+  private:
+  int _internal_exchanges_size() const;
+  public:
+  void clear_exchanges();
+  ::hare_mq::exchangeStats* mutable_exchanges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::exchangeStats >*
+      mutable_exchanges();
+  private:
+  const ::hare_mq::exchangeStats& _internal_exchanges(int index) const;
+  ::hare_mq::exchangeStats* _internal_add_exchanges();
+  public:
+  const ::hare_mq::exchangeStats& exchanges(int index) const;
+  ::hare_mq::exchangeStats* add_exchanges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::exchangeStats >&
+      exchanges() const;
+
+  // repeated .hare_mq.queueStats queues = 6;
+  int queues_size() const;
+  private:
+  int _internal_queues_size() const;
+  public:
+  void clear_queues();
+  ::hare_mq::queueStats* mutable_queues(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueStats >*
+      mutable_queues();
+  private:
+  const ::hare_mq::queueStats& _internal_queues(int index) const;
+  ::hare_mq::queueStats* _internal_add_queues();
+  public:
+  const ::hare_mq::queueStats& queues(int index) const;
+  ::hare_mq::queueStats* add_queues();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueStats >&
+      queues() const;
+
+  // repeated .hare_mq.consumerStats consumers = 7;
+  int consumers_size() const;
+  private:
+  int _internal_consumers_size() const;
+  public:
+  void clear_consumers();
+  ::hare_mq::consumerStats* mutable_consumers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::consumerStats >*
+      mutable_consumers();
+  private:
+  const ::hare_mq::consumerStats& _internal_consumers(int index) const;
+  ::hare_mq::consumerStats* _internal_add_consumers();
+  public:
+  const ::hare_mq::consumerStats& consumers(int index) const;
+  ::hare_mq::consumerStats* add_consumers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::consumerStats >&
+      consumers() const;
+
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string cid = 2;
+  void clear_cid();
+  const std::string& cid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cid();
+  PROTOBUF_NODISCARD std::string* release_cid();
+  void set_allocated_cid(std::string* cid);
+  private:
+  const std::string& _internal_cid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
+  std::string* _internal_mutable_cid();
+  public:
+
+  // uint64 version = 4;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // uint64 total_exchanges = 8;
+  void clear_total_exchanges();
+  uint64_t total_exchanges() const;
+  void set_total_exchanges(uint64_t value);
+  private:
+  uint64_t _internal_total_exchanges() const;
+  void _internal_set_total_exchanges(uint64_t value);
+  public:
+
+  // uint64 total_queues = 9;
+  void clear_total_queues();
+  uint64_t total_queues() const;
+  void set_total_queues(uint64_t value);
+  private:
+  uint64_t _internal_total_queues() const;
+  void _internal_set_total_queues(uint64_t value);
+  public:
+
+  // uint64 total_consumers = 10;
+  void clear_total_consumers();
+  uint64_t total_consumers() const;
+  void set_total_consumers(uint64_t value);
+  private:
+  uint64_t _internal_total_consumers() const;
+  void _internal_set_total_consumers(uint64_t value);
+  public:
+
+  // bool ok = 3;
+  void clear_ok();
+  bool ok() const;
+  void set_ok(bool value);
+  private:
+  bool _internal_ok() const;
+  void _internal_set_ok(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hare_mq.statsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::exchangeStats > exchanges_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueStats > queues_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::consumerStats > consumers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
+    uint64_t version_;
+    uint64_t total_exchanges_;
+    uint64_t total_queues_;
+    uint64_t total_consumers_;
+    bool ok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// openChannelRequest
+
+// string rid = 1;
+inline void openChannelRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& openChannelRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.openChannelRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void openChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.openChannelRequest.rid)
+}
+inline std::string* openChannelRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.openChannelRequest.rid)
+  return _s;
+}
+inline const std::string& openChannelRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void openChannelRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* openChannelRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* openChannelRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.openChannelRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void openChannelRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.openChannelRequest.rid)
+}
+
+// string cid = 2;
+inline void openChannelRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& openChannelRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.openChannelRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void openChannelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.openChannelRequest.cid)
+}
+inline std::string* openChannelRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.openChannelRequest.cid)
+  return _s;
+}
+inline const std::string& openChannelRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void openChannelRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* openChannelRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* openChannelRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.openChannelRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void openChannelRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.openChannelRequest.cid)
+}
+
+// -------------------------------------------------------------------
+
+// closeChannelRequest
+
+// string rid = 1;
+inline void closeChannelRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& closeChannelRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.closeChannelRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void closeChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.closeChannelRequest.rid)
+}
+inline std::string* closeChannelRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.closeChannelRequest.rid)
+  return _s;
+}
+inline const std::string& closeChannelRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void closeChannelRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* closeChannelRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* closeChannelRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.closeChannelRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void closeChannelRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.closeChannelRequest.rid)
+}
+
+// string cid = 2;
+inline void closeChannelRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& closeChannelRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.closeChannelRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void closeChannelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.closeChannelRequest.cid)
+}
+inline std::string* closeChannelRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.closeChannelRequest.cid)
+  return _s;
+}
+inline const std::string& closeChannelRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void closeChannelRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* closeChannelRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* closeChannelRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.closeChannelRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void closeChannelRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.closeChannelRequest.cid)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// declareExchangeRequest
+
+// string rid = 1;
+inline void declareExchangeRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& declareExchangeRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.rid)
+}
+inline std::string* declareExchangeRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.declareExchangeRequest.rid)
+  return _s;
+}
+inline const std::string& declareExchangeRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void declareExchangeRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.declareExchangeRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void declareExchangeRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareExchangeRequest.rid)
+}
+
+// string cid = 2;
+inline void declareExchangeRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& declareExchangeRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareExchangeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.cid)
+}
+inline std::string* declareExchangeRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.declareExchangeRequest.cid)
+  return _s;
+}
+inline const std::string& declareExchangeRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void declareExchangeRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.declareExchangeRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void declareExchangeRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareExchangeRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void declareExchangeRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& declareExchangeRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.exchange_name)
+}
+inline std::string* declareExchangeRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.declareExchangeRequest.exchange_name)
+  return _s;
+}
+inline const std::string& declareExchangeRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void declareExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.declareExchangeRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void declareExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareExchangeRequest.exchange_name)
+}
+
+// .hare_mq.ExchangeType exchange_type = 4;
+inline void declareExchangeRequest::clear_exchange_type() {
+  _impl_.exchange_type_ = 0;
+}
+inline ::hare_mq::ExchangeType declareExchangeRequest::_internal_exchange_type() const {
+  return static_cast< ::hare_mq::ExchangeType >(_impl_.exchange_type_);
+}
+inline ::hare_mq::ExchangeType declareExchangeRequest::exchange_type() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.exchange_type)
+  return _internal_exchange_type();
+}
+inline void declareExchangeRequest::_internal_set_exchange_type(::hare_mq::ExchangeType value) {
+  
+  _impl_.exchange_type_ = value;
+}
+inline void declareExchangeRequest::set_exchange_type(::hare_mq::ExchangeType value) {
+  _internal_set_exchange_type(value);
+  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.exchange_type)
+}
+
+// bool durable = 5;
+inline void declareExchangeRequest::clear_durable() {
+  _impl_.durable_ = false;
+}
+inline bool declareExchangeRequest::_internal_durable() const {
+  return _impl_.durable_;
+}
+inline bool declareExchangeRequest::durable() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.durable)
+  return _internal_durable();
+}
+inline void declareExchangeRequest::_internal_set_durable(bool value) {
+  
+  _impl_.durable_ = value;
+}
+inline void declareExchangeRequest::set_durable(bool value) {
+  _internal_set_durable(value);
+  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.durable)
+}
+
+// bool auto_delete = 6;
+inline void declareExchangeRequest::clear_auto_delete() {
+  _impl_.auto_delete_ = false;
+}
+inline bool declareExchangeRequest::_internal_auto_delete() const {
+  return _impl_.auto_delete_;
+}
+inline bool declareExchangeRequest::auto_delete() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.auto_delete)
+  return _internal_auto_delete();
+}
+inline void declareExchangeRequest::_internal_set_auto_delete(bool value) {
+  
+  _impl_.auto_delete_ = value;
+}
+inline void declareExchangeRequest::set_auto_delete(bool value) {
+  _internal_set_auto_delete(value);
+  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.auto_delete)
+}
+
+// map<string, string> args = 7;
+inline int declareExchangeRequest::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int declareExchangeRequest::args_size() const {
+  return _internal_args_size();
+}
+inline void declareExchangeRequest::clear_args() {
+  _impl_.args_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareExchangeRequest::_internal_args() const {
+  return _impl_.args_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareExchangeRequest::args() const {
+  // @@protoc_insertion_point(field_map:hare_mq.declareExchangeRequest.args)
+  return _internal_args();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareExchangeRequest::_internal_mutable_args() {
+  return _impl_.args_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareExchangeRequest::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_map:hare_mq.declareExchangeRequest.args)
+  return _internal_mutable_args();
+}
+
+// -------------------------------------------------------------------
+
+// deleteExchangeRequest
+
+// string rid = 1;
+inline void deleteExchangeRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& deleteExchangeRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.deleteExchangeRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.deleteExchangeRequest.rid)
+}
+inline std::string* deleteExchangeRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.deleteExchangeRequest.rid)
+  return _s;
+}
+inline const std::string& deleteExchangeRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void deleteExchangeRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.deleteExchangeRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void deleteExchangeRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteExchangeRequest.rid)
+}
+
+// string cid = 2;
+inline void deleteExchangeRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& deleteExchangeRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.deleteExchangeRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteExchangeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.deleteExchangeRequest.cid)
+}
+inline std::string* deleteExchangeRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.deleteExchangeRequest.cid)
+  return _s;
+}
+inline const std::string& deleteExchangeRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void deleteExchangeRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.deleteExchangeRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void deleteExchangeRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteExchangeRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void deleteExchangeRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& deleteExchangeRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.deleteExchangeRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.deleteExchangeRequest.exchange_name)
+}
+inline std::string* deleteExchangeRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.deleteExchangeRequest.exchange_name)
+  return _s;
+}
+inline const std::string& deleteExchangeRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void deleteExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.deleteExchangeRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void deleteExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteExchangeRequest.exchange_name)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// declareQueueRequest
+
+// string rid = 1;
+inline void declareQueueRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& declareQueueRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.rid)
+}
+inline std::string* declareQueueRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.declareQueueRequest.rid)
+  return _s;
+}
+inline const std::string& declareQueueRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void declareQueueRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.declareQueueRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void declareQueueRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareQueueRequest.rid)
+}
+
+// string cid = 2;
+inline void declareQueueRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& declareQueueRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareQueueRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.cid)
+}
+inline std::string* declareQueueRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.declareQueueRequest.cid)
+  return _s;
+}
+inline const std::string& declareQueueRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void declareQueueRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.declareQueueRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void declareQueueRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareQueueRequest.cid)
+}
+
+// string queue_name = 3;
+inline void declareQueueRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& declareQueueRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.queue_name)
+}
+inline std::string* declareQueueRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.declareQueueRequest.queue_name)
+  return _s;
+}
+inline const std::string& declareQueueRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void declareQueueRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.declareQueueRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void declareQueueRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareQueueRequest.queue_name)
+}
+
+// bool exclusive = 4;
+inline void declareQueueRequest::clear_exclusive() {
+  _impl_.exclusive_ = false;
+}
+inline bool declareQueueRequest::_internal_exclusive() const {
+  return _impl_.exclusive_;
+}
+inline bool declareQueueRequest::exclusive() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.exclusive)
+  return _internal_exclusive();
+}
+inline void declareQueueRequest::_internal_set_exclusive(bool value) {
+  
+  _impl_.exclusive_ = value;
+}
+inline void declareQueueRequest::set_exclusive(bool value) {
+  _internal_set_exclusive(value);
+  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.exclusive)
+}
+
+// bool durable = 5;
+inline void declareQueueRequest::clear_durable() {
+  _impl_.durable_ = false;
+}
+inline bool declareQueueRequest::_internal_durable() const {
+  return _impl_.durable_;
+}
+inline bool declareQueueRequest::durable() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.durable)
+  return _internal_durable();
+}
+inline void declareQueueRequest::_internal_set_durable(bool value) {
+  
+  _impl_.durable_ = value;
+}
+inline void declareQueueRequest::set_durable(bool value) {
+  _internal_set_durable(value);
+  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.durable)
+}
+
+// bool auto_delete = 6;
+inline void declareQueueRequest::clear_auto_delete() {
+  _impl_.auto_delete_ = false;
+}
+inline bool declareQueueRequest::_internal_auto_delete() const {
+  return _impl_.auto_delete_;
+}
+inline bool declareQueueRequest::auto_delete() const {
+  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.auto_delete)
+  return _internal_auto_delete();
+}
+inline void declareQueueRequest::_internal_set_auto_delete(bool value) {
+  
+  _impl_.auto_delete_ = value;
+}
+inline void declareQueueRequest::set_auto_delete(bool value) {
+  _internal_set_auto_delete(value);
+  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.auto_delete)
+}
+
+// map<string, string> args = 7;
+inline int declareQueueRequest::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int declareQueueRequest::args_size() const {
+  return _internal_args_size();
+}
+inline void declareQueueRequest::clear_args() {
+  _impl_.args_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareQueueRequest::_internal_args() const {
+  return _impl_.args_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareQueueRequest::args() const {
+  // @@protoc_insertion_point(field_map:hare_mq.declareQueueRequest.args)
+  return _internal_args();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareQueueRequest::_internal_mutable_args() {
+  return _impl_.args_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareQueueRequest::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_map:hare_mq.declareQueueRequest.args)
+  return _internal_mutable_args();
+}
+
+// -------------------------------------------------------------------
+
+// deleteQueueRequest
+
+// string rid = 1;
+inline void deleteQueueRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& deleteQueueRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.deleteQueueRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.deleteQueueRequest.rid)
+}
+inline std::string* deleteQueueRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.deleteQueueRequest.rid)
+  return _s;
+}
+inline const std::string& deleteQueueRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void deleteQueueRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteQueueRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteQueueRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.deleteQueueRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void deleteQueueRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteQueueRequest.rid)
+}
+
+// string cid = 2;
+inline void deleteQueueRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& deleteQueueRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.deleteQueueRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteQueueRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.deleteQueueRequest.cid)
+}
+inline std::string* deleteQueueRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.deleteQueueRequest.cid)
+  return _s;
+}
+inline const std::string& deleteQueueRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void deleteQueueRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteQueueRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteQueueRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.deleteQueueRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void deleteQueueRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteQueueRequest.cid)
+}
+
+// string queue_name = 3;
+inline void deleteQueueRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& deleteQueueRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.deleteQueueRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.deleteQueueRequest.queue_name)
+}
+inline std::string* deleteQueueRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.deleteQueueRequest.queue_name)
+  return _s;
+}
+inline const std::string& deleteQueueRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void deleteQueueRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteQueueRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteQueueRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.deleteQueueRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void deleteQueueRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteQueueRequest.queue_name)
+}
+
+// -------------------------------------------------------------------
+
+// bindRequest
+
+// string rid = 1;
+inline void bindRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& bindRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void bindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.rid)
+}
+inline std::string* bindRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.rid)
+  return _s;
+}
+inline const std::string& bindRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void bindRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* bindRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* bindRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void bindRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.rid)
+}
+
+// string cid = 2;
+inline void bindRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& bindRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void bindRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.cid)
+}
+inline std::string* bindRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.cid)
+  return _s;
+}
+inline const std::string& bindRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void bindRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* bindRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* bindRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void bindRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void bindRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& bindRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void bindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.exchange_name)
+}
+inline std::string* bindRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.exchange_name)
+  return _s;
+}
+inline const std::string& bindRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void bindRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* bindRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* bindRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void bindRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.exchange_name)
+}
+
+// string queue_name = 4;
+inline void bindRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& bindRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void bindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.queue_name)
+}
+inline std::string* bindRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.queue_name)
+  return _s;
+}
+inline const std::string& bindRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void bindRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* bindRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* bindRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void bindRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.queue_name)
+}
+
+// string binding_key = 5;
+inline void bindRequest::clear_binding_key() {
+  _impl_.binding_key_.ClearToEmpty();
+}
+inline const std::string& bindRequest::binding_key() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.binding_key)
+  return _internal_binding_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void bindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.binding_key)
+}
+inline std::string* bindRequest::mutable_binding_key() {
+  std::string* _s = _internal_mutable_binding_key();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.binding_key)
+  return _s;
+}
+inline const std::string& bindRequest::_internal_binding_key() const {
+  return _impl_.binding_key_.Get();
+}
+inline void bindRequest::_internal_set_binding_key(const std::string& value) {
+  
+  _impl_.binding_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* bindRequest::_internal_mutable_binding_key() {
+  
+  return _impl_.binding_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* bindRequest::release_binding_key() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.binding_key)
+  return _impl_.binding_key_.Release();
+}
+inline void bindRequest::set_allocated_binding_key(std::string* binding_key) {
+  if (binding_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.binding_key_.IsDefault()) {
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.binding_key)
+}
+
+// -------------------------------------------------------------------
+
+// unbindRequest
+
+// string rid = 1;
+inline void unbindRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& unbindRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void unbindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.rid)
+}
+inline std::string* unbindRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.rid)
+  return _s;
+}
+inline const std::string& unbindRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void unbindRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* unbindRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* unbindRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void unbindRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.rid)
+}
+
+// string cid = 2;
+inline void unbindRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& unbindRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void unbindRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.cid)
+}
+inline std::string* unbindRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.cid)
+  return _s;
+}
+inline const std::string& unbindRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void unbindRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* unbindRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* unbindRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void unbindRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void unbindRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& unbindRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void unbindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.exchange_name)
+}
+inline std::string* unbindRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.exchange_name)
+  return _s;
+}
+inline const std::string& unbindRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void unbindRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* unbindRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* unbindRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void unbindRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.exchange_name)
+}
+
+// string queue_name = 4;
+inline void unbindRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& unbindRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void unbindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.queue_name)
+}
+inline std::string* unbindRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.queue_name)
+  return _s;
+}
+inline const std::string& unbindRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void unbindRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* unbindRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* unbindRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void unbindRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.queue_name)
+}
+
+// -------------------------------------------------------------------
+
+// basicPublishRequest
+
+// string rid = 1;
+inline void basicPublishRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicPublishRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicPublishRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.rid)
+}
+inline std::string* basicPublishRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.rid)
+  return _s;
+}
+inline const std::string& basicPublishRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicPublishRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicPublishRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.rid)
+}
+
+// string cid = 2;
+inline void basicPublishRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& basicPublishRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicPublishRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.cid)
+}
+inline std::string* basicPublishRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.cid)
+  return _s;
+}
+inline const std::string& basicPublishRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void basicPublishRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void basicPublishRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void basicPublishRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& basicPublishRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicPublishRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.exchange_name)
+}
+inline std::string* basicPublishRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.exchange_name)
+  return _s;
+}
+inline const std::string& basicPublishRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void basicPublishRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void basicPublishRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.exchange_name)
+}
+
+// string body = 4;
+inline void basicPublishRequest::clear_body() {
+  _impl_.body_.ClearToEmpty();
+}
+inline const std::string& basicPublishRequest::body() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicPublishRequest::set_body(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.body)
+}
+inline std::string* basicPublishRequest::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.body)
+  return _s;
+}
+inline const std::string& basicPublishRequest::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void basicPublishRequest::_internal_set_body(const std::string& value) {
+  
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::_internal_mutable_body() {
+  
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicPublishRequest::release_body() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.body)
+  return _impl_.body_.Release();
+}
+inline void basicPublishRequest::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.body)
+}
+
+// .hare_mq.BasicProperties properties = 5;
+inline bool basicPublishRequest::_internal_has_properties() const {
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
+}
+inline bool basicPublishRequest::has_properties() const {
+  return _internal_has_properties();
+}
+inline const ::hare_mq::BasicProperties& basicPublishRequest::_internal_properties() const {
+  const ::hare_mq::BasicProperties* p = _impl_.properties_;
+  return p != nullptr ? *p : reinterpret_cast<const ::hare_mq::BasicProperties&>(
+      ::hare_mq::_BasicProperties_default_instance_);
+}
+inline const ::hare_mq::BasicProperties& basicPublishRequest::properties() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.properties)
+  return _internal_properties();
+}
+inline void basicPublishRequest::unsafe_arena_set_allocated_properties(
+    ::hare_mq::BasicProperties* properties) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  _impl_.properties_ = properties;
+  if (properties) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hare_mq.basicPublishRequest.properties)
+}
+inline ::hare_mq::BasicProperties* basicPublishRequest::release_properties() {
+  
+  ::hare_mq::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::hare_mq::BasicProperties* basicPublishRequest::unsafe_arena_release_properties() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.properties)
+  
+  ::hare_mq::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+  return temp;
+}
+inline ::hare_mq::BasicProperties* basicPublishRequest::_internal_mutable_properties() {
+  
+  if (_impl_.properties_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hare_mq::BasicProperties>(GetArenaForAllocation());
+    _impl_.properties_ = p;
+  }
+  return _impl_.properties_;
+}
+inline ::hare_mq::BasicProperties* basicPublishRequest::mutable_properties() {
+  ::hare_mq::BasicProperties* _msg = _internal_mutable_properties();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.properties)
+  return _msg;
+}
+inline void basicPublishRequest::set_allocated_properties(::hare_mq::BasicProperties* properties) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  if (properties) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
+    if (message_arena != submessage_arena) {
+      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, properties, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.properties_ = properties;
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.properties)
+}
+
+// -------------------------------------------------------------------
+
+// basicAckRequest
+
+// string rid = 1;
+inline void basicAckRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicAckRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicAckRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.rid)
+}
+inline std::string* basicAckRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.rid)
+  return _s;
+}
+inline const std::string& basicAckRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicAckRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicAckRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.rid)
+}
+
+// string cid = 2;
+inline void basicAckRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& basicAckRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicAckRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.cid)
+}
+inline std::string* basicAckRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.cid)
+  return _s;
+}
+inline const std::string& basicAckRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void basicAckRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void basicAckRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.cid)
+}
+
+// string queue_name = 3;
+inline void basicAckRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& basicAckRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicAckRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.queue_name)
+}
+inline std::string* basicAckRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.queue_name)
+  return _s;
+}
+inline const std::string& basicAckRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void basicAckRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void basicAckRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.queue_name)
+}
+
+// string message_id = 4;
+inline void basicAckRequest::clear_message_id() {
+  _impl_.message_id_.ClearToEmpty();
+}
+inline const std::string& basicAckRequest::message_id() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.message_id)
+  return _internal_message_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicAckRequest::set_message_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.message_id)
+}
+inline std::string* basicAckRequest::mutable_message_id() {
+  std::string* _s = _internal_mutable_message_id();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.message_id)
+  return _s;
+}
+inline const std::string& basicAckRequest::_internal_message_id() const {
+  return _impl_.message_id_.Get();
+}
+inline void basicAckRequest::_internal_set_message_id(const std::string& value) {
+  
+  _impl_.message_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::_internal_mutable_message_id() {
+  
+  return _impl_.message_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::release_message_id() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.message_id)
+  return _impl_.message_id_.Release();
+}
+inline void basicAckRequest::set_allocated_message_id(std::string* message_id) {
+  if (message_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_id_.SetAllocated(message_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_id_.IsDefault()) {
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.message_id)
+}
+
+// uint64 delivery_tag = 5;
+inline void basicAckRequest::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
+}
+inline uint64_t basicAckRequest::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
+}
+inline uint64_t basicAckRequest::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.delivery_tag)
+  return _internal_delivery_tag();
+}
+inline void basicAckRequest::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
+}
+inline void basicAckRequest::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.delivery_tag)
+}
+
+// bool multiple = 6;
+inline void basicAckRequest::clear_multiple() {
+  _impl_.multiple_ = false;
+}
+inline bool basicAckRequest::_internal_multiple() const {
+  return _impl_.multiple_;
+}
+inline bool basicAckRequest::multiple() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.multiple)
+  return _internal_multiple();
+}
+inline void basicAckRequest::_internal_set_multiple(bool value) {
+  
+  _impl_.multiple_ = value;
+}
+inline void basicAckRequest::set_multiple(bool value) {
+  _internal_set_multiple(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.multiple)
+}
+
+// -------------------------------------------------------------------
+
+// basicNackRequest
+
+// string rid = 1;
+inline void basicNackRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicNackRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicNackRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.rid)
+}
+inline std::string* basicNackRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicNackRequest.rid)
+  return _s;
+}
+inline const std::string& basicNackRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicNackRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicNackRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicNackRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicNackRequest.rid)
+}
+
+// string cid = 2;
+inline void basicNackRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& basicNackRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicNackRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.cid)
+}
+inline std::string* basicNackRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicNackRequest.cid)
+  return _s;
+}
+inline const std::string& basicNackRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void basicNackRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicNackRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void basicNackRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicNackRequest.cid)
+}
+
+// string queue_name = 3;
+inline void basicNackRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& basicNackRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicNackRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.queue_name)
+}
+inline std::string* basicNackRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicNackRequest.queue_name)
+  return _s;
+}
+inline const std::string& basicNackRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void basicNackRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicNackRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void basicNackRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicNackRequest.queue_name)
+}
+
+// string message_id = 4;
+inline void basicNackRequest::clear_message_id() {
+  _impl_.message_id_.ClearToEmpty();
+}
+inline const std::string& basicNackRequest::message_id() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.message_id)
+  return _internal_message_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicNackRequest::set_message_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.message_id)
+}
+inline std::string* basicNackRequest::mutable_message_id() {
+  std::string* _s = _internal_mutable_message_id();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicNackRequest.message_id)
+  return _s;
+}
+inline const std::string& basicNackRequest::_internal_message_id() const {
+  return _impl_.message_id_.Get();
+}
+inline void basicNackRequest::_internal_set_message_id(const std::string& value) {
+  
+  _impl_.message_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::_internal_mutable_message_id() {
+  
+  return _impl_.message_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::release_message_id() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicNackRequest.message_id)
+  return _impl_.message_id_.Release();
+}
+inline void basicNackRequest::set_allocated_message_id(std::string* message_id) {
+  if (message_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_id_.SetAllocated(message_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_id_.IsDefault()) {
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicNackRequest.message_id)
+}
+
+// bool requeue = 5;
+inline void basicNackRequest::clear_requeue() {
+  _impl_.requeue_ = false;
+}
+inline bool basicNackRequest::_internal_requeue() const {
+  return _impl_.requeue_;
+}
+inline bool basicNackRequest::requeue() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.requeue)
+  return _internal_requeue();
+}
+inline void basicNackRequest::_internal_set_requeue(bool value) {
+  
+  _impl_.requeue_ = value;
+}
+inline void basicNackRequest::set_requeue(bool value) {
+  _internal_set_requeue(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.requeue)
+}
+
+// uint64 delivery_tag = 6;
+inline void basicNackRequest::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
+}
+inline uint64_t basicNackRequest::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
+}
+inline uint64_t basicNackRequest::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.delivery_tag)
+  return _internal_delivery_tag();
+}
+inline void basicNackRequest::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
+}
+inline void basicNackRequest::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.delivery_tag)
+}
+
+// bool multiple = 7;
+inline void basicNackRequest::clear_multiple() {
+  _impl_.multiple_ = false;
+}
+inline bool basicNackRequest::_internal_multiple() const {
+  return _impl_.multiple_;
+}
+inline bool basicNackRequest::multiple() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicNackRequest.multiple)
+  return _internal_multiple();
+}
+inline void basicNackRequest::_internal_set_multiple(bool value) {
+  
+  _impl_.multiple_ = value;
+}
+inline void basicNackRequest::set_multiple(bool value) {
+  _internal_set_multiple(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicNackRequest.multiple)
+}
+
+// -------------------------------------------------------------------
+
+// basicRejectRequest
+
+// string rid = 1;
+inline void basicRejectRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicRejectRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicRejectRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicRejectRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicRejectRequest.rid)
+}
+inline std::string* basicRejectRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicRejectRequest.rid)
+  return _s;
+}
+inline const std::string& basicRejectRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicRejectRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicRejectRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicRejectRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicRejectRequest.rid)
+}
+
+// string cid = 2;
+inline void basicRejectRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& basicRejectRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicRejectRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicRejectRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicRejectRequest.cid)
+}
+inline std::string* basicRejectRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicRejectRequest.cid)
+  return _s;
+}
+inline const std::string& basicRejectRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void basicRejectRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicRejectRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void basicRejectRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicRejectRequest.cid)
+}
+
+// string queue_name = 3;
+inline void basicRejectRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& basicRejectRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicRejectRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicRejectRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicRejectRequest.queue_name)
+}
+inline std::string* basicRejectRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicRejectRequest.queue_name)
+  return _s;
+}
+inline const std::string& basicRejectRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void basicRejectRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicRejectRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void basicRejectRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicRejectRequest.queue_name)
+}
+
+// string message_id = 4;
+inline void basicRejectRequest::clear_message_id() {
+  _impl_.message_id_.ClearToEmpty();
+}
+inline const std::string& basicRejectRequest::message_id() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicRejectRequest.message_id)
+  return _internal_message_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicRejectRequest::set_message_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicRejectRequest.message_id)
+}
+inline std::string* basicRejectRequest::mutable_message_id() {
+  std::string* _s = _internal_mutable_message_id();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicRejectRequest.message_id)
+  return _s;
+}
+inline const std::string& basicRejectRequest::_internal_message_id() const {
+  return _impl_.message_id_.Get();
+}
+inline void basicRejectRequest::_internal_set_message_id(const std::string& value) {
+  
+  _impl_.message_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::_internal_mutable_message_id() {
+  
+  return _impl_.message_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicRejectRequest::release_message_id() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicRejectRequest.message_id)
+  return _impl_.message_id_.Release();
+}
+inline void basicRejectRequest::set_allocated_message_id(std::string* message_id) {
+  if (message_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_id_.SetAllocated(message_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_id_.IsDefault()) {
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicRejectRequest.message_id)
+}
+
+// bool requeue = 5;
+inline void basicRejectRequest::clear_requeue() {
+  _impl_.requeue_ = false;
+}
+inline bool basicRejectRequest::_internal_requeue() const {
+  return _impl_.requeue_;
+}
+inline bool basicRejectRequest::requeue() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicRejectRequest.requeue)
+  return _internal_requeue();
+}
+inline void basicRejectRequest::_internal_set_requeue(bool value) {
+  
+  _impl_.requeue_ = value;
+}
+inline void basicRejectRequest::set_requeue(bool value) {
+  _internal_set_requeue(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicRejectRequest.requeue)
+}
+
+// uint64 delivery_tag = 6;
+inline void basicRejectRequest::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
+}
+inline uint64_t basicRejectRequest::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
+}
+inline uint64_t basicRejectRequest::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicRejectRequest.delivery_tag)
+  return _internal_delivery_tag();
+}
+inline void basicRejectRequest::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
+}
+inline void basicRejectRequest::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicRejectRequest.delivery_tag)
+}
+
+// -------------------------------------------------------------------
+
+// basicConsumeRequest
+
+// string rid = 1;
+inline void basicConsumeRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicConsumeRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicConsumeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.rid)
+}
+inline std::string* basicConsumeRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.rid)
+  return _s;
+}
+inline const std::string& basicConsumeRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicConsumeRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicConsumeRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.rid)
+}
+
+// string cid = 2;
+inline void basicConsumeRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& basicConsumeRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.cid)
+  return _internal_cid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicConsumeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.cid)
+}
+inline std::string* basicConsumeRequest::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.cid)
+  return _s;
+}
+inline const std::string& basicConsumeRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
+}
+inline void basicConsumeRequest::_internal_set_cid(const std::string& value) {
+  
+  _impl_.cid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::_internal_mutable_cid() {
+  
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.cid)
+  return _impl_.cid_.Release();
+}
+inline void basicConsumeRequest::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.cid)
+}
+
+// string consumer_tag = 3;
+inline void basicConsumeRequest::clear_consumer_tag() {
+  _impl_.consumer_tag_.ClearToEmpty();
+}
+inline const std::string& basicConsumeRequest::consumer_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.consumer_tag)
+  return _internal_consumer_tag();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicConsumeRequest::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.consumer_tag)
+}
+inline std::string* basicConsumeRequest::mutable_consumer_tag() {
+  std::string* _s = _internal_mutable_consumer_tag();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.consumer_tag)
+  return _s;
+}
+inline const std::string& basicConsumeRequest::_internal_consumer_tag() const {
+  return _impl_.consumer_tag_.Get();
+}
+inline void basicConsumeRequest::_internal_set_consumer_tag(const std::string& value) {
+  
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::_internal_mutable_consumer_tag() {
+  
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::release_consumer_tag() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.consumer_tag)
+  return _impl_.consumer_tag_.Release();
+}
+inline void basicConsumeRequest::set_allocated_consumer_tag(std::string* consumer_tag) {
+  if (consumer_tag != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.consumer_tag)
+}
+
+// string queue_name = 4;
+inline void basicConsumeRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& basicConsumeRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicConsumeRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.queue_name)
+}
+inline std::string* basicConsumeRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.queue_name)
+  return _s;
+}
+inline const std::string& basicConsumeRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void basicConsumeRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicConsumeRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void basicConsumeRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.queue_name)
+}
 
+// bool auto_ack = 5;
+inline void basicConsumeRequest::clear_auto_ack() {
+  _impl_.auto_ack_ = false;
+}
+inline bool basicConsumeRequest::_internal_auto_ack() const {
+  return _impl_.auto_ack_;
+}
+inline bool basicConsumeRequest::auto_ack() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.auto_ack)
+  return _internal_auto_ack();
+}
+inline void basicConsumeRequest::_internal_set_auto_ack(bool value) {
+  
+  _impl_.auto_ack_ = value;
+}
+inline void basicConsumeRequest::set_auto_ack(bool value) {
+  _internal_set_auto_ack(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.auto_ack)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// openChannelRequest
+// basicCancelRequest
 
 // string rid = 1;
-inline void openChannelRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void basicCancelRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& openChannelRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.openChannelRequest.rid)
+inline const std::string& basicCancelRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void openChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicCancelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.openChannelRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.rid)
 }
-inline std::string* openChannelRequest::mutable_rid() {
+inline std::string* basicCancelRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.openChannelRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.rid)
   return _s;
 }
-inline const std::string& openChannelRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicCancelRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void openChannelRequest::_internal_set_rid(const std::string& value) {
+inline void basicCancelRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::_internal_mutable_rid() {
+inline std::string* basicCancelRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.openChannelRequest.rid)
-  return rid_.Release();
+inline std::string* basicCancelRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void openChannelRequest::set_allocated_rid(std::string* rid) {
+inline void basicCancelRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.openChannelRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.rid)
 }
 
 // string cid = 2;
-inline void openChannelRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void basicCancelRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& openChannelRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.openChannelRequest.cid)
+inline const std::string& basicCancelRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void openChannelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicCancelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.openChannelRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.cid)
 }
-inline std::string* openChannelRequest::mutable_cid() {
+inline std::string* basicCancelRequest::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.openChannelRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.cid)
   return _s;
 }
-inline const std::string& openChannelRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicCancelRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void openChannelRequest::_internal_set_cid(const std::string& value) {
+inline void basicCancelRequest::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::_internal_mutable_cid() {
+inline std::string* basicCancelRequest::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.openChannelRequest.cid)
-  return cid_.Release();
+inline std::string* basicCancelRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.cid)
+  return _impl_.cid_.Release();
 }
-inline void openChannelRequest::set_allocated_cid(std::string* cid) {
+inline void basicCancelRequest::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.openChannelRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.cid)
 }
 
-// -------------------------------------------------------------------
-
-// closeChannelRequest
-
-// string rid = 1;
-inline void closeChannelRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string consumer_tag = 3;
+inline void basicCancelRequest::clear_consumer_tag() {
+  _impl_.consumer_tag_.ClearToEmpty();
 }
-inline const std::string& closeChannelRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.closeChannelRequest.rid)
-  return _internal_rid();
+inline const std::string& basicCancelRequest::consumer_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.consumer_tag)
+  return _internal_consumer_tag();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void closeChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicCancelRequest::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.closeChannelRequest.rid)
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.consumer_tag)
 }
-inline std::string* closeChannelRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.closeChannelRequest.rid)
+inline std::string* basicCancelRequest::mutable_consumer_tag() {
+  std::string* _s = _internal_mutable_consumer_tag();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.consumer_tag)
   return _s;
 }
-inline const std::string& closeChannelRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicCancelRequest::_internal_consumer_tag() const {
+  return _impl_.consumer_tag_.Get();
 }
-inline void closeChannelRequest::_internal_set_rid(const std::string& value) {
+inline void basicCancelRequest::_internal_set_consumer_tag(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
 }
-inline std::string* closeChannelRequest::_internal_mutable_rid() {
+inline std::string* basicCancelRequest::_internal_mutable_consumer_tag() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
 }
-inline std::string* closeChannelRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.closeChannelRequest.rid)
-  return rid_.Release();
+inline std::string* basicCancelRequest::release_consumer_tag() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.consumer_tag)
+  return _impl_.consumer_tag_.Release();
 }
-inline void closeChannelRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void basicCancelRequest::set_allocated_consumer_tag(std::string* consumer_tag) {
+  if (consumer_tag != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.closeChannelRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.consumer_tag)
 }
 
-// string cid = 2;
-inline void closeChannelRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// string queue_name = 4;
+inline void basicCancelRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
 }
-inline const std::string& closeChannelRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.closeChannelRequest.cid)
-  return _internal_cid();
+inline const std::string& basicCancelRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.queue_name)
+  return _internal_queue_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void closeChannelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicCancelRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.closeChannelRequest.cid)
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.queue_name)
 }
-inline std::string* closeChannelRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.closeChannelRequest.cid)
+inline std::string* basicCancelRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.queue_name)
   return _s;
 }
-inline const std::string& closeChannelRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicCancelRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void closeChannelRequest::_internal_set_cid(const std::string& value) {
+inline void basicCancelRequest::_internal_set_queue_name(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* closeChannelRequest::_internal_mutable_cid() {
+inline std::string* basicCancelRequest::_internal_mutable_queue_name() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* closeChannelRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.closeChannelRequest.cid)
-  return cid_.Release();
+inline std::string* basicCancelRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void closeChannelRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void basicCancelRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.closeChannelRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.queue_name)
 }
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// declareExchangeRequest
+// basicConsumeResponse
 
-// string rid = 1;
-inline void declareExchangeRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string cid = 1;
+inline void basicConsumeResponse::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& declareExchangeRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.rid)
-  return _internal_rid();
+inline const std::string& basicConsumeResponse::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.cid)
+  return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicConsumeResponse::set_cid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.rid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.cid)
 }
-inline std::string* declareExchangeRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.declareExchangeRequest.rid)
+inline std::string* basicConsumeResponse::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.cid)
   return _s;
 }
-inline const std::string& declareExchangeRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicConsumeResponse::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void declareExchangeRequest::_internal_set_rid(const std::string& value) {
+inline void basicConsumeResponse::_internal_set_cid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::_internal_mutable_rid() {
+inline std::string* basicConsumeResponse::_internal_mutable_cid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.declareExchangeRequest.rid)
-  return rid_.Release();
+inline std::string* basicConsumeResponse::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.cid)
+  return _impl_.cid_.Release();
 }
-inline void declareExchangeRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void basicConsumeResponse::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareExchangeRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.cid)
 }
 
-// string cid = 2;
-inline void declareExchangeRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// string consumer_tag = 2;
+inline void basicConsumeResponse::clear_consumer_tag() {
+  _impl_.consumer_tag_.ClearToEmpty();
 }
-inline const std::string& declareExchangeRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.cid)
-  return _internal_cid();
+inline const std::string& basicConsumeResponse::consumer_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.consumer_tag)
+  return _internal_consumer_tag();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareExchangeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicConsumeResponse::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.cid)
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.consumer_tag)
 }
-inline std::string* declareExchangeRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.declareExchangeRequest.cid)
+inline std::string* basicConsumeResponse::mutable_consumer_tag() {
+  std::string* _s = _internal_mutable_consumer_tag();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.consumer_tag)
   return _s;
 }
-inline const std::string& declareExchangeRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicConsumeResponse::_internal_consumer_tag() const {
+  return _impl_.consumer_tag_.Get();
 }
-inline void declareExchangeRequest::_internal_set_cid(const std::string& value) {
+inline void basicConsumeResponse::_internal_set_consumer_tag(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::_internal_mutable_cid() {
+inline std::string* basicConsumeResponse::_internal_mutable_consumer_tag() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.declareExchangeRequest.cid)
-  return cid_.Release();
+inline std::string* basicConsumeResponse::release_consumer_tag() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.consumer_tag)
+  return _impl_.consumer_tag_.Release();
 }
-inline void declareExchangeRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void basicConsumeResponse::set_allocated_consumer_tag(std::string* consumer_tag) {
+  if (consumer_tag != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareExchangeRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.consumer_tag)
 }
 
-// string exchange_name = 3;
-inline void declareExchangeRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// string body = 3;
+inline void basicConsumeResponse::clear_body() {
+  _impl_.body_.ClearToEmpty();
 }
-inline const std::string& declareExchangeRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.exchange_name)
-  return _internal_exchange_name();
+inline const std::string& basicConsumeResponse::body() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.body)
+  return _internal_body();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void basicConsumeResponse::set_body(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.exchange_name)
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.body)
 }
-inline std::string* declareExchangeRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.declareExchangeRequest.exchange_name)
+inline std::string* basicConsumeResponse::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.body)
   return _s;
 }
-inline const std::string& declareExchangeRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& basicConsumeResponse::_internal_body() const {
+  return _impl_.body_.Get();
 }
-inline void declareExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+inline void basicConsumeResponse::_internal_set_body(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::_internal_mutable_exchange_name() {
+inline std::string* basicConsumeResponse::_internal_mutable_body() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.declareExchangeRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* basicConsumeResponse::release_body() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.body)
+  return _impl_.body_.Release();
 }
-inline void declareExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void basicConsumeResponse::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareExchangeRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.body)
 }
 
-// .hare_mq.ExchangeType exchange_type = 4;
-inline void declareExchangeRequest::clear_exchange_type() {
-  exchange_type_ = 0;
-}
-inline ::hare_mq::ExchangeType declareExchangeRequest::_internal_exchange_type() const {
-  return static_cast< ::hare_mq::ExchangeType >(exchange_type_);
-}
-inline ::hare_mq::ExchangeType declareExchangeRequest::exchange_type() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.exchange_type)
-  return _internal_exchange_type();
-}
-inline void declareExchangeRequest::_internal_set_exchange_type(::hare_mq::ExchangeType value) {
-  
-  exchange_type_ = value;
+// .hare_mq.BasicProperties properties = 4;
+inline bool basicConsumeResponse::_internal_has_properties() const {
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
 }
-inline void declareExchangeRequest::set_exchange_type(::hare_mq::ExchangeType value) {
-  _internal_set_exchange_type(value);
-  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.exchange_type)
+inline bool basicConsumeResponse::has_properties() const {
+  return _internal_has_properties();
 }
-
-// bool durable = 5;
-inline void declareExchangeRequest::clear_durable() {
-  durable_ = false;
+inline const ::hare_mq::BasicProperties& basicConsumeResponse::_internal_properties() const {
+  const ::hare_mq::BasicProperties* p = _impl_.properties_;
+  return p != nullptr ? *p : reinterpret_cast<const ::hare_mq::BasicProperties&>(
+      ::hare_mq::_BasicProperties_default_instance_);
 }
-inline bool declareExchangeRequest::_internal_durable() const {
-  return durable_;
+inline const ::hare_mq::BasicProperties& basicConsumeResponse::properties() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.properties)
+  return _internal_properties();
 }
-inline bool declareExchangeRequest::durable() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.durable)
-  return _internal_durable();
+inline void basicConsumeResponse::unsafe_arena_set_allocated_properties(
+    ::hare_mq::BasicProperties* properties) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  _impl_.properties_ = properties;
+  if (properties) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hare_mq.basicConsumeResponse.properties)
 }
-inline void declareExchangeRequest::_internal_set_durable(bool value) {
+inline ::hare_mq::BasicProperties* basicConsumeResponse::release_properties() {
   
-  durable_ = value;
-}
-inline void declareExchangeRequest::set_durable(bool value) {
-  _internal_set_durable(value);
-  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.durable)
-}
-
-// bool auto_delete = 6;
-inline void declareExchangeRequest::clear_auto_delete() {
-  auto_delete_ = false;
-}
-inline bool declareExchangeRequest::_internal_auto_delete() const {
-  return auto_delete_;
-}
-inline bool declareExchangeRequest::auto_delete() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareExchangeRequest.auto_delete)
-  return _internal_auto_delete();
+  ::hare_mq::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void declareExchangeRequest::_internal_set_auto_delete(bool value) {
+inline ::hare_mq::BasicProperties* basicConsumeResponse::unsafe_arena_release_properties() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.properties)
   
-  auto_delete_ = value;
+  ::hare_mq::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+  return temp;
 }
-inline void declareExchangeRequest::set_auto_delete(bool value) {
-  _internal_set_auto_delete(value);
-  // @@protoc_insertion_point(field_set:hare_mq.declareExchangeRequest.auto_delete)
+inline ::hare_mq::BasicProperties* basicConsumeResponse::_internal_mutable_properties() {
+  
+  if (_impl_.properties_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hare_mq::BasicProperties>(GetArenaForAllocation());
+    _impl_.properties_ = p;
+  }
+  return _impl_.properties_;
 }
-
-// map<string, string> args = 7;
-inline int declareExchangeRequest::_internal_args_size() const {
-  return args_.size();
+inline ::hare_mq::BasicProperties* basicConsumeResponse::mutable_properties() {
+  ::hare_mq::BasicProperties* _msg = _internal_mutable_properties();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.properties)
+  return _msg;
 }
-inline int declareExchangeRequest::args_size() const {
-  return _internal_args_size();
+inline void basicConsumeResponse::set_allocated_properties(::hare_mq::BasicProperties* properties) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  if (properties) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
+    if (message_arena != submessage_arena) {
+      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, properties, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.properties_ = properties;
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.properties)
 }
-inline void declareExchangeRequest::clear_args() {
-  args_.Clear();
+
+// uint64 delivery_tag = 5;
+inline void basicConsumeResponse::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareExchangeRequest::_internal_args() const {
-  return args_.GetMap();
+inline uint64_t basicConsumeResponse::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareExchangeRequest::args() const {
-  // @@protoc_insertion_point(field_map:hare_mq.declareExchangeRequest.args)
-  return _internal_args();
+inline uint64_t basicConsumeResponse::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.delivery_tag)
+  return _internal_delivery_tag();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareExchangeRequest::_internal_mutable_args() {
-  return args_.MutableMap();
+inline void basicConsumeResponse::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareExchangeRequest::mutable_args() {
-  // @@protoc_insertion_point(field_mutable_map:hare_mq.declareExchangeRequest.args)
-  return _internal_mutable_args();
+inline void basicConsumeResponse::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.delivery_tag)
 }
 
 // -------------------------------------------------------------------
 
-// deleteExchangeRequest
+// basicGetRequest
 
 // string rid = 1;
-inline void deleteExchangeRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void basicGetRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& deleteExchangeRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.deleteExchangeRequest.rid)
+inline const std::string& basicGetRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicGetRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.deleteExchangeRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetRequest.rid)
 }
-inline std::string* deleteExchangeRequest::mutable_rid() {
+inline std::string* basicGetRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.deleteExchangeRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicGetRequest.rid)
   return _s;
 }
-inline const std::string& deleteExchangeRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicGetRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void deleteExchangeRequest::_internal_set_rid(const std::string& value) {
+inline void basicGetRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::_internal_mutable_rid() {
+inline std::string* basicGetRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.deleteExchangeRequest.rid)
-  return rid_.Release();
+inline std::string* basicGetRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicGetRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void deleteExchangeRequest::set_allocated_rid(std::string* rid) {
+inline void basicGetRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteExchangeRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicGetRequest.rid)
 }
 
 // string cid = 2;
-inline void deleteExchangeRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void basicGetRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& deleteExchangeRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.deleteExchangeRequest.cid)
+inline const std::string& basicGetRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetRequest.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteExchangeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicGetRequest::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.deleteExchangeRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetRequest.cid)
 }
-inline std::string* deleteExchangeRequest::mutable_cid() {
+inline std::string* basicGetRequest::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.deleteExchangeRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicGetRequest.cid)
   return _s;
 }
-inline const std::string& deleteExchangeRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicGetRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void deleteExchangeRequest::_internal_set_cid(const std::string& value) {
+inline void basicGetRequest::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::_internal_mutable_cid() {
+inline std::string* basicGetRequest::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.deleteExchangeRequest.cid)
-  return cid_.Release();
+inline std::string* basicGetRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicGetRequest.cid)
+  return _impl_.cid_.Release();
 }
-inline void deleteExchangeRequest::set_allocated_cid(std::string* cid) {
+inline void basicGetRequest::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteExchangeRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicGetRequest.cid)
 }
 
-// string exchange_name = 3;
-inline void deleteExchangeRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// string queue_name = 3;
+inline void basicGetRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
 }
-inline const std::string& deleteExchangeRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.deleteExchangeRequest.exchange_name)
-  return _internal_exchange_name();
+inline const std::string& basicGetRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetRequest.queue_name)
+  return _internal_queue_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void basicGetRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.deleteExchangeRequest.exchange_name)
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetRequest.queue_name)
 }
-inline std::string* deleteExchangeRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.deleteExchangeRequest.exchange_name)
+inline std::string* basicGetRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicGetRequest.queue_name)
   return _s;
 }
-inline const std::string& deleteExchangeRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& basicGetRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void deleteExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+inline void basicGetRequest::_internal_set_queue_name(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::_internal_mutable_exchange_name() {
+inline std::string* basicGetRequest::_internal_mutable_queue_name() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.deleteExchangeRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* basicGetRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicGetRequest.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void deleteExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void basicGetRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteExchangeRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicGetRequest.queue_name)
 }
 
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// declareQueueRequest
-
-// string rid = 1;
-inline void declareQueueRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// uint32 max_count = 4;
+inline void basicGetRequest::clear_max_count() {
+  _impl_.max_count_ = 0u;
 }
-inline const std::string& declareQueueRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.rid)
-  return _internal_rid();
+inline uint32_t basicGetRequest::_internal_max_count() const {
+  return _impl_.max_count_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void declareQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
- 
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.rid)
+inline uint32_t basicGetRequest::max_count() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetRequest.max_count)
+  return _internal_max_count();
 }
-inline std::string* declareQueueRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.declareQueueRequest.rid)
-  return _s;
+inline void basicGetRequest::_internal_set_max_count(uint32_t value) {
+  
+  _impl_.max_count_ = value;
 }
-inline const std::string& declareQueueRequest::_internal_rid() const {
-  return rid_.Get();
+inline void basicGetRequest::set_max_count(uint32_t value) {
+  _internal_set_max_count(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetRequest.max_count)
 }
-inline void declareQueueRequest::_internal_set_rid(const std::string& value) {
-  
-  rid_.Set(value, GetArenaForAllocation());
+
+// uint64 max_bytes = 5;
+inline void basicGetRequest::clear_max_bytes() {
+  _impl_.max_bytes_ = uint64_t{0u};
 }
-inline std::string* declareQueueRequest::_internal_mutable_rid() {
+inline uint64_t basicGetRequest::_internal_max_bytes() const {
+  return _impl_.max_bytes_;
+}
+inline uint64_t basicGetRequest::max_bytes() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetRequest.max_bytes)
+  return _internal_max_bytes();
+}
+inline void basicGetRequest::_internal_set_max_bytes(uint64_t value) {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  _impl_.max_bytes_ = value;
 }
-inline std::string* declareQueueRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.declareQueueRequest.rid)
-  return rid_.Release();
+inline void basicGetRequest::set_max_bytes(uint64_t value) {
+  _internal_set_max_bytes(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetRequest.max_bytes)
 }
-inline void declareQueueRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
-    
-  } else {
-    
-  }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareQueueRequest.rid)
+
+// bool auto_ack = 6;
+inline void basicGetRequest::clear_auto_ack() {
+  _impl_.auto_ack_ = false;
+}
+inline bool basicGetRequest::_internal_auto_ack() const {
+  return _impl_.auto_ack_;
+}
+inline bool basicGetRequest::auto_ack() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetRequest.auto_ack)
+  return _internal_auto_ack();
+}
+inline void basicGetRequest::_internal_set_auto_ack(bool value) {
+  
+  _impl_.auto_ack_ = value;
+}
+inline void basicGetRequest::set_auto_ack(bool value) {
+  _internal_set_auto_ack(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetRequest.auto_ack)
 }
 
-// string cid = 2;
-inline void declareQueueRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// basicGetResponse
+
+// string rid = 1;
+inline void basicGetResponse::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& declareQueueRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.cid)
-  return _internal_cid();
+inline const std::string& basicGetResponse::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetResponse.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareQueueRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicGetResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.cid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetResponse.rid)
 }
-inline std::string* declareQueueRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.declareQueueRequest.cid)
+inline std::string* basicGetResponse::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicGetResponse.rid)
   return _s;
 }
-inline const std::string& declareQueueRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicGetResponse::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void declareQueueRequest::_internal_set_cid(const std::string& value) {
+inline void basicGetResponse::_internal_set_rid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::_internal_mutable_cid() {
+inline std::string* basicGetResponse::_internal_mutable_rid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.declareQueueRequest.cid)
-  return cid_.Release();
+inline std::string* basicGetResponse::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicGetResponse.rid)
+  return _impl_.rid_.Release();
 }
-inline void declareQueueRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void basicGetResponse::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareQueueRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicGetResponse.rid)
 }
 
-// string queue_name = 3;
-inline void declareQueueRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// string cid = 2;
+inline void basicGetResponse::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& declareQueueRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.queue_name)
-  return _internal_queue_name();
+inline const std::string& basicGetResponse::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetResponse.cid)
+  return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void basicGetResponse::set_cid(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.queue_name)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetResponse.cid)
 }
-inline std::string* declareQueueRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.declareQueueRequest.queue_name)
+inline std::string* basicGetResponse::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicGetResponse.cid)
   return _s;
 }
-inline const std::string& declareQueueRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& basicGetResponse::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void declareQueueRequest::_internal_set_queue_name(const std::string& value) {
+inline void basicGetResponse::_internal_set_cid(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::_internal_mutable_queue_name() {
+inline std::string* basicGetResponse::_internal_mutable_cid() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.declareQueueRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* basicGetResponse::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicGetResponse.cid)
+  return _impl_.cid_.Release();
 }
-inline void declareQueueRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void basicGetResponse::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.declareQueueRequest.queue_name)
-}
-
-// bool exclusive = 4;
-inline void declareQueueRequest::clear_exclusive() {
-  exclusive_ = false;
-}
-inline bool declareQueueRequest::_internal_exclusive() const {
-  return exclusive_;
-}
-inline bool declareQueueRequest::exclusive() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.exclusive)
-  return _internal_exclusive();
-}
-inline void declareQueueRequest::_internal_set_exclusive(bool value) {
-  
-  exclusive_ = value;
-}
-inline void declareQueueRequest::set_exclusive(bool value) {
-  _internal_set_exclusive(value);
-  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.exclusive)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicGetResponse.cid)
 }
 
-// bool durable = 5;
-inline void declareQueueRequest::clear_durable() {
-  durable_ = false;
+// bool ok = 3;
+inline void basicGetResponse::clear_ok() {
+  _impl_.ok_ = false;
 }
-inline bool declareQueueRequest::_internal_durable() const {
-  return durable_;
+inline bool basicGetResponse::_internal_ok() const {
+  return _impl_.ok_;
 }
-inline bool declareQueueRequest::durable() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.durable)
-  return _internal_durable();
+inline bool basicGetResponse::ok() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetResponse.ok)
+  return _internal_ok();
 }
-inline void declareQueueRequest::_internal_set_durable(bool value) {
+inline void basicGetResponse::_internal_set_ok(bool value) {
   
-  durable_ = value;
+  _impl_.ok_ = value;
 }
-inline void declareQueueRequest::set_durable(bool value) {
-  _internal_set_durable(value);
-  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.durable)
+inline void basicGetResponse::set_ok(bool value) {
+  _internal_set_ok(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicGetResponse.ok)
 }
 
-// bool auto_delete = 6;
-inline void declareQueueRequest::clear_auto_delete() {
-  auto_delete_ = false;
+// repeated .hare_mq.basicConsumeResponse messages = 4;
+inline int basicGetResponse::_internal_messages_size() const {
+  return _impl_.messages_.size();
 }
-inline bool declareQueueRequest::_internal_auto_delete() const {
-  return auto_delete_;
-}
-inline bool declareQueueRequest::auto_delete() const {
-  // @@protoc_insertion_point(field_get:hare_mq.declareQueueRequest.auto_delete)
-  return _internal_auto_delete();
-}
-inline void declareQueueRequest::_internal_set_auto_delete(bool value) {
-  
-  auto_delete_ = value;
+inline int basicGetResponse::messages_size() const {
+  return _internal_messages_size();
 }
-inline void declareQueueRequest::set_auto_delete(bool value) {
-  _internal_set_auto_delete(value);
-  // @@protoc_insertion_point(field_set:hare_mq.declareQueueRequest.auto_delete)
+inline void basicGetResponse::clear_messages() {
+  _impl_.messages_.Clear();
 }
-
-// map<string, string> args = 7;
-inline int declareQueueRequest::_internal_args_size() const {
-  return args_.size();
+inline ::hare_mq::basicConsumeResponse* basicGetResponse::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicGetResponse.messages)
+  return _impl_.messages_.Mutable(index);
 }
-inline int declareQueueRequest::args_size() const {
-  return _internal_args_size();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::basicConsumeResponse >*
+basicGetResponse::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.basicGetResponse.messages)
+  return &_impl_.messages_;
 }
-inline void declareQueueRequest::clear_args() {
-  args_.Clear();
+inline const ::hare_mq::basicConsumeResponse& basicGetResponse::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareQueueRequest::_internal_args() const {
-  return args_.GetMap();
+inline const ::hare_mq::basicConsumeResponse& basicGetResponse::messages(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicGetResponse.messages)
+  return _internal_messages(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareQueueRequest::args() const {
-  // @@protoc_insertion_point(field_map:hare_mq.declareQueueRequest.args)
-  return _internal_args();
+inline ::hare_mq::basicConsumeResponse* basicGetResponse::_internal_add_messages() {
+  return _impl_.messages_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareQueueRequest::_internal_mutable_args() {
-  return args_.MutableMap();
+inline ::hare_mq::basicConsumeResponse* basicGetResponse::add_messages() {
+  ::hare_mq::basicConsumeResponse* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:hare_mq.basicGetResponse.messages)
+  return _add;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareQueueRequest::mutable_args() {
-  // @@protoc_insertion_point(field_mutable_map:hare_mq.declareQueueRequest.args)
-  return _internal_mutable_args();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::basicConsumeResponse >&
+basicGetResponse::messages() const {
+  // @@protoc_insertion_point(field_list:hare_mq.basicGetResponse.messages)
+  return _impl_.messages_;
 }
 
 // -------------------------------------------------------------------
 
-// deleteQueueRequest
+// basicCommonResponse
 
 // string rid = 1;
-inline void deleteQueueRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void basicCommonResponse::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& deleteQueueRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.deleteQueueRequest.rid)
+inline const std::string& basicCommonResponse::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCommonResponse.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicCommonResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.deleteQueueRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicCommonResponse.rid)
 }
-inline std::string* deleteQueueRequest::mutable_rid() {
+inline std::string* basicCommonResponse::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.deleteQueueRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicCommonResponse.rid)
   return _s;
 }
-inline const std::string& deleteQueueRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicCommonResponse::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void deleteQueueRequest::_internal_set_rid(const std::string& value) {
+inline void basicCommonResponse::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::_internal_mutable_rid() {
+inline std::string* basicCommonResponse::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.deleteQueueRequest.rid)
-  return rid_.Release();
+inline std::string* basicCommonResponse::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicCommonResponse.rid)
+  return _impl_.rid_.Release();
 }
-inline void deleteQueueRequest::set_allocated_rid(std::string* rid) {
+inline void basicCommonResponse::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteQueueRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCommonResponse.rid)
 }
 
 // string cid = 2;
-inline void deleteQueueRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void basicCommonResponse::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& deleteQueueRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.deleteQueueRequest.cid)
+inline const std::string& basicCommonResponse::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCommonResponse.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteQueueRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicCommonResponse::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.deleteQueueRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicCommonResponse.cid)
 }
-inline std::string* deleteQueueRequest::mutable_cid() {
+inline std::string* basicCommonResponse::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.deleteQueueRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicCommonResponse.cid)
   return _s;
 }
-inline const std::string& deleteQueueRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicCommonResponse::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void deleteQueueRequest::_internal_set_cid(const std::string& value) {
+inline void basicCommonResponse::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::_internal_mutable_cid() {
+inline std::string* basicCommonResponse::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.deleteQueueRequest.cid)
-  return cid_.Release();
+inline std::string* basicCommonResponse::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicCommonResponse.cid)
+  return _impl_.cid_.Release();
 }
-inline void deleteQueueRequest::set_allocated_cid(std::string* cid) {
+inline void basicCommonResponse::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteQueueRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCommonResponse.cid)
 }
 
-// string queue_name = 3;
-inline void deleteQueueRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
-}
-inline const std::string& deleteQueueRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.deleteQueueRequest.queue_name)
-  return _internal_queue_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void deleteQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
- 
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.deleteQueueRequest.queue_name)
-}
-inline std::string* deleteQueueRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.deleteQueueRequest.queue_name)
-  return _s;
+// bool ok = 3;
+inline void basicCommonResponse::clear_ok() {
+  _impl_.ok_ = false;
 }
-inline const std::string& deleteQueueRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline bool basicCommonResponse::_internal_ok() const {
+  return _impl_.ok_;
 }
-inline void deleteQueueRequest::_internal_set_queue_name(const std::string& value) {
-  
-  queue_name_.Set(value, GetArenaForAllocation());
+inline bool basicCommonResponse::ok() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicCommonResponse.ok)
+  return _internal_ok();
 }
-inline std::string* deleteQueueRequest::_internal_mutable_queue_name() {
+inline void basicCommonResponse::_internal_set_ok(bool value) {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
-}
-inline std::string* deleteQueueRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.deleteQueueRequest.queue_name)
-  return queue_name_.Release();
+  _impl_.ok_ = value;
 }
-inline void deleteQueueRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
-    
-  } else {
-    
-  }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.deleteQueueRequest.queue_name)
+inline void basicCommonResponse::set_ok(bool value) {
+  _internal_set_ok(value);
+  // @@protoc_insertion_point(field_set:hare_mq.basicCommonResponse.ok)
 }
 
 // -------------------------------------------------------------------
 
-// bindRequest
+// basicQueryRequest
 
 // string rid = 1;
-inline void bindRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void basicQueryRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& bindRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.rid)
+inline const std::string& basicQueryRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicQueryRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void bindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicQueryRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicQueryRequest.rid)
 }
-inline std::string* bindRequest::mutable_rid() {
+inline std::string* basicQueryRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryRequest.rid)
   return _s;
 }
-inline const std::string& bindRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicQueryRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void bindRequest::_internal_set_rid(const std::string& value) {
+inline void basicQueryRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* bindRequest::_internal_mutable_rid() {
+inline std::string* basicQueryRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* bindRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.rid)
-  return rid_.Release();
+inline std::string* basicQueryRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicQueryRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void bindRequest::set_allocated_rid(std::string* rid) {
+inline void basicQueryRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryRequest.rid)
 }
 
 // string cid = 2;
-inline void bindRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void basicQueryRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& bindRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.cid)
+inline const std::string& basicQueryRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicQueryRequest.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void bindRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicQueryRequest::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicQueryRequest.cid)
 }
-inline std::string* bindRequest::mutable_cid() {
+inline std::string* basicQueryRequest::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryRequest.cid)
   return _s;
 }
-inline const std::string& bindRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicQueryRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void bindRequest::_internal_set_cid(const std::string& value) {
+inline void basicQueryRequest::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* bindRequest::_internal_mutable_cid() {
+inline std::string* basicQueryRequest::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* bindRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.cid)
-  return cid_.Release();
+inline std::string* basicQueryRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicQueryRequest.cid)
+  return _impl_.cid_.Release();
 }
-inline void bindRequest::set_allocated_cid(std::string* cid) {
+inline void basicQueryRequest::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryRequest.cid)
 }
 
-// string exchange_name = 3;
-inline void bindRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// basicQueryResponse
+
+// string rid = 1;
+inline void basicQueryResponse::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& bindRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.exchange_name)
-  return _internal_exchange_name();
+inline const std::string& basicQueryResponse::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicQueryResponse.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void bindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void basicQueryResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.exchange_name)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicQueryResponse.rid)
 }
-inline std::string* bindRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.exchange_name)
+inline std::string* basicQueryResponse::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryResponse.rid)
   return _s;
 }
-inline const std::string& bindRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& basicQueryResponse::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void bindRequest::_internal_set_exchange_name(const std::string& value) {
+inline void basicQueryResponse::_internal_set_rid(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* bindRequest::_internal_mutable_exchange_name() {
+inline std::string* basicQueryResponse::_internal_mutable_rid() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* bindRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* basicQueryResponse::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicQueryResponse.rid)
+  return _impl_.rid_.Release();
 }
-inline void bindRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void basicQueryResponse::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryResponse.rid)
 }
 
-// string queue_name = 4;
-inline void bindRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// string cid = 2;
+inline void basicQueryResponse::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& bindRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.queue_name)
-  return _internal_queue_name();
+inline const std::string& basicQueryResponse::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicQueryResponse.cid)
+  return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void bindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void basicQueryResponse::set_cid(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.queue_name)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicQueryResponse.cid)
 }
-inline std::string* bindRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.queue_name)
+inline std::string* basicQueryResponse::mutable_cid() {
+  std::string* _s = _internal_mutable_cid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryResponse.cid)
   return _s;
 }
-inline const std::string& bindRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& basicQueryResponse::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void bindRequest::_internal_set_queue_name(const std::string& value) {
+inline void basicQueryResponse::_internal_set_cid(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* bindRequest::_internal_mutable_queue_name() {
+inline std::string* basicQueryResponse::_internal_mutable_cid() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* bindRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* basicQueryResponse::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicQueryResponse.cid)
+  return _impl_.cid_.Release();
 }
-inline void bindRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void basicQueryResponse::set_allocated_cid(std::string* cid) {
+  if (cid != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.queue_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryResponse.cid)
 }
 
-// string binding_key = 5;
-inline void bindRequest::clear_binding_key() {
-  binding_key_.ClearToEmpty();
+// string body = 3;
+inline void basicQueryResponse::clear_body() {
+  _impl_.body_.ClearToEmpty();
 }
-inline const std::string& bindRequest::binding_key() const {
-  // @@protoc_insertion_point(field_get:hare_mq.bindRequest.binding_key)
-  return _internal_binding_key();
+inline const std::string& basicQueryResponse::body() const {
+  // @@protoc_insertion_point(field_get:hare_mq.basicQueryResponse.body)
+  return _internal_body();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void bindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
+void basicQueryResponse::set_body(ArgT0&& arg0, ArgT... args) {
  
- binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.bindRequest.binding_key)
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.basicQueryResponse.body)
 }
-inline std::string* bindRequest::mutable_binding_key() {
-  std::string* _s = _internal_mutable_binding_key();
-  // @@protoc_insertion_point(field_mutable:hare_mq.bindRequest.binding_key)
+inline std::string* basicQueryResponse::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryResponse.body)
   return _s;
 }
-inline const std::string& bindRequest::_internal_binding_key() const {
-  return binding_key_.Get();
+inline const std::string& basicQueryResponse::_internal_body() const {
+  return _impl_.body_.Get();
 }
-inline void bindRequest::_internal_set_binding_key(const std::string& value) {
+inline void basicQueryResponse::_internal_set_body(const std::string& value) {
   
-  binding_key_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
-inline std::string* bindRequest::_internal_mutable_binding_key() {
+inline std::string* basicQueryResponse::_internal_mutable_body() {
   
-  return binding_key_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
-inline std::string* bindRequest::release_binding_key() {
-  // @@protoc_insertion_point(field_release:hare_mq.bindRequest.binding_key)
-  return binding_key_.Release();
+inline std::string* basicQueryResponse::release_body() {
+  // @@protoc_insertion_point(field_release:hare_mq.basicQueryResponse.body)
+  return _impl_.body_.Release();
 }
-inline void bindRequest::set_allocated_binding_key(std::string* binding_key) {
-  if (binding_key != nullptr) {
+inline void basicQueryResponse::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
     
   } else {
     
   }
-  binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (binding_key_.IsDefault()) {
-    binding_key_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindRequest.binding_key)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryResponse.body)
 }
 
 // -------------------------------------------------------------------
 
-// unbindRequest
+// heartbeatRequest
 
 // string rid = 1;
-inline void unbindRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void heartbeatRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& unbindRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.rid)
+inline const std::string& heartbeatRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.heartbeatRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void unbindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void heartbeatRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.heartbeatRequest.rid)
 }
-inline std::string* unbindRequest::mutable_rid() {
+inline std::string* heartbeatRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.heartbeatRequest.rid)
   return _s;
 }
-inline const std::string& unbindRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& heartbeatRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void unbindRequest::_internal_set_rid(const std::string& value) {
+inline void heartbeatRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* unbindRequest::_internal_mutable_rid() {
+inline std::string* heartbeatRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* unbindRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.rid)
-  return rid_.Release();
+inline std::string* heartbeatRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.heartbeatRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void unbindRequest::set_allocated_rid(std::string* rid) {
+inline void heartbeatRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.heartbeatRequest.rid)
 }
 
-// string cid = 2;
-inline void unbindRequest::clear_cid() {
-  cid_.ClearToEmpty();
-}
-inline const std::string& unbindRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.cid)
-  return _internal_cid();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void unbindRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.cid)
+// uint32 interval = 2;
+inline void heartbeatRequest::clear_interval() {
+  _impl_.interval_ = 0u;
 }
-inline std::string* unbindRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.cid)
-  return _s;
+inline uint32_t heartbeatRequest::_internal_interval() const {
+  return _impl_.interval_;
 }
-inline const std::string& unbindRequest::_internal_cid() const {
-  return cid_.Get();
-}
-inline void unbindRequest::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
+inline uint32_t heartbeatRequest::interval() const {
+  // @@protoc_insertion_point(field_get:hare_mq.heartbeatRequest.interval)
+  return _internal_interval();
 }
-inline std::string* unbindRequest::_internal_mutable_cid() {
+inline void heartbeatRequest::_internal_set_interval(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
-}
-inline std::string* unbindRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.cid)
-  return cid_.Release();
+  _impl_.interval_ = value;
 }
-inline void unbindRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.cid)
+inline void heartbeatRequest::set_interval(uint32_t value) {
+  _internal_set_interval(value);
+  // @@protoc_insertion_point(field_set:hare_mq.heartbeatRequest.interval)
 }
 
-// string exchange_name = 3;
-inline void unbindRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// heartbeatResponse
+
+// string rid = 1;
+inline void heartbeatResponse::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& unbindRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.exchange_name)
-  return _internal_exchange_name();
+inline const std::string& heartbeatResponse::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.heartbeatResponse.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void unbindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void heartbeatResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.exchange_name)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.heartbeatResponse.rid)
 }
-inline std::string* unbindRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.exchange_name)
+inline std::string* heartbeatResponse::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:hare_mq.heartbeatResponse.rid)
   return _s;
 }
-inline const std::string& unbindRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& heartbeatResponse::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void unbindRequest::_internal_set_exchange_name(const std::string& value) {
+inline void heartbeatResponse::_internal_set_rid(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* unbindRequest::_internal_mutable_exchange_name() {
+inline std::string* heartbeatResponse::_internal_mutable_rid() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* unbindRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* heartbeatResponse::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.heartbeatResponse.rid)
+  return _impl_.rid_.Release();
 }
-inline void unbindRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void heartbeatResponse::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.heartbeatResponse.rid)
 }
 
-// string queue_name = 4;
-inline void unbindRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// uint32 interval = 2;
+inline void heartbeatResponse::clear_interval() {
+  _impl_.interval_ = 0u;
 }
-inline const std::string& unbindRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.unbindRequest.queue_name)
-  return _internal_queue_name();
+inline uint32_t heartbeatResponse::_internal_interval() const {
+  return _impl_.interval_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void unbindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
- 
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.unbindRequest.queue_name)
+inline uint32_t heartbeatResponse::interval() const {
+  // @@protoc_insertion_point(field_get:hare_mq.heartbeatResponse.interval)
+  return _internal_interval();
 }
-inline std::string* unbindRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.unbindRequest.queue_name)
-  return _s;
+inline void heartbeatResponse::_internal_set_interval(uint32_t value) {
+  
+  _impl_.interval_ = value;
 }
-inline const std::string& unbindRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline void heartbeatResponse::set_interval(uint32_t value) {
+  _internal_set_interval(value);
+  // @@protoc_insertion_point(field_set:hare_mq.heartbeatResponse.interval)
 }
-inline void unbindRequest::_internal_set_queue_name(const std::string& value) {
-  
-  queue_name_.Set(value, GetArenaForAllocation());
+
+// -------------------------------------------------------------------
+
+// heartbeat
+
+// uint64 timestamp = 1;
+inline void heartbeat::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
 }
-inline std::string* unbindRequest::_internal_mutable_queue_name() {
-  
-  return queue_name_.Mutable(GetArenaForAllocation());
+inline uint64_t heartbeat::_internal_timestamp() const {
+  return _impl_.timestamp_;
 }
-inline std::string* unbindRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.unbindRequest.queue_name)
-  return queue_name_.Release();
+inline uint64_t heartbeat::timestamp() const {
+  // @@protoc_insertion_point(field_get:hare_mq.heartbeat.timestamp)
+  return _internal_timestamp();
 }
-inline void unbindRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
-    
-  } else {
-    
-  }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.unbindRequest.queue_name)
+inline void heartbeat::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void heartbeat::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:hare_mq.heartbeat.timestamp)
 }
 
 // -------------------------------------------------------------------
 
-// basicPublishRequest
+// metricsRequest
 
 // string rid = 1;
-inline void basicPublishRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void metricsRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& basicPublishRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.rid)
+inline const std::string& metricsRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void metricsRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricsRequest.rid)
 }
-inline std::string* basicPublishRequest::mutable_rid() {
+inline std::string* metricsRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsRequest.rid)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& metricsRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void basicPublishRequest::_internal_set_rid(const std::string& value) {
+inline void metricsRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_rid() {
+inline std::string* metricsRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.rid)
-  return rid_.Release();
+inline std::string* metricsRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricsRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void basicPublishRequest::set_allocated_rid(std::string* rid) {
+inline void metricsRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricsRequest.rid)
 }
 
 // string cid = 2;
-inline void basicPublishRequest::clear_cid() {
-  cid_.ClearToEmpty();
-}
-inline const std::string& basicPublishRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.cid)
+inline void metricsRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
+}
+inline const std::string& metricsRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsRequest.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void metricsRequest::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricsRequest.cid)
 }
-inline std::string* basicPublishRequest::mutable_cid() {
+inline std::string* metricsRequest::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsRequest.cid)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& metricsRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void basicPublishRequest::_internal_set_cid(const std::string& value) {
+inline void metricsRequest::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_cid() {
+inline std::string* metricsRequest::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.cid)
-  return cid_.Release();
+inline std::string* metricsRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricsRequest.cid)
+  return _impl_.cid_.Release();
 }
-inline void basicPublishRequest::set_allocated_cid(std::string* cid) {
+inline void metricsRequest::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricsRequest.cid)
 }
 
-// string exchange_name = 3;
-inline void basicPublishRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// bool prometheus_text = 3;
+inline void metricsRequest::clear_prometheus_text() {
+  _impl_.prometheus_text_ = false;
 }
-inline const std::string& basicPublishRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.exchange_name)
-  return _internal_exchange_name();
+inline bool metricsRequest::_internal_prometheus_text() const {
+  return _impl_.prometheus_text_;
+}
+inline bool metricsRequest::prometheus_text() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsRequest.prometheus_text)
+  return _internal_prometheus_text();
+}
+inline void metricsRequest::_internal_set_prometheus_text(bool value) {
+  
+  _impl_.prometheus_text_ = value;
+}
+inline void metricsRequest::set_prometheus_text(bool value) {
+  _internal_set_prometheus_text(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricsRequest.prometheus_text)
+}
+
+// -------------------------------------------------------------------
+
+// metricCounter
+
+// string name = 1;
+inline void metricCounter::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& metricCounter::name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricCounter.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void metricCounter::set_name(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.exchange_name)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricCounter.name)
 }
-inline std::string* basicPublishRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.exchange_name)
+inline std::string* metricCounter::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricCounter.name)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& metricCounter::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void basicPublishRequest::_internal_set_exchange_name(const std::string& value) {
+inline void metricCounter::_internal_set_name(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_exchange_name() {
+inline std::string* metricCounter::_internal_mutable_name() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* metricCounter::release_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricCounter.name)
+  return _impl_.name_.Release();
 }
-inline void basicPublishRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void metricCounter::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricCounter.name)
 }
 
-// string body = 4;
-inline void basicPublishRequest::clear_body() {
-  body_.ClearToEmpty();
+// uint64 value = 2;
+inline void metricCounter::clear_value() {
+  _impl_.value_ = uint64_t{0u};
 }
-inline const std::string& basicPublishRequest::body() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.body)
-  return _internal_body();
+inline uint64_t metricCounter::_internal_value() const {
+  return _impl_.value_;
+}
+inline uint64_t metricCounter::value() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricCounter.value)
+  return _internal_value();
+}
+inline void metricCounter::_internal_set_value(uint64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void metricCounter::set_value(uint64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricCounter.value)
+}
+
+// -------------------------------------------------------------------
+
+// metricHistogram
+
+// string name = 1;
+inline void metricHistogram::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& metricHistogram::name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_body(ArgT0&& arg0, ArgT... args) {
+void metricHistogram::set_name(ArgT0&& arg0, ArgT... args) {
  
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicPublishRequest.body)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.name)
 }
-inline std::string* basicPublishRequest::mutable_body() {
-  std::string* _s = _internal_mutable_body();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.body)
+inline std::string* metricHistogram::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricHistogram.name)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_body() const {
-  return body_.Get();
+inline const std::string& metricHistogram::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void basicPublishRequest::_internal_set_body(const std::string& value) {
+inline void metricHistogram::_internal_set_name(const std::string& value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_body() {
+inline std::string* metricHistogram::_internal_mutable_name() {
   
-  return body_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_body() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.body)
-  return body_.Release();
+inline std::string* metricHistogram::release_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricHistogram.name)
+  return _impl_.name_.Release();
 }
-inline void basicPublishRequest::set_allocated_body(std::string* body) {
-  if (body != nullptr) {
+inline void metricHistogram::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  body_.SetAllocated(body, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.body)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricHistogram.name)
 }
 
-// .hare_mq.BasicProperties properties = 5;
-inline bool basicPublishRequest::_internal_has_properties() const {
-  return this != internal_default_instance() && properties_ != nullptr;
+// uint64 count = 2;
+inline void metricHistogram::clear_count() {
+  _impl_.count_ = uint64_t{0u};
 }
-inline bool basicPublishRequest::has_properties() const {
-  return _internal_has_properties();
+inline uint64_t metricHistogram::_internal_count() const {
+  return _impl_.count_;
 }
-inline const ::hare_mq::BasicProperties& basicPublishRequest::_internal_properties() const {
-  const ::hare_mq::BasicProperties* p = properties_;
-  return p != nullptr ? *p : reinterpret_cast<const ::hare_mq::BasicProperties&>(
-      ::hare_mq::_BasicProperties_default_instance_);
+inline uint64_t metricHistogram::count() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.count)
+  return _internal_count();
 }
-inline const ::hare_mq::BasicProperties& basicPublishRequest::properties() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicPublishRequest.properties)
-  return _internal_properties();
+inline void metricHistogram::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
 }
-inline void basicPublishRequest::unsafe_arena_set_allocated_properties(
-    ::hare_mq::BasicProperties* properties) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
-  }
-  properties_ = properties;
-  if (properties) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hare_mq.basicPublishRequest.properties)
+inline void metricHistogram::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.count)
 }
-inline ::hare_mq::BasicProperties* basicPublishRequest::release_properties() {
+
+// uint64 sum = 3;
+inline void metricHistogram::clear_sum() {
+  _impl_.sum_ = uint64_t{0u};
+}
+inline uint64_t metricHistogram::_internal_sum() const {
+  return _impl_.sum_;
+}
+inline uint64_t metricHistogram::sum() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.sum)
+  return _internal_sum();
+}
+inline void metricHistogram::_internal_set_sum(uint64_t value) {
   
-  ::hare_mq::BasicProperties* temp = properties_;
-  properties_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.sum_ = value;
 }
-inline ::hare_mq::BasicProperties* basicPublishRequest::unsafe_arena_release_properties() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicPublishRequest.properties)
+inline void metricHistogram::set_sum(uint64_t value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.sum)
+}
+
+// uint64 p50 = 4;
+inline void metricHistogram::clear_p50() {
+  _impl_.p50_ = uint64_t{0u};
+}
+inline uint64_t metricHistogram::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline uint64_t metricHistogram::p50() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.p50)
+  return _internal_p50();
+}
+inline void metricHistogram::_internal_set_p50(uint64_t value) {
   
-  ::hare_mq::BasicProperties* temp = properties_;
-  properties_ = nullptr;
-  return temp;
+  _impl_.p50_ = value;
 }
-inline ::hare_mq::BasicProperties* basicPublishRequest::_internal_mutable_properties() {
+inline void metricHistogram::set_p50(uint64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.p50)
+}
+
+// uint64 p90 = 5;
+inline void metricHistogram::clear_p90() {
+  _impl_.p90_ = uint64_t{0u};
+}
+inline uint64_t metricHistogram::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline uint64_t metricHistogram::p90() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.p90)
+  return _internal_p90();
+}
+inline void metricHistogram::_internal_set_p90(uint64_t value) {
   
-  if (properties_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hare_mq::BasicProperties>(GetArenaForAllocation());
-    properties_ = p;
-  }
-  return properties_;
+  _impl_.p90_ = value;
 }
-inline ::hare_mq::BasicProperties* basicPublishRequest::mutable_properties() {
-  ::hare_mq::BasicProperties* _msg = _internal_mutable_properties();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicPublishRequest.properties)
-  return _msg;
+inline void metricHistogram::set_p90(uint64_t value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.p90)
 }
-inline void basicPublishRequest::set_allocated_properties(::hare_mq::BasicProperties* properties) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
-  }
-  if (properties) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
-    if (message_arena != submessage_arena) {
-      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, properties, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  properties_ = properties;
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicPublishRequest.properties)
+
+// uint64 p99 = 6;
+inline void metricHistogram::clear_p99() {
+  _impl_.p99_ = uint64_t{0u};
+}
+inline uint64_t metricHistogram::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline uint64_t metricHistogram::p99() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.p99)
+  return _internal_p99();
+}
+inline void metricHistogram::_internal_set_p99(uint64_t value) {
+  
+  _impl_.p99_ = value;
+}
+inline void metricHistogram::set_p99(uint64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.p99)
+}
+
+// uint64 p999 = 7;
+inline void metricHistogram::clear_p999() {
+  _impl_.p999_ = uint64_t{0u};
+}
+inline uint64_t metricHistogram::_internal_p999() const {
+  return _impl_.p999_;
+}
+inline uint64_t metricHistogram::p999() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.p999)
+  return _internal_p999();
+}
+inline void metricHistogram::_internal_set_p999(uint64_t value) {
+  
+  _impl_.p999_ = value;
+}
+inline void metricHistogram::set_p999(uint64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.p999)
+}
+
+// uint64 max = 8;
+inline void metricHistogram::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t metricHistogram::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t metricHistogram::max() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricHistogram.max)
+  return _internal_max();
+}
+inline void metricHistogram::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void metricHistogram::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricHistogram.max)
 }
 
 // -------------------------------------------------------------------
 
-// basicAckRequest
+// queueMetrics
 
-// string rid = 1;
-inline void basicAckRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string name = 1;
+inline void queueMetrics::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline const std::string& basicAckRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.rid)
-  return _internal_rid();
+inline const std::string& queueMetrics::name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicAckRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void queueMetrics::set_name(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.rid)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.name)
 }
-inline std::string* basicAckRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.rid)
+inline std::string* queueMetrics::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.queueMetrics.name)
   return _s;
 }
-inline const std::string& basicAckRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& queueMetrics::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void basicAckRequest::_internal_set_rid(const std::string& value) {
+inline void queueMetrics::_internal_set_name(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicAckRequest::_internal_mutable_rid() {
+inline std::string* queueMetrics::_internal_mutable_name() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicAckRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.rid)
-  return rid_.Release();
+inline std::string* queueMetrics::release_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.queueMetrics.name)
+  return _impl_.name_.Release();
 }
-inline void basicAckRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void queueMetrics::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.queueMetrics.name)
 }
 
-// string cid = 2;
-inline void basicAckRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// uint64 depth = 2;
+inline void queueMetrics::clear_depth() {
+  _impl_.depth_ = uint64_t{0u};
 }
-inline const std::string& basicAckRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.cid)
-  return _internal_cid();
+inline uint64_t queueMetrics::_internal_depth() const {
+  return _impl_.depth_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicAckRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.cid)
+inline uint64_t queueMetrics::depth() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.depth)
+  return _internal_depth();
 }
-inline std::string* basicAckRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.cid)
-  return _s;
+inline void queueMetrics::_internal_set_depth(uint64_t value) {
+  
+  _impl_.depth_ = value;
 }
-inline const std::string& basicAckRequest::_internal_cid() const {
-  return cid_.Get();
+inline void queueMetrics::set_depth(uint64_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.depth)
 }
-inline void basicAckRequest::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
+
+// uint64 unacked = 3;
+inline void queueMetrics::clear_unacked() {
+  _impl_.unacked_ = uint64_t{0u};
 }
-inline std::string* basicAckRequest::_internal_mutable_cid() {
-  
-  return cid_.Mutable(GetArenaForAllocation());
+inline uint64_t queueMetrics::_internal_unacked() const {
+  return _impl_.unacked_;
 }
-inline std::string* basicAckRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.cid)
-  return cid_.Release();
+inline uint64_t queueMetrics::unacked() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.unacked)
+  return _internal_unacked();
 }
-inline void basicAckRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.cid)
+inline void queueMetrics::_internal_set_unacked(uint64_t value) {
+  
+  _impl_.unacked_ = value;
+}
+inline void queueMetrics::set_unacked(uint64_t value) {
+  _internal_set_unacked(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.unacked)
 }
 
-// string queue_name = 3;
-inline void basicAckRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// uint64 disk_bytes = 4;
+inline void queueMetrics::clear_disk_bytes() {
+  _impl_.disk_bytes_ = uint64_t{0u};
 }
-inline const std::string& basicAckRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.queue_name)
-  return _internal_queue_name();
+inline uint64_t queueMetrics::_internal_disk_bytes() const {
+  return _impl_.disk_bytes_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicAckRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
- 
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.queue_name)
+inline uint64_t queueMetrics::disk_bytes() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.disk_bytes)
+  return _internal_disk_bytes();
 }
-inline std::string* basicAckRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.queue_name)
-  return _s;
+inline void queueMetrics::_internal_set_disk_bytes(uint64_t value) {
+  
+  _impl_.disk_bytes_ = value;
 }
-inline const std::string& basicAckRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline void queueMetrics::set_disk_bytes(uint64_t value) {
+  _internal_set_disk_bytes(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.disk_bytes)
 }
-inline void basicAckRequest::_internal_set_queue_name(const std::string& value) {
-  
-  queue_name_.Set(value, GetArenaForAllocation());
+
+// uint64 published = 5;
+inline void queueMetrics::clear_published() {
+  _impl_.published_ = uint64_t{0u};
 }
-inline std::string* basicAckRequest::_internal_mutable_queue_name() {
-  
-  return queue_name_.Mutable(GetArenaForAllocation());
+inline uint64_t queueMetrics::_internal_published() const {
+  return _impl_.published_;
 }
-inline std::string* basicAckRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.queue_name)
-  return queue_name_.Release();
+inline uint64_t queueMetrics::published() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.published)
+  return _internal_published();
 }
-inline void basicAckRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
-    
-  } else {
-    
-  }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.queue_name)
+inline void queueMetrics::_internal_set_published(uint64_t value) {
+  
+  _impl_.published_ = value;
+}
+inline void queueMetrics::set_published(uint64_t value) {
+  _internal_set_published(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.published)
 }
 
-// string message_id = 4;
-inline void basicAckRequest::clear_message_id() {
-  message_id_.ClearToEmpty();
+// uint64 delivered = 6;
+inline void queueMetrics::clear_delivered() {
+  _impl_.delivered_ = uint64_t{0u};
+}
+inline uint64_t queueMetrics::_internal_delivered() const {
+  return _impl_.delivered_;
+}
+inline uint64_t queueMetrics::delivered() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.delivered)
+  return _internal_delivered();
+}
+inline void queueMetrics::_internal_set_delivered(uint64_t value) {
+  
+  _impl_.delivered_ = value;
 }
-inline const std::string& basicAckRequest::message_id() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicAckRequest.message_id)
-  return _internal_message_id();
+inline void queueMetrics::set_delivered(uint64_t value) {
+  _internal_set_delivered(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.delivered)
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicAckRequest::set_message_id(ArgT0&& arg0, ArgT... args) {
- 
- message_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicAckRequest.message_id)
+
+// uint64 acked = 7;
+inline void queueMetrics::clear_acked() {
+  _impl_.acked_ = uint64_t{0u};
 }
-inline std::string* basicAckRequest::mutable_message_id() {
-  std::string* _s = _internal_mutable_message_id();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicAckRequest.message_id)
-  return _s;
+inline uint64_t queueMetrics::_internal_acked() const {
+  return _impl_.acked_;
 }
-inline const std::string& basicAckRequest::_internal_message_id() const {
-  return message_id_.Get();
+inline uint64_t queueMetrics::acked() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.acked)
+  return _internal_acked();
 }
-inline void basicAckRequest::_internal_set_message_id(const std::string& value) {
+inline void queueMetrics::_internal_set_acked(uint64_t value) {
   
-  message_id_.Set(value, GetArenaForAllocation());
+  _impl_.acked_ = value;
 }
-inline std::string* basicAckRequest::_internal_mutable_message_id() {
-  
-  return message_id_.Mutable(GetArenaForAllocation());
+inline void queueMetrics::set_acked(uint64_t value) {
+  _internal_set_acked(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.acked)
 }
-inline std::string* basicAckRequest::release_message_id() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicAckRequest.message_id)
-  return message_id_.Release();
+
+// uint64 redelivered = 8;
+inline void queueMetrics::clear_redelivered() {
+  _impl_.redelivered_ = uint64_t{0u};
 }
-inline void basicAckRequest::set_allocated_message_id(std::string* message_id) {
-  if (message_id != nullptr) {
-    
-  } else {
-    
-  }
-  message_id_.SetAllocated(message_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (message_id_.IsDefault()) {
-    message_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicAckRequest.message_id)
+inline uint64_t queueMetrics::_internal_redelivered() const {
+  return _impl_.redelivered_;
+}
+inline uint64_t queueMetrics::redelivered() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueMetrics.redelivered)
+  return _internal_redelivered();
+}
+inline void queueMetrics::_internal_set_redelivered(uint64_t value) {
+  
+  _impl_.redelivered_ = value;
+}
+inline void queueMetrics::set_redelivered(uint64_t value) {
+  _internal_set_redelivered(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueMetrics.redelivered)
 }
 
 // -------------------------------------------------------------------
 
-// basicConsumeRequest
+// metricsResponse
 
 // string rid = 1;
-inline void basicConsumeRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void metricsResponse::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& basicConsumeRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.rid)
+inline const std::string& metricsResponse::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void metricsResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricsResponse.rid)
 }
-inline std::string* basicConsumeRequest::mutable_rid() {
+inline std::string* metricsResponse::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.rid)
   return _s;
 }
-inline const std::string& basicConsumeRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& metricsResponse::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void basicConsumeRequest::_internal_set_rid(const std::string& value) {
+inline void metricsResponse::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicConsumeRequest::_internal_mutable_rid() {
+inline std::string* metricsResponse::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicConsumeRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.rid)
-  return rid_.Release();
+inline std::string* metricsResponse::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricsResponse.rid)
+  return _impl_.rid_.Release();
 }
-inline void basicConsumeRequest::set_allocated_rid(std::string* rid) {
+inline void metricsResponse::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricsResponse.rid)
 }
 
 // string cid = 2;
-inline void basicConsumeRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void metricsResponse::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& basicConsumeRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.cid)
+inline const std::string& metricsResponse::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void metricsResponse::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricsResponse.cid)
 }
-inline std::string* basicConsumeRequest::mutable_cid() {
+inline std::string* metricsResponse::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.cid)
   return _s;
 }
-inline const std::string& basicConsumeRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& metricsResponse::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void basicConsumeRequest::_internal_set_cid(const std::string& value) {
+inline void metricsResponse::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicConsumeRequest::_internal_mutable_cid() {
+inline std::string* metricsResponse::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicConsumeRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.cid)
-  return cid_.Release();
+inline std::string* metricsResponse::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricsResponse.cid)
+  return _impl_.cid_.Release();
 }
-inline void basicConsumeRequest::set_allocated_cid(std::string* cid) {
+inline void metricsResponse::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricsResponse.cid)
 }
 
-// string consumer_tag = 3;
-inline void basicConsumeRequest::clear_consumer_tag() {
-  consumer_tag_.ClearToEmpty();
+// bool ok = 3;
+inline void metricsResponse::clear_ok() {
+  _impl_.ok_ = false;
 }
-inline const std::string& basicConsumeRequest::consumer_tag() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.consumer_tag)
-  return _internal_consumer_tag();
+inline bool metricsResponse::_internal_ok() const {
+  return _impl_.ok_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeRequest::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
- 
- consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.consumer_tag)
+inline bool metricsResponse::ok() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.ok)
+  return _internal_ok();
 }
-inline std::string* basicConsumeRequest::mutable_consumer_tag() {
-  std::string* _s = _internal_mutable_consumer_tag();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.consumer_tag)
-  return _s;
+inline void metricsResponse::_internal_set_ok(bool value) {
+  
+  _impl_.ok_ = value;
 }
-inline const std::string& basicConsumeRequest::_internal_consumer_tag() const {
-  return consumer_tag_.Get();
+inline void metricsResponse::set_ok(bool value) {
+  _internal_set_ok(value);
+  // @@protoc_insertion_point(field_set:hare_mq.metricsResponse.ok)
 }
-inline void basicConsumeRequest::_internal_set_consumer_tag(const std::string& value) {
-  
-  consumer_tag_.Set(value, GetArenaForAllocation());
+
+// repeated .hare_mq.metricCounter counters = 4;
+inline int metricsResponse::_internal_counters_size() const {
+  return _impl_.counters_.size();
 }
-inline std::string* basicConsumeRequest::_internal_mutable_consumer_tag() {
-  
-  return consumer_tag_.Mutable(GetArenaForAllocation());
+inline int metricsResponse::counters_size() const {
+  return _internal_counters_size();
 }
-inline std::string* basicConsumeRequest::release_consumer_tag() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.consumer_tag)
-  return consumer_tag_.Release();
+inline void metricsResponse::clear_counters() {
+  _impl_.counters_.Clear();
 }
-inline void basicConsumeRequest::set_allocated_consumer_tag(std::string* consumer_tag) {
-  if (consumer_tag != nullptr) {
-    
-  } else {
-    
-  }
-  consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (consumer_tag_.IsDefault()) {
-    consumer_tag_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.consumer_tag)
+inline ::hare_mq::metricCounter* metricsResponse::mutable_counters(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.counters)
+  return _impl_.counters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricCounter >*
+metricsResponse::mutable_counters() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.metricsResponse.counters)
+  return &_impl_.counters_;
+}
+inline const ::hare_mq::metricCounter& metricsResponse::_internal_counters(int index) const {
+  return _impl_.counters_.Get(index);
+}
+inline const ::hare_mq::metricCounter& metricsResponse::counters(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.counters)
+  return _internal_counters(index);
+}
+inline ::hare_mq::metricCounter* metricsResponse::_internal_add_counters() {
+  return _impl_.counters_.Add();
+}
+inline ::hare_mq::metricCounter* metricsResponse::add_counters() {
+  ::hare_mq::metricCounter* _add = _internal_add_counters();
+  // @@protoc_insertion_point(field_add:hare_mq.metricsResponse.counters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricCounter >&
+metricsResponse::counters() const {
+  // @@protoc_insertion_point(field_list:hare_mq.metricsResponse.counters)
+  return _impl_.counters_;
 }
 
-// string queue_name = 4;
-inline void basicConsumeRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// repeated .hare_mq.metricHistogram histograms = 5;
+inline int metricsResponse::_internal_histograms_size() const {
+  return _impl_.histograms_.size();
 }
-inline const std::string& basicConsumeRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.queue_name)
-  return _internal_queue_name();
+inline int metricsResponse::histograms_size() const {
+  return _internal_histograms_size();
+}
+inline void metricsResponse::clear_histograms() {
+  _impl_.histograms_.Clear();
+}
+inline ::hare_mq::metricHistogram* metricsResponse::mutable_histograms(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.histograms)
+  return _impl_.histograms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >*
+metricsResponse::mutable_histograms() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.metricsResponse.histograms)
+  return &_impl_.histograms_;
+}
+inline const ::hare_mq::metricHistogram& metricsResponse::_internal_histograms(int index) const {
+  return _impl_.histograms_.Get(index);
+}
+inline const ::hare_mq::metricHistogram& metricsResponse::histograms(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.histograms)
+  return _internal_histograms(index);
+}
+inline ::hare_mq::metricHistogram* metricsResponse::_internal_add_histograms() {
+  return _impl_.histograms_.Add();
+}
+inline ::hare_mq::metricHistogram* metricsResponse::add_histograms() {
+  ::hare_mq::metricHistogram* _add = _internal_add_histograms();
+  // @@protoc_insertion_point(field_add:hare_mq.metricsResponse.histograms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >&
+metricsResponse::histograms() const {
+  // @@protoc_insertion_point(field_list:hare_mq.metricsResponse.histograms)
+  return _impl_.histograms_;
+}
+
+// repeated .hare_mq.queueMetrics queues = 6;
+inline int metricsResponse::_internal_queues_size() const {
+  return _impl_.queues_.size();
+}
+inline int metricsResponse::queues_size() const {
+  return _internal_queues_size();
+}
+inline void metricsResponse::clear_queues() {
+  _impl_.queues_.Clear();
+}
+inline ::hare_mq::queueMetrics* metricsResponse::mutable_queues(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.queues)
+  return _impl_.queues_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueMetrics >*
+metricsResponse::mutable_queues() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.metricsResponse.queues)
+  return &_impl_.queues_;
+}
+inline const ::hare_mq::queueMetrics& metricsResponse::_internal_queues(int index) const {
+  return _impl_.queues_.Get(index);
+}
+inline const ::hare_mq::queueMetrics& metricsResponse::queues(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.queues)
+  return _internal_queues(index);
+}
+inline ::hare_mq::queueMetrics* metricsResponse::_internal_add_queues() {
+  return _impl_.queues_.Add();
+}
+inline ::hare_mq::queueMetrics* metricsResponse::add_queues() {
+  ::hare_mq::queueMetrics* _add = _internal_add_queues();
+  // @@protoc_insertion_point(field_add:hare_mq.metricsResponse.queues)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueMetrics >&
+metricsResponse::queues() const {
+  // @@protoc_insertion_point(field_list:hare_mq.metricsResponse.queues)
+  return _impl_.queues_;
+}
+
+// string text = 7;
+inline void metricsResponse::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& metricsResponse::text() const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.text)
+  return _internal_text();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void metricsResponse::set_text(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.queue_name)
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.metricsResponse.text)
 }
-inline std::string* basicConsumeRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeRequest.queue_name)
+inline std::string* metricsResponse::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.text)
   return _s;
 }
-inline const std::string& basicConsumeRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& metricsResponse::_internal_text() const {
+  return _impl_.text_.Get();
 }
-inline void basicConsumeRequest::_internal_set_queue_name(const std::string& value) {
+inline void metricsResponse::_internal_set_text(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.text_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicConsumeRequest::_internal_mutable_queue_name() {
+inline std::string* metricsResponse::_internal_mutable_text() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.text_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicConsumeRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* metricsResponse::release_text() {
+  // @@protoc_insertion_point(field_release:hare_mq.metricsResponse.text)
+  return _impl_.text_.Release();
 }
-inline void basicConsumeRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void metricsResponse::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeRequest.queue_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.metricsResponse.text)
 }
 
-// bool auto_ack = 5;
-inline void basicConsumeRequest::clear_auto_ack() {
-  auto_ack_ = false;
+// repeated .hare_mq.metricHistogram requests = 8;
+inline int metricsResponse::_internal_requests_size() const {
+  return _impl_.requests_.size();
 }
-inline bool basicConsumeRequest::_internal_auto_ack() const {
-  return auto_ack_;
+inline int metricsResponse::requests_size() const {
+  return _internal_requests_size();
 }
-inline bool basicConsumeRequest::auto_ack() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeRequest.auto_ack)
-  return _internal_auto_ack();
+inline void metricsResponse::clear_requests() {
+  _impl_.requests_.Clear();
 }
-inline void basicConsumeRequest::_internal_set_auto_ack(bool value) {
-  
-  auto_ack_ = value;
+inline ::hare_mq::metricHistogram* metricsResponse::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.metricsResponse.requests)
+  return _impl_.requests_.Mutable(index);
 }
-inline void basicConsumeRequest::set_auto_ack(bool value) {
-  _internal_set_auto_ack(value);
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeRequest.auto_ack)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >*
+metricsResponse::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.metricsResponse.requests)
+  return &_impl_.requests_;
+}
+inline const ::hare_mq::metricHistogram& metricsResponse::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const ::hare_mq::metricHistogram& metricsResponse::requests(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.metricsResponse.requests)
+  return _internal_requests(index);
+}
+inline ::hare_mq::metricHistogram* metricsResponse::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline ::hare_mq::metricHistogram* metricsResponse::add_requests() {
+  ::hare_mq::metricHistogram* _add = _internal_add_requests();
+  // @@protoc_insertion_point(field_add:hare_mq.metricsResponse.requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::metricHistogram >&
+metricsResponse::requests() const {
+  // @@protoc_insertion_point(field_list:hare_mq.metricsResponse.requests)
+  return _impl_.requests_;
 }
 
 // -------------------------------------------------------------------
 
-// basicCancelRequest
+// statsRequest
 
 // string rid = 1;
-inline void basicCancelRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void statsRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& basicCancelRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.rid)
+inline const std::string& statsRequest::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicCancelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void statsRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.rid)
 }
-inline std::string* basicCancelRequest::mutable_rid() {
+inline std::string* statsRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsRequest.rid)
   return _s;
 }
-inline const std::string& basicCancelRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& statsRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void basicCancelRequest::_internal_set_rid(const std::string& value) {
+inline void statsRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::_internal_mutable_rid() {
+inline std::string* statsRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.rid)
-  return rid_.Release();
+inline std::string* statsRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.statsRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void basicCancelRequest::set_allocated_rid(std::string* rid) {
+inline void statsRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.statsRequest.rid)
 }
 
 // string cid = 2;
-inline void basicCancelRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void statsRequest::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& basicCancelRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.cid)
+inline const std::string& statsRequest::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicCancelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void statsRequest::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.cid)
 }
-inline std::string* basicCancelRequest::mutable_cid() {
+inline std::string* statsRequest::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsRequest.cid)
   return _s;
 }
-inline const std::string& basicCancelRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& statsRequest::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void basicCancelRequest::_internal_set_cid(const std::string& value) {
+inline void statsRequest::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::_internal_mutable_cid() {
+inline std::string* statsRequest::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.cid)
-  return cid_.Release();
+inline std::string* statsRequest::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.statsRequest.cid)
+  return _impl_.cid_.Release();
 }
-inline void basicCancelRequest::set_allocated_cid(std::string* cid) {
+inline void statsRequest::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.statsRequest.cid)
 }
 
-// string consumer_tag = 3;
-inline void basicCancelRequest::clear_consumer_tag() {
-  consumer_tag_.ClearToEmpty();
+// .hare_mq.StatsSection section = 3;
+inline void statsRequest::clear_section() {
+  _impl_.section_ = 0;
 }
-inline const std::string& basicCancelRequest::consumer_tag() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.consumer_tag)
-  return _internal_consumer_tag();
+inline ::hare_mq::StatsSection statsRequest::_internal_section() const {
+  return static_cast< ::hare_mq::StatsSection >(_impl_.section_);
+}
+inline ::hare_mq::StatsSection statsRequest::section() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.section)
+  return _internal_section();
+}
+inline void statsRequest::_internal_set_section(::hare_mq::StatsSection value) {
+  
+  _impl_.section_ = value;
+}
+inline void statsRequest::set_section(::hare_mq::StatsSection value) {
+  _internal_set_section(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.section)
+}
+
+// string name_prefix = 4;
+inline void statsRequest::clear_name_prefix() {
+  _impl_.name_prefix_.ClearToEmpty();
+}
+inline const std::string& statsRequest::name_prefix() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.name_prefix)
+  return _internal_name_prefix();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicCancelRequest::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
+void statsRequest::set_name_prefix(ArgT0&& arg0, ArgT... args) {
  
- consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.consumer_tag)
+ _impl_.name_prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.name_prefix)
 }
-inline std::string* basicCancelRequest::mutable_consumer_tag() {
-  std::string* _s = _internal_mutable_consumer_tag();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.consumer_tag)
+inline std::string* statsRequest::mutable_name_prefix() {
+  std::string* _s = _internal_mutable_name_prefix();
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsRequest.name_prefix)
+  return _s;
+}
+inline const std::string& statsRequest::_internal_name_prefix() const {
+  return _impl_.name_prefix_.Get();
+}
+inline void statsRequest::_internal_set_name_prefix(const std::string& value) {
+  
+  _impl_.name_prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* statsRequest::_internal_mutable_name_prefix() {
+  
+  return _impl_.name_prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* statsRequest::release_name_prefix() {
+  // @@protoc_insertion_point(field_release:hare_mq.statsRequest.name_prefix)
+  return _impl_.name_prefix_.Release();
+}
+inline void statsRequest::set_allocated_name_prefix(std::string* name_prefix) {
+  if (name_prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_prefix_.SetAllocated(name_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_prefix_.IsDefault()) {
+    _impl_.name_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.statsRequest.name_prefix)
+}
+
+// bool include_bindings = 5;
+inline void statsRequest::clear_include_bindings() {
+  _impl_.include_bindings_ = false;
+}
+inline bool statsRequest::_internal_include_bindings() const {
+  return _impl_.include_bindings_;
+}
+inline bool statsRequest::include_bindings() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.include_bindings)
+  return _internal_include_bindings();
+}
+inline void statsRequest::_internal_set_include_bindings(bool value) {
+  
+  _impl_.include_bindings_ = value;
+}
+inline void statsRequest::set_include_bindings(bool value) {
+  _internal_set_include_bindings(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.include_bindings)
+}
+
+// uint32 offset = 6;
+inline void statsRequest::clear_offset() {
+  _impl_.offset_ = 0u;
+}
+inline uint32_t statsRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t statsRequest::offset() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.offset)
+  return _internal_offset();
+}
+inline void statsRequest::_internal_set_offset(uint32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void statsRequest::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.offset)
+}
+
+// uint32 limit = 7;
+inline void statsRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t statsRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t statsRequest::limit() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsRequest.limit)
+  return _internal_limit();
+}
+inline void statsRequest::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void statsRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// bindingStats
+
+// string queue_name = 1;
+inline void bindingStats::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& bindingStats::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindingStats.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void bindingStats::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindingStats.queue_name)
+}
+inline std::string* bindingStats::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindingStats.queue_name)
   return _s;
 }
-inline const std::string& basicCancelRequest::_internal_consumer_tag() const {
-  return consumer_tag_.Get();
+inline const std::string& bindingStats::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void basicCancelRequest::_internal_set_consumer_tag(const std::string& value) {
+inline void bindingStats::_internal_set_queue_name(const std::string& value) {
   
-  consumer_tag_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::_internal_mutable_consumer_tag() {
+inline std::string* bindingStats::_internal_mutable_queue_name() {
   
-  return consumer_tag_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::release_consumer_tag() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.consumer_tag)
-  return consumer_tag_.Release();
+inline std::string* bindingStats::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindingStats.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void basicCancelRequest::set_allocated_consumer_tag(std::string* consumer_tag) {
-  if (consumer_tag != nullptr) {
+inline void bindingStats::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (consumer_tag_.IsDefault()) {
-    consumer_tag_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.consumer_tag)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindingStats.queue_name)
 }
 
-// string queue_name = 4;
-inline void basicCancelRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// string binding_key = 2;
+inline void bindingStats::clear_binding_key() {
+  _impl_.binding_key_.ClearToEmpty();
 }
-inline const std::string& basicCancelRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCancelRequest.queue_name)
-  return _internal_queue_name();
+inline const std::string& bindingStats::binding_key() const {
+  // @@protoc_insertion_point(field_get:hare_mq.bindingStats.binding_key)
+  return _internal_binding_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicCancelRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void bindingStats::set_binding_key(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicCancelRequest.queue_name)
+ _impl_.binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.bindingStats.binding_key)
 }
-inline std::string* basicCancelRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicCancelRequest.queue_name)
+inline std::string* bindingStats::mutable_binding_key() {
+  std::string* _s = _internal_mutable_binding_key();
+  // @@protoc_insertion_point(field_mutable:hare_mq.bindingStats.binding_key)
   return _s;
 }
-inline const std::string& basicCancelRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& bindingStats::_internal_binding_key() const {
+  return _impl_.binding_key_.Get();
 }
-inline void basicCancelRequest::_internal_set_queue_name(const std::string& value) {
+inline void bindingStats::_internal_set_binding_key(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.binding_key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::_internal_mutable_queue_name() {
+inline std::string* bindingStats::_internal_mutable_binding_key() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.binding_key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicCancelRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicCancelRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* bindingStats::release_binding_key() {
+  // @@protoc_insertion_point(field_release:hare_mq.bindingStats.binding_key)
+  return _impl_.binding_key_.Release();
 }
-inline void basicCancelRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void bindingStats::set_allocated_binding_key(std::string* binding_key) {
+  if (binding_key != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.binding_key_.IsDefault()) {
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCancelRequest.queue_name)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.bindingStats.binding_key)
 }
 
 // -------------------------------------------------------------------
 
-// basicConsumeResponse
+// exchangeStats
 
-// string cid = 1;
-inline void basicConsumeResponse::clear_cid() {
-  cid_.ClearToEmpty();
+// string name = 1;
+inline void exchangeStats::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline const std::string& basicConsumeResponse::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.cid)
-  return _internal_cid();
+inline const std::string& exchangeStats::name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.exchangeStats.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeResponse::set_cid(ArgT0&& arg0, ArgT... args) {
+void exchangeStats::set_name(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.cid)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.exchangeStats.name)
 }
-inline std::string* basicConsumeResponse::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.cid)
+inline std::string* exchangeStats::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.exchangeStats.name)
   return _s;
 }
-inline const std::string& basicConsumeResponse::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& exchangeStats::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void basicConsumeResponse::_internal_set_cid(const std::string& value) {
+inline void exchangeStats::_internal_set_name(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicConsumeResponse::_internal_mutable_cid() {
+inline std::string* exchangeStats::_internal_mutable_name() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicConsumeResponse::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.cid)
-  return cid_.Release();
+inline std::string* exchangeStats::release_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.exchangeStats.name)
+  return _impl_.name_.Release();
 }
-inline void basicConsumeResponse::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void exchangeStats::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.exchangeStats.name)
 }
 
-// string consumer_tag = 2;
-inline void basicConsumeResponse::clear_consumer_tag() {
-  consumer_tag_.ClearToEmpty();
+// .hare_mq.ExchangeType type = 2;
+inline void exchangeStats::clear_type() {
+  _impl_.type_ = 0;
 }
-inline const std::string& basicConsumeResponse::consumer_tag() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.consumer_tag)
-  return _internal_consumer_tag();
+inline ::hare_mq::ExchangeType exchangeStats::_internal_type() const {
+  return static_cast< ::hare_mq::ExchangeType >(_impl_.type_);
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeResponse::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
- 
- consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.consumer_tag)
+inline ::hare_mq::ExchangeType exchangeStats::type() const {
+  // @@protoc_insertion_point(field_get:hare_mq.exchangeStats.type)
+  return _internal_type();
 }
-inline std::string* basicConsumeResponse::mutable_consumer_tag() {
-  std::string* _s = _internal_mutable_consumer_tag();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.consumer_tag)
-  return _s;
+inline void exchangeStats::_internal_set_type(::hare_mq::ExchangeType value) {
+  
+  _impl_.type_ = value;
 }
-inline const std::string& basicConsumeResponse::_internal_consumer_tag() const {
-  return consumer_tag_.Get();
+inline void exchangeStats::set_type(::hare_mq::ExchangeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:hare_mq.exchangeStats.type)
 }
-inline void basicConsumeResponse::_internal_set_consumer_tag(const std::string& value) {
+
+// bool durable = 3;
+inline void exchangeStats::clear_durable() {
+  _impl_.durable_ = false;
+}
+inline bool exchangeStats::_internal_durable() const {
+  return _impl_.durable_;
+}
+inline bool exchangeStats::durable() const {
+  // @@protoc_insertion_point(field_get:hare_mq.exchangeStats.durable)
+  return _internal_durable();
+}
+inline void exchangeStats::_internal_set_durable(bool value) {
   
-  consumer_tag_.Set(value, GetArenaForAllocation());
+  _impl_.durable_ = value;
 }
-inline std::string* basicConsumeResponse::_internal_mutable_consumer_tag() {
+inline void exchangeStats::set_durable(bool value) {
+  _internal_set_durable(value);
+  // @@protoc_insertion_point(field_set:hare_mq.exchangeStats.durable)
+}
+
+// bool auto_delete = 4;
+inline void exchangeStats::clear_auto_delete() {
+  _impl_.auto_delete_ = false;
+}
+inline bool exchangeStats::_internal_auto_delete() const {
+  return _impl_.auto_delete_;
+}
+inline bool exchangeStats::auto_delete() const {
+  // @@protoc_insertion_point(field_get:hare_mq.exchangeStats.auto_delete)
+  return _internal_auto_delete();
+}
+inline void exchangeStats::_internal_set_auto_delete(bool value) {
   
-  return consumer_tag_.Mutable(GetArenaForAllocation());
+  _impl_.auto_delete_ = value;
 }
-inline std::string* basicConsumeResponse::release_consumer_tag() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.consumer_tag)
-  return consumer_tag_.Release();
+inline void exchangeStats::set_auto_delete(bool value) {
+  _internal_set_auto_delete(value);
+  // @@protoc_insertion_point(field_set:hare_mq.exchangeStats.auto_delete)
 }
-inline void basicConsumeResponse::set_allocated_consumer_tag(std::string* consumer_tag) {
-  if (consumer_tag != nullptr) {
-    
-  } else {
-    
-  }
-  consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (consumer_tag_.IsDefault()) {
-    consumer_tag_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.consumer_tag)
+
+// uint64 binding_count = 5;
+inline void exchangeStats::clear_binding_count() {
+  _impl_.binding_count_ = uint64_t{0u};
+}
+inline uint64_t exchangeStats::_internal_binding_count() const {
+  return _impl_.binding_count_;
+}
+inline uint64_t exchangeStats::binding_count() const {
+  // @@protoc_insertion_point(field_get:hare_mq.exchangeStats.binding_count)
+  return _internal_binding_count();
+}
+inline void exchangeStats::_internal_set_binding_count(uint64_t value) {
+  
+  _impl_.binding_count_ = value;
+}
+inline void exchangeStats::set_binding_count(uint64_t value) {
+  _internal_set_binding_count(value);
+  // @@protoc_insertion_point(field_set:hare_mq.exchangeStats.binding_count)
 }
 
-// string body = 3;
-inline void basicConsumeResponse::clear_body() {
-  body_.ClearToEmpty();
+// repeated .hare_mq.bindingStats bindings = 6;
+inline int exchangeStats::_internal_bindings_size() const {
+  return _impl_.bindings_.size();
 }
-inline const std::string& basicConsumeResponse::body() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.body)
-  return _internal_body();
+inline int exchangeStats::bindings_size() const {
+  return _internal_bindings_size();
+}
+inline void exchangeStats::clear_bindings() {
+  _impl_.bindings_.Clear();
+}
+inline ::hare_mq::bindingStats* exchangeStats::mutable_bindings(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.exchangeStats.bindings)
+  return _impl_.bindings_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::bindingStats >*
+exchangeStats::mutable_bindings() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.exchangeStats.bindings)
+  return &_impl_.bindings_;
+}
+inline const ::hare_mq::bindingStats& exchangeStats::_internal_bindings(int index) const {
+  return _impl_.bindings_.Get(index);
+}
+inline const ::hare_mq::bindingStats& exchangeStats::bindings(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.exchangeStats.bindings)
+  return _internal_bindings(index);
+}
+inline ::hare_mq::bindingStats* exchangeStats::_internal_add_bindings() {
+  return _impl_.bindings_.Add();
+}
+inline ::hare_mq::bindingStats* exchangeStats::add_bindings() {
+  ::hare_mq::bindingStats* _add = _internal_add_bindings();
+  // @@protoc_insertion_point(field_add:hare_mq.exchangeStats.bindings)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::bindingStats >&
+exchangeStats::bindings() const {
+  // @@protoc_insertion_point(field_list:hare_mq.exchangeStats.bindings)
+  return _impl_.bindings_;
+}
+
+// -------------------------------------------------------------------
+
+// queueStats
+
+// string name = 1;
+inline void queueStats::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& queueStats::name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeResponse::set_body(ArgT0&& arg0, ArgT... args) {
+void queueStats::set_name(ArgT0&& arg0, ArgT... args) {
  
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicConsumeResponse.body)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.name)
 }
-inline std::string* basicConsumeResponse::mutable_body() {
-  std::string* _s = _internal_mutable_body();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.body)
+inline std::string* queueStats::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.queueStats.name)
   return _s;
 }
-inline const std::string& basicConsumeResponse::_internal_body() const {
-  return body_.Get();
+inline const std::string& queueStats::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void basicConsumeResponse::_internal_set_body(const std::string& value) {
+inline void queueStats::_internal_set_name(const std::string& value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicConsumeResponse::_internal_mutable_body() {
+inline std::string* queueStats::_internal_mutable_name() {
   
-  return body_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicConsumeResponse::release_body() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.body)
-  return body_.Release();
+inline std::string* queueStats::release_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.queueStats.name)
+  return _impl_.name_.Release();
 }
-inline void basicConsumeResponse::set_allocated_body(std::string* body) {
-  if (body != nullptr) {
+inline void queueStats::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  body_.SetAllocated(body, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.body)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.queueStats.name)
 }
 
-// .hare_mq.BasicProperties properties = 4;
-inline bool basicConsumeResponse::_internal_has_properties() const {
-  return this != internal_default_instance() && properties_ != nullptr;
+// bool durable = 2;
+inline void queueStats::clear_durable() {
+  _impl_.durable_ = false;
 }
-inline bool basicConsumeResponse::has_properties() const {
-  return _internal_has_properties();
+inline bool queueStats::_internal_durable() const {
+  return _impl_.durable_;
 }
-inline const ::hare_mq::BasicProperties& basicConsumeResponse::_internal_properties() const {
-  const ::hare_mq::BasicProperties* p = properties_;
-  return p != nullptr ? *p : reinterpret_cast<const ::hare_mq::BasicProperties&>(
-      ::hare_mq::_BasicProperties_default_instance_);
+inline bool queueStats::durable() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.durable)
+  return _internal_durable();
 }
-inline const ::hare_mq::BasicProperties& basicConsumeResponse::properties() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicConsumeResponse.properties)
-  return _internal_properties();
+inline void queueStats::_internal_set_durable(bool value) {
+  
+  _impl_.durable_ = value;
 }
-inline void basicConsumeResponse::unsafe_arena_set_allocated_properties(
-    ::hare_mq::BasicProperties* properties) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
-  }
-  properties_ = properties;
-  if (properties) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hare_mq.basicConsumeResponse.properties)
+inline void queueStats::set_durable(bool value) {
+  _internal_set_durable(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.durable)
 }
-inline ::hare_mq::BasicProperties* basicConsumeResponse::release_properties() {
+
+// bool exclusive = 3;
+inline void queueStats::clear_exclusive() {
+  _impl_.exclusive_ = false;
+}
+inline bool queueStats::_internal_exclusive() const {
+  return _impl_.exclusive_;
+}
+inline bool queueStats::exclusive() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.exclusive)
+  return _internal_exclusive();
+}
+inline void queueStats::_internal_set_exclusive(bool value) {
   
-  ::hare_mq::BasicProperties* temp = properties_;
-  properties_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.exclusive_ = value;
 }
-inline ::hare_mq::BasicProperties* basicConsumeResponse::unsafe_arena_release_properties() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicConsumeResponse.properties)
+inline void queueStats::set_exclusive(bool value) {
+  _internal_set_exclusive(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.exclusive)
+}
+
+// bool auto_delete = 4;
+inline void queueStats::clear_auto_delete() {
+  _impl_.auto_delete_ = false;
+}
+inline bool queueStats::_internal_auto_delete() const {
+  return _impl_.auto_delete_;
+}
+inline bool queueStats::auto_delete() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.auto_delete)
+  return _internal_auto_delete();
+}
+inline void queueStats::_internal_set_auto_delete(bool value) {
   
-  ::hare_mq::BasicProperties* temp = properties_;
-  properties_ = nullptr;
-  return temp;
+  _impl_.auto_delete_ = value;
 }
-inline ::hare_mq::BasicProperties* basicConsumeResponse::_internal_mutable_properties() {
+inline void queueStats::set_auto_delete(bool value) {
+  _internal_set_auto_delete(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.auto_delete)
+}
+
+// uint64 depth = 5;
+inline void queueStats::clear_depth() {
+  _impl_.depth_ = uint64_t{0u};
+}
+inline uint64_t queueStats::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline uint64_t queueStats::depth() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.depth)
+  return _internal_depth();
+}
+inline void queueStats::_internal_set_depth(uint64_t value) {
   
-  if (properties_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hare_mq::BasicProperties>(GetArenaForAllocation());
-    properties_ = p;
-  }
-  return properties_;
+  _impl_.depth_ = value;
 }
-inline ::hare_mq::BasicProperties* basicConsumeResponse::mutable_properties() {
-  ::hare_mq::BasicProperties* _msg = _internal_mutable_properties();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicConsumeResponse.properties)
-  return _msg;
+inline void queueStats::set_depth(uint64_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.depth)
 }
-inline void basicConsumeResponse::set_allocated_properties(::hare_mq::BasicProperties* properties) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
-  }
-  if (properties) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
-    if (message_arena != submessage_arena) {
-      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, properties, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  properties_ = properties;
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicConsumeResponse.properties)
+
+// uint64 unacked = 6;
+inline void queueStats::clear_unacked() {
+  _impl_.unacked_ = uint64_t{0u};
+}
+inline uint64_t queueStats::_internal_unacked() const {
+  return _impl_.unacked_;
+}
+inline uint64_t queueStats::unacked() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.unacked)
+  return _internal_unacked();
+}
+inline void queueStats::_internal_set_unacked(uint64_t value) {
+  
+  _impl_.unacked_ = value;
+}
+inline void queueStats::set_unacked(uint64_t value) {
+  _internal_set_unacked(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.unacked)
 }
 
-// -------------------------------------------------------------------
+// uint64 consumer_count = 7;
+inline void queueStats::clear_consumer_count() {
+  _impl_.consumer_count_ = uint64_t{0u};
+}
+inline uint64_t queueStats::_internal_consumer_count() const {
+  return _impl_.consumer_count_;
+}
+inline uint64_t queueStats::consumer_count() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.consumer_count)
+  return _internal_consumer_count();
+}
+inline void queueStats::_internal_set_consumer_count(uint64_t value) {
+  
+  _impl_.consumer_count_ = value;
+}
+inline void queueStats::set_consumer_count(uint64_t value) {
+  _internal_set_consumer_count(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.consumer_count)
+}
 
-// basicCommonResponse
+// uint64 published = 8;
+inline void queueStats::clear_published() {
+  _impl_.published_ = uint64_t{0u};
+}
+inline uint64_t queueStats::_internal_published() const {
+  return _impl_.published_;
+}
+inline uint64_t queueStats::published() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.published)
+  return _internal_published();
+}
+inline void queueStats::_internal_set_published(uint64_t value) {
+  
+  _impl_.published_ = value;
+}
+inline void queueStats::set_published(uint64_t value) {
+  _internal_set_published(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.published)
+}
 
-// string rid = 1;
-inline void basicCommonResponse::clear_rid() {
-  rid_.ClearToEmpty();
+// uint64 delivered = 9;
+inline void queueStats::clear_delivered() {
+  _impl_.delivered_ = uint64_t{0u};
 }
-inline const std::string& basicCommonResponse::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCommonResponse.rid)
-  return _internal_rid();
+inline uint64_t queueStats::_internal_delivered() const {
+  return _impl_.delivered_;
+}
+inline uint64_t queueStats::delivered() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.delivered)
+  return _internal_delivered();
+}
+inline void queueStats::_internal_set_delivered(uint64_t value) {
+  
+  _impl_.delivered_ = value;
+}
+inline void queueStats::set_delivered(uint64_t value) {
+  _internal_set_delivered(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.delivered)
+}
+
+// uint64 acked = 10;
+inline void queueStats::clear_acked() {
+  _impl_.acked_ = uint64_t{0u};
+}
+inline uint64_t queueStats::_internal_acked() const {
+  return _impl_.acked_;
+}
+inline uint64_t queueStats::acked() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.acked)
+  return _internal_acked();
+}
+inline void queueStats::_internal_set_acked(uint64_t value) {
+  
+  _impl_.acked_ = value;
+}
+inline void queueStats::set_acked(uint64_t value) {
+  _internal_set_acked(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.acked)
+}
+
+// uint64 redelivered = 11;
+inline void queueStats::clear_redelivered() {
+  _impl_.redelivered_ = uint64_t{0u};
+}
+inline uint64_t queueStats::_internal_redelivered() const {
+  return _impl_.redelivered_;
+}
+inline uint64_t queueStats::redelivered() const {
+  // @@protoc_insertion_point(field_get:hare_mq.queueStats.redelivered)
+  return _internal_redelivered();
+}
+inline void queueStats::_internal_set_redelivered(uint64_t value) {
+  
+  _impl_.redelivered_ = value;
+}
+inline void queueStats::set_redelivered(uint64_t value) {
+  _internal_set_redelivered(value);
+  // @@protoc_insertion_point(field_set:hare_mq.queueStats.redelivered)
+}
+
+// -------------------------------------------------------------------
+
+// consumerStats
+
+// string tag = 1;
+inline void consumerStats::clear_tag() {
+  _impl_.tag_.ClearToEmpty();
+}
+inline const std::string& consumerStats::tag() const {
+  // @@protoc_insertion_point(field_get:hare_mq.consumerStats.tag)
+  return _internal_tag();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicCommonResponse::set_rid(ArgT0&& arg0, ArgT... args) {
+void consumerStats::set_tag(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicCommonResponse.rid)
+ _impl_.tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.consumerStats.tag)
 }
-inline std::string* basicCommonResponse::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicCommonResponse.rid)
+inline std::string* consumerStats::mutable_tag() {
+  std::string* _s = _internal_mutable_tag();
+  // @@protoc_insertion_point(field_mutable:hare_mq.consumerStats.tag)
   return _s;
 }
-inline const std::string& basicCommonResponse::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& consumerStats::_internal_tag() const {
+  return _impl_.tag_.Get();
 }
-inline void basicCommonResponse::_internal_set_rid(const std::string& value) {
+inline void consumerStats::_internal_set_tag(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.tag_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicCommonResponse::_internal_mutable_rid() {
+inline std::string* consumerStats::_internal_mutable_tag() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.tag_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicCommonResponse::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicCommonResponse.rid)
-  return rid_.Release();
+inline std::string* consumerStats::release_tag() {
+  // @@protoc_insertion_point(field_release:hare_mq.consumerStats.tag)
+  return _impl_.tag_.Release();
 }
-inline void basicCommonResponse::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void consumerStats::set_allocated_tag(std::string* tag) {
+  if (tag != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.tag_.SetAllocated(tag, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.tag_.IsDefault()) {
+    _impl_.tag_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCommonResponse.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.consumerStats.tag)
 }
 
-// string cid = 2;
-inline void basicCommonResponse::clear_cid() {
-  cid_.ClearToEmpty();
+// string queue_name = 2;
+inline void consumerStats::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
 }
-inline const std::string& basicCommonResponse::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCommonResponse.cid)
-  return _internal_cid();
+inline const std::string& consumerStats::queue_name() const {
+  // @@protoc_insertion_point(field_get:hare_mq.consumerStats.queue_name)
+  return _internal_queue_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicCommonResponse::set_cid(ArgT0&& arg0, ArgT... args) {
+void consumerStats::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicCommonResponse.cid)
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.consumerStats.queue_name)
 }
-inline std::string* basicCommonResponse::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicCommonResponse.cid)
+inline std::string* consumerStats::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:hare_mq.consumerStats.queue_name)
   return _s;
 }
-inline const std::string& basicCommonResponse::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& consumerStats::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void basicCommonResponse::_internal_set_cid(const std::string& value) {
+inline void consumerStats::_internal_set_queue_name(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicCommonResponse::_internal_mutable_cid() {
+inline std::string* consumerStats::_internal_mutable_queue_name() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicCommonResponse::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicCommonResponse.cid)
-  return cid_.Release();
+inline std::string* consumerStats::release_queue_name() {
+  // @@protoc_insertion_point(field_release:hare_mq.consumerStats.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void basicCommonResponse::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void consumerStats::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicCommonResponse.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.consumerStats.queue_name)
 }
 
-// bool ok = 3;
-inline void basicCommonResponse::clear_ok() {
-  ok_ = false;
+// bool auto_ack = 3;
+inline void consumerStats::clear_auto_ack() {
+  _impl_.auto_ack_ = false;
 }
-inline bool basicCommonResponse::_internal_ok() const {
-  return ok_;
+inline bool consumerStats::_internal_auto_ack() const {
+  return _impl_.auto_ack_;
 }
-inline bool basicCommonResponse::ok() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicCommonResponse.ok)
-  return _internal_ok();
+inline bool consumerStats::auto_ack() const {
+  // @@protoc_insertion_point(field_get:hare_mq.consumerStats.auto_ack)
+  return _internal_auto_ack();
 }
-inline void basicCommonResponse::_internal_set_ok(bool value) {
+inline void consumerStats::_internal_set_auto_ack(bool value) {
   
-  ok_ = value;
+  _impl_.auto_ack_ = value;
 }
-inline void basicCommonResponse::set_ok(bool value) {
-  _internal_set_ok(value);
-  // @@protoc_insertion_point(field_set:hare_mq.basicCommonResponse.ok)
+inline void consumerStats::set_auto_ack(bool value) {
+  _internal_set_auto_ack(value);
+  // @@protoc_insertion_point(field_set:hare_mq.consumerStats.auto_ack)
+}
+
+// uint64 unacked = 4;
+inline void consumerStats::clear_unacked() {
+  _impl_.unacked_ = uint64_t{0u};
+}
+inline uint64_t consumerStats::_internal_unacked() const {
+  return _impl_.unacked_;
+}
+inline uint64_t consumerStats::unacked() const {
+  // @@protoc_insertion_point(field_get:hare_mq.consumerStats.unacked)
+  return _internal_unacked();
+}
+inline void consumerStats::_internal_set_unacked(uint64_t value) {
+  
+  _impl_.unacked_ = value;
+}
+inline void consumerStats::set_unacked(uint64_t value) {
+  _internal_set_unacked(value);
+  // @@protoc_insertion_point(field_set:hare_mq.consumerStats.unacked)
 }
 
 // -------------------------------------------------------------------
 
-// basicQueryRequest
+// statsResponse
 
 // string rid = 1;
-inline void basicQueryRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void statsResponse::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& basicQueryRequest::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicQueryRequest.rid)
+inline const std::string& statsResponse::rid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicQueryRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void statsResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicQueryRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.rid)
 }
-inline std::string* basicQueryRequest::mutable_rid() {
+inline std::string* statsResponse::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryRequest.rid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsResponse.rid)
   return _s;
 }
-inline const std::string& basicQueryRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& statsResponse::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void basicQueryRequest::_internal_set_rid(const std::string& value) {
+inline void statsResponse::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicQueryRequest::_internal_mutable_rid() {
+inline std::string* statsResponse::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicQueryRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicQueryRequest.rid)
-  return rid_.Release();
+inline std::string* statsResponse::release_rid() {
+  // @@protoc_insertion_point(field_release:hare_mq.statsResponse.rid)
+  return _impl_.rid_.Release();
 }
-inline void basicQueryRequest::set_allocated_rid(std::string* rid) {
+inline void statsResponse::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.statsResponse.rid)
 }
 
 // string cid = 2;
-inline void basicQueryRequest::clear_cid() {
-  cid_.ClearToEmpty();
+inline void statsResponse::clear_cid() {
+  _impl_.cid_.ClearToEmpty();
 }
-inline const std::string& basicQueryRequest::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicQueryRequest.cid)
+inline const std::string& statsResponse::cid() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.cid)
   return _internal_cid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicQueryRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void statsResponse::set_cid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicQueryRequest.cid)
+ _impl_.cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.cid)
 }
-inline std::string* basicQueryRequest::mutable_cid() {
+inline std::string* statsResponse::mutable_cid() {
   std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryRequest.cid)
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsResponse.cid)
   return _s;
 }
-inline const std::string& basicQueryRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& statsResponse::_internal_cid() const {
+  return _impl_.cid_.Get();
 }
-inline void basicQueryRequest::_internal_set_cid(const std::string& value) {
+inline void statsResponse::_internal_set_cid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.cid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicQueryRequest::_internal_mutable_cid() {
+inline std::string* statsResponse::_internal_mutable_cid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.cid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicQueryRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicQueryRequest.cid)
-  return cid_.Release();
+inline std::string* statsResponse::release_cid() {
+  // @@protoc_insertion_point(field_release:hare_mq.statsResponse.cid)
+  return _impl_.cid_.Release();
 }
-inline void basicQueryRequest::set_allocated_cid(std::string* cid) {
+inline void statsResponse::set_allocated_cid(std::string* cid) {
   if (cid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.cid_.SetAllocated(cid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.cid_.IsDefault()) {
+    _impl_.cid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:hare_mq.statsResponse.cid)
 }
 
-// -------------------------------------------------------------------
+// bool ok = 3;
+inline void statsResponse::clear_ok() {
+  _impl_.ok_ = false;
+}
+inline bool statsResponse::_internal_ok() const {
+  return _impl_.ok_;
+}
+inline bool statsResponse::ok() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.ok)
+  return _internal_ok();
+}
+inline void statsResponse::_internal_set_ok(bool value) {
+  
+  _impl_.ok_ = value;
+}
+inline void statsResponse::set_ok(bool value) {
+  _internal_set_ok(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.ok)
+}
 
-// basicQueryResponse
+// uint64 version = 4;
+inline void statsResponse::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t statsResponse::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t statsResponse::version() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.version)
+  return _internal_version();
+}
+inline void statsResponse::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void statsResponse::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.version)
+}
 
-// string rid = 1;
-inline void basicQueryResponse::clear_rid() {
-  rid_.ClearToEmpty();
+// repeated .hare_mq.exchangeStats exchanges = 5;
+inline int statsResponse::_internal_exchanges_size() const {
+  return _impl_.exchanges_.size();
 }
-inline const std::string& basicQueryResponse::rid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicQueryResponse.rid)
-  return _internal_rid();
+inline int statsResponse::exchanges_size() const {
+  return _internal_exchanges_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicQueryResponse::set_rid(ArgT0&& arg0, ArgT... args) {
- 
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicQueryResponse.rid)
+inline void statsResponse::clear_exchanges() {
+  _impl_.exchanges_.Clear();
 }
-inline std::string* basicQueryResponse::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryResponse.rid)
-  return _s;
+inline ::hare_mq::exchangeStats* statsResponse::mutable_exchanges(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsResponse.exchanges)
+  return _impl_.exchanges_.Mutable(index);
 }
-inline const std::string& basicQueryResponse::_internal_rid() const {
-  return rid_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::exchangeStats >*
+statsResponse::mutable_exchanges() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.statsResponse.exchanges)
+  return &_impl_.exchanges_;
 }
-inline void basicQueryResponse::_internal_set_rid(const std::string& value) {
-  
-  rid_.Set(value, GetArenaForAllocation());
+inline const ::hare_mq::exchangeStats& statsResponse::_internal_exchanges(int index) const {
+  return _impl_.exchanges_.Get(index);
 }
-inline std::string* basicQueryResponse::_internal_mutable_rid() {
-  
-  return rid_.Mutable(GetArenaForAllocation());
+inline const ::hare_mq::exchangeStats& statsResponse::exchanges(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.exchanges)
+  return _internal_exchanges(index);
 }
-inline std::string* basicQueryResponse::release_rid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicQueryResponse.rid)
-  return rid_.Release();
+inline ::hare_mq::exchangeStats* statsResponse::_internal_add_exchanges() {
+  return _impl_.exchanges_.Add();
 }
-inline void basicQueryResponse::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
-    
-  } else {
-    
-  }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryResponse.rid)
+inline ::hare_mq::exchangeStats* statsResponse::add_exchanges() {
+  ::hare_mq::exchangeStats* _add = _internal_add_exchanges();
+  // @@protoc_insertion_point(field_add:hare_mq.statsResponse.exchanges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::exchangeStats >&
+statsResponse::exchanges() const {
+  // @@protoc_insertion_point(field_list:hare_mq.statsResponse.exchanges)
+  return _impl_.exchanges_;
 }
 
-// string cid = 2;
-inline void basicQueryResponse::clear_cid() {
-  cid_.ClearToEmpty();
+// repeated .hare_mq.queueStats queues = 6;
+inline int statsResponse::_internal_queues_size() const {
+  return _impl_.queues_.size();
 }
-inline const std::string& basicQueryResponse::cid() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicQueryResponse.cid)
-  return _internal_cid();
+inline int statsResponse::queues_size() const {
+  return _internal_queues_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicQueryResponse::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicQueryResponse.cid)
+inline void statsResponse::clear_queues() {
+  _impl_.queues_.Clear();
 }
-inline std::string* basicQueryResponse::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryResponse.cid)
-  return _s;
+inline ::hare_mq::queueStats* statsResponse::mutable_queues(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsResponse.queues)
+  return _impl_.queues_.Mutable(index);
 }
-inline const std::string& basicQueryResponse::_internal_cid() const {
-  return cid_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueStats >*
+statsResponse::mutable_queues() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.statsResponse.queues)
+  return &_impl_.queues_;
 }
-inline void basicQueryResponse::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
+inline const ::hare_mq::queueStats& statsResponse::_internal_queues(int index) const {
+  return _impl_.queues_.Get(index);
 }
-inline std::string* basicQueryResponse::_internal_mutable_cid() {
-  
-  return cid_.Mutable(GetArenaForAllocation());
+inline const ::hare_mq::queueStats& statsResponse::queues(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.queues)
+  return _internal_queues(index);
 }
-inline std::string* basicQueryResponse::release_cid() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicQueryResponse.cid)
-  return cid_.Release();
+inline ::hare_mq::queueStats* statsResponse::_internal_add_queues() {
+  return _impl_.queues_.Add();
 }
-inline void basicQueryResponse::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryResponse.cid)
+inline ::hare_mq::queueStats* statsResponse::add_queues() {
+  ::hare_mq::queueStats* _add = _internal_add_queues();
+  // @@protoc_insertion_point(field_add:hare_mq.statsResponse.queues)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::queueStats >&
+statsResponse::queues() const {
+  // @@protoc_insertion_point(field_list:hare_mq.statsResponse.queues)
+  return _impl_.queues_;
 }
 
-// string body = 3;
-inline void basicQueryResponse::clear_body() {
-  body_.ClearToEmpty();
+// repeated .hare_mq.consumerStats consumers = 7;
+inline int statsResponse::_internal_consumers_size() const {
+  return _impl_.consumers_.size();
 }
-inline const std::string& basicQueryResponse::body() const {
-  // @@protoc_insertion_point(field_get:hare_mq.basicQueryResponse.body)
-  return _internal_body();
+inline int statsResponse::consumers_size() const {
+  return _internal_consumers_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicQueryResponse::set_body(ArgT0&& arg0, ArgT... args) {
- 
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:hare_mq.basicQueryResponse.body)
+inline void statsResponse::clear_consumers() {
+  _impl_.consumers_.Clear();
 }
-inline std::string* basicQueryResponse::mutable_body() {
-  std::string* _s = _internal_mutable_body();
-  // @@protoc_insertion_point(field_mutable:hare_mq.basicQueryResponse.body)
-  return _s;
+inline ::hare_mq::consumerStats* statsResponse::mutable_consumers(int index) {
+  // @@protoc_insertion_point(field_mutable:hare_mq.statsResponse.consumers)
+  return _impl_.consumers_.Mutable(index);
 }
-inline const std::string& basicQueryResponse::_internal_body() const {
-  return body_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::consumerStats >*
+statsResponse::mutable_consumers() {
+  // @@protoc_insertion_point(field_mutable_list:hare_mq.statsResponse.consumers)
+  return &_impl_.consumers_;
 }
-inline void basicQueryResponse::_internal_set_body(const std::string& value) {
+inline const ::hare_mq::consumerStats& statsResponse::_internal_consumers(int index) const {
+  return _impl_.consumers_.Get(index);
+}
+inline const ::hare_mq::consumerStats& statsResponse::consumers(int index) const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.consumers)
+  return _internal_consumers(index);
+}
+inline ::hare_mq::consumerStats* statsResponse::_internal_add_consumers() {
+  return _impl_.consumers_.Add();
+}
+inline ::hare_mq::consumerStats* statsResponse::add_consumers() {
+  ::hare_mq::consumerStats* _add = _internal_add_consumers();
+  // @@protoc_insertion_point(field_add:hare_mq.statsResponse.consumers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hare_mq::consumerStats >&
+statsResponse::consumers() const {
+  // @@protoc_insertion_point(field_list:hare_mq.statsResponse.consumers)
+  return _impl_.consumers_;
+}
+
+// uint64 total_exchanges = 8;
+inline void statsResponse::clear_total_exchanges() {
+  _impl_.total_exchanges_ = uint64_t{0u};
+}
+inline uint64_t statsResponse::_internal_total_exchanges() const {
+  return _impl_.total_exchanges_;
+}
+inline uint64_t statsResponse::total_exchanges() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.total_exchanges)
+  return _internal_total_exchanges();
+}
+inline void statsResponse::_internal_set_total_exchanges(uint64_t value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.total_exchanges_ = value;
 }
-inline std::string* basicQueryResponse::_internal_mutable_body() {
+inline void statsResponse::set_total_exchanges(uint64_t value) {
+  _internal_set_total_exchanges(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.total_exchanges)
+}
+
+// uint64 total_queues = 9;
+inline void statsResponse::clear_total_queues() {
+  _impl_.total_queues_ = uint64_t{0u};
+}
+inline uint64_t statsResponse::_internal_total_queues() const {
+  return _impl_.total_queues_;
+}
+inline uint64_t statsResponse::total_queues() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.total_queues)
+  return _internal_total_queues();
+}
+inline void statsResponse::_internal_set_total_queues(uint64_t value) {
   
-  return body_.Mutable(GetArenaForAllocation());
+  _impl_.total_queues_ = value;
 }
-inline std::string* basicQueryResponse::release_body() {
-  // @@protoc_insertion_point(field_release:hare_mq.basicQueryResponse.body)
-  return body_.Release();
+inline void statsResponse::set_total_queues(uint64_t value) {
+  _internal_set_total_queues(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.total_queues)
 }
-inline void basicQueryResponse::set_allocated_body(std::string* body) {
-  if (body != nullptr) {
-    
-  } else {
-    
-  }
-  body_.SetAllocated(body, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:hare_mq.basicQueryResponse.body)
+
+// uint64 total_consumers = 10;
+inline void statsResponse::clear_total_consumers() {
+  _impl_.total_consumers_ = uint64_t{0u};
+}
+inline uint64_t statsResponse::_internal_total_consumers() const {
+  return _impl_.total_consumers_;
+}
+inline uint64_t statsResponse::total_consumers() const {
+  // @@protoc_insertion_point(field_get:hare_mq.statsResponse.total_consumers)
+  return _internal_total_consumers();
+}
+inline void statsResponse::_internal_set_total_consumers(uint64_t value) {
+  
+  _impl_.total_consumers_ = value;
+}
+inline void statsResponse::set_total_consumers(uint64_t value) {
+  _internal_set_total_consumers(value);
+  // @@protoc_insertion_point(field_set:hare_mq.statsResponse.total_consumers)
 }
 
 #ifdef __GNUC__
@@ -6340,11 +13609,57 @@ inline void basicQueryResponse::set_allocated_body(std::string* body) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace hare_mq
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::hare_mq::StatsSection> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::hare_mq::StatsSection>() {
+  return ::hare_mq::StatsSection_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -0,0 +1,213 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_TRACE__
+#define __YUFC_TRACE__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace hare_mq {
+// 热路径的分阶段追踪
+// 1. 按采样率选中的请求分配一个追踪id，放在线程局部变量里，同一线程上的各个阶段(trace_scope)用 steady_clock 记录起止时间
+// 2. 跨线程的阶段(例如订阅者所在连接的 IO 线程推送消息)通过消息对象上的 trace_id 接上
+// 3. 每个线程一个环形缓冲，只保留最近的 TRACE_RING_CAPACITY 个事件，写入不加锁；导出为 Chrome trace JSON(chrome://tracing 或 Perfetto 打开)
+// 4. 采样率为 0(默认)时关闭: 每个请求只多一次原子读，各个阶段只多一次线程局部变量的判断，不读时钟
+#define TRACE_RING_CAPACITY 8192 // 必须是2的幂
+enum trace_stage {
+    TRACE_RECEIVE = 0, // 数据到达(poll 返回)到进入处理函数: 解码 + 分发
+    TRACE_LOOKUP, // 查找连接和信道
+    TRACE_ROUTE, // 路由
+    TRACE_ENQUEUE, // 消息写入队列(包括持久化)
+    TRACE_DISK_WRITE, // 持久化写入
+    TRACE_SCHEDULE_DELIVERY, // 选择订阅者，把推送任务交给订阅者所在连接的 IO 线程
+    TRACE_RESPONSE_SEND, // 发送发布的响应
+    TRACE_DELIVERY_SEND, // 订阅者所在连接的 IO 线程把消息编码进发送缓冲
+    TRACE_STAGE_MAX
+};
+struct trace_event {
+    uint64_t id;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    uint32_t stage;
+    uint32_t tid; // 环形缓冲的编号，导出时作为线程id
+};
+
+class tracer {
+private:
+    struct ring {
+        struct slot {
+            std::atomic<uint64_t> id;
+            std::atomic<uint64_t> begin_ns;
+            std::atomic<uint64_t> end_ns;
+            std::atomic<uint32_t> stage;
+        };
+        uint32_t tid;
+        std::atomic<uint64_t> head { 0 }; // 已经写入的事件总数，只有所属线程修改
+        slot slots[TRACE_RING_CAPACITY];
+        ring(uint32_t n)
+            : tid(n) { }
+    };
+    std::atomic<uint32_t> __sample_every { 0 }; // 每 N 个请求采样一个，0 表示关闭
+    std::atomic<uint64_t> __next_id { 0 };
+    std::atomic<uint64_t> __cleared_ns { 0 }; // 早于这个时间的事件导出时忽略(清空不需要修改各线程的缓冲)
+    std::mutex __mtx; // 只保护缓冲列表
+    std::vector<std::shared_ptr<ring>> __rings;
+
+public:
+    static tracer& instance() {
+        static tracer t;
+        return t;
+    } // 全局唯一
+    static uint64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    static uint64_t& current() {
+        thread_local uint64_t id = 0;
+        return id;
+    } // 当前线程正在处理的请求的追踪id，0 表示没有被采样
+    static const char* stage_name(int stage) {
+        static const char* names[TRACE_STAGE_MAX] = {
+            "receive", "lookup", "route", "enqueue", "disk_write", "schedule_delivery", "response_send", "delivery_send"
+        };
+        return names[stage];
+    }
+    void set_sample_every(uint32_t n) {
+        __sample_every.store(n, std::memory_order_relaxed);
+    } // 运行时开启(N > 0)或者关闭(0)
+    uint32_t sample_every() const {
+        return __sample_every.load(std::memory_order_relaxed);
+    }
+    uint64_t sample() {
+        uint32_t every = __sample_every.load(std::memory_order_relaxed);
+        if (every == 0)
+            return 0;
+        thread_local uint64_t n = 0;
+        if (++n % every != 0)
+            return 0;
+        return __next_id.fetch_add(1, std::memory_order_relaxed) + 1;
+    } // 请求入口调用: 被采样则返回新的追踪id，否则返回0
+    void record(uint64_t id, trace_stage stage, uint64_t begin_ns, uint64_t end_ns) {
+        ring& r = local();
+        uint64_t h = r.head.load(std::memory_order_relaxed);
+        ring::slot& s = r.slots[h & (TRACE_RING_CAPACITY - 1)];
+        s.id.store(id, std::memory_order_relaxed);
+        s.begin_ns.store(begin_ns, std::memory_order_relaxed);
+        s.end_ns.store(end_ns, std::memory_order_relaxed);
+        s.stage.store(stage, std::memory_order_relaxed);
+        r.head.store(h + 1, std::memory_order_release);
+    } // 只写本线程的缓冲
+    std::vector<trace_event> events() {
+        std::vector<std::shared_ptr<ring>> rings;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            rings = __rings;
+        }
+        uint64_t cleared = __cleared_ns.load(std::memory_order_relaxed);
+        std::vector<trace_event> result;
+        for (const auto& r : rings) {
+            uint64_t end = r->head.load(std::memory_order_acquire);
+            uint64_t begin = end > TRACE_RING_CAPACITY ? end - TRACE_RING_CAPACITY : 0;
+            size_t first = result.size();
+            for (uint64_t i = begin; i < end; ++i) {
+                const ring::slot& s = r->slots[i & (TRACE_RING_CAPACITY - 1)];
+                trace_event e;
+                e.id = s.id.load(std::memory_order_relaxed);
+                e.begin_ns = s.begin_ns.load(std::memory_order_relaxed);
+                e.end_ns = s.end_ns.load(std::memory_order_relaxed);
+                e.stage = s.stage.load(std::memory_order_relaxed);
+                e.tid = r->tid;
+                result.push_back(e);
+            }
+            // 读取期间所属线程可能覆盖了最老的几个位置(包括正在写的下一个)，这部分丢掉
+            uint64_t now_head = r->head.load(std::memory_order_acquire);
+            uint64_t valid_from = now_head + 1 > TRACE_RING_CAPACITY ? now_head + 1 - TRACE_RING_CAPACITY : 0;
+            size_t skip = valid_from > begin ? std::min<uint64_t>(valid_from - begin, end - begin) : 0;
+            result.erase(result.begin() + first, result.begin() + first + skip);
+        }
+        std::vector<trace_event> kept;
+        kept.reserve(result.size());
+        for (const auto& e : result)
+            if (e.begin_ns >= cleared)
+                kept.push_back(e);
+        return kept;
+    } // 所有线程缓冲中的事件(可以和写入并发)
+    std::string to_chrome_json() {
+        // Trace Event Format: 每个阶段一个完整事件(ph = X)，时间单位为微秒
+        std::string out = "{\"traceEvents\":[";
+        char line[256];
+        bool first = true;
+        for (const auto& e : events()) {
+            snprintf(line, sizeof(line),
+                "%s\n{\"name\":\"%s\",\"cat\":\"hare\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"trace_id\":%llu}}",
+                first ? "" : ",", stage_name(e.stage), e.begin_ns / 1000.0, (e.end_ns - e.begin_ns) / 1000.0,
+                e.tid, (unsigned long long)e.id);
+            out += line;
+            first = false;
+        }
+        out += "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return out;
+    }
+    void clear() {
+        __cleared_ns.store(now_ns(), std::memory_order_relaxed);
+    } // 之前记录的事件不再导出
+
+private:
+    tracer() = default;
+    ring& local() {
+        thread_local ring* r = register_ring();
+        return *r;
+    }
+    ring* register_ring() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        std::shared_ptr<ring> r = std::make_shared<ring>(__rings.size() + 1);
+        __rings.push_back(r);
+        return r.get();
+    } // 线程退出之后缓冲保留，事件还能导出
+};
+
+// 作用域计时: 当前线程的请求被采样时，记录这个阶段的起止时间
+class trace_scope {
+private:
+    trace_stage __stage;
+    uint64_t __id;
+    uint64_t __begin;
+
+public:
+    trace_scope(trace_stage stage)
+        : __stage(stage)
+        , __id(tracer::current())
+        , __begin(__id != 0 ? tracer::now_ns() : 0) { }
+    ~trace_scope() {
+        if (__id != 0)
+            tracer::instance().record(__id, __stage, __begin, tracer::now_ns());
+    }
+};
+
+// 在作用域内把当前线程的追踪id设置为 id，退出时恢复
+class trace_context {
+private:
+    uint64_t __saved;
+
+public:
+    explicit trace_context(uint64_t id)
+        : __saved(tracer::current()) {
+        tracer::current() = id;
+    }
+    ~trace_context() {
+        tracer::current() = __saved;
+    }
+};
+} // namespace hare_mq
+
+#endif
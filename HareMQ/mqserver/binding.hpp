@@ -174,6 +174,10 @@ public:
             return binding::ptr();
         return qit->second;
     } // get one binding info
+    binding_map all() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        return __bindings;
+    } // get all binding info (copy)
     bool exists(const std::string& ename, const std::string& qname) {
         std::unique_lock<std::mutex> lock(__mtx);
         auto it = __bindings.find(ename);
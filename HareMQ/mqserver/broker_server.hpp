@@ -12,15 +12,16 @@
 #include "muduo/net/EventLoop.h"
 #include "muduo/net/TcpServer.h"
 #include "muduo/protoc/codec.h"
-#include "muduo/protoc/dispatcher.h"
 
 #include "../mqcommon/logger.hpp"
 #include "../mqcommon/msg.pb.h"
 #include "../mqcommon/protocol.pb.h"
-#include "../mqcommon/thread_pool.hpp"
+#include "../mqcommon/trace.hpp"
 #include "connection.hpp"
 #include "consumer.hpp"
+#include "dispatch.hpp"
 #include "virtual_host.hpp"
+#include <algorithm>
 #include <pwd.h>
 #include <sys/types.h>
 #include <time.h>
@@ -29,61 +30,80 @@
 namespace hare_mq {
 #define DBFILE_PATH "/meta.db"
 #define HOST_NAME "MyVirtualHost"
+#define HEARTBEAT_CHECK_INTERVAL 1.0 // 空闲连接检测的周期(秒)
+#define METRICS_LISTEN_IP "127.0.0.1" // Prometheus 抓取端点只监听本机
+#define METRICS_MAX_REQUEST 8192 // 抓取请求头的最大长度
 class BrokerServer {
 private:
     // server
     muduo::net::EventLoop __base_loop; // 回调
     muduo::net::TcpServer __server; // 服务器对象
-    ProtobufDispatcher __dispatcher; // 请求分发器对象 -- 要向其中注册请求处理函数
+    request_dispatcher __dispatcher; // 请求分发表 -- 要向其中注册请求类型和对应的信道/连接处理函数
     ProtobufCodecPtr __codec; // protobuf协议处理器 -- 针对收到的请求数据进行protobuf协议处理
     // broker data
     virtual_host::ptr __virtual_host;
     consumer_manager::ptr __consumer_manager;
     connection_manager::ptr __connection_manager;
-    thread_pool::ptr __thread_pool; //
+    std::unique_ptr<muduo::net::TcpServer> __metrics_server; // Prometheus 文本格式的抓取端点(GET /metrics)和追踪(GET /trace)，端口为0时不启用
 public:
-    BrokerServer(int port, const std::string& basedir)
+    BrokerServer(int port, const std::string& basedir, int metrics_port = 0)
         : __server(&__base_loop, muduo::net::InetAddress("0.0.0.0", port), "server", muduo::net::TcpServer::kReusePort)
         , __dispatcher(std::bind(&BrokerServer::onUnknownMessage,
               this, std::placeholders::_1,
               std::placeholders::_2,
               std::placeholders::_3))
-        , __codec(std::make_shared<ProtobufCodec>(std::bind(&ProtobufDispatcher::onProtobufMessage,
+        , __codec(std::make_shared<ProtobufCodec>(std::bind(&request_dispatcher::dispatch,
               &__dispatcher, std::placeholders::_1,
               std::placeholders::_2,
               std::placeholders::_3)))
         , __virtual_host(std::make_shared<virtual_host>(HOST_NAME, basedir, basedir + DBFILE_PATH))
         , __consumer_manager(std::make_shared<consumer_manager>())
-        , __connection_manager(std::make_shared<connection_manager>())
-        , __thread_pool(std::make_shared<thread_pool>()) {
+        , __connection_manager(std::make_shared<connection_manager>()) {
         // 针对历史消息中的所有队列，别忘了去初始化队列的消费者管理句柄
         queue_map qm = __virtual_host->all_queues();
         for (const auto& e : qm)
             __consumer_manager->init_queue_consumer(e.first);
         // 注册业务请求处理函数
-        __dispatcher.registerMessageCallback<openChannelRequest>(std::bind(&BrokerServer::on_openChannel, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<closeChannelRequest>(std::bind(&BrokerServer::on_closeChannel, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<declareExchangeRequest>(std::bind(&BrokerServer::on_declareExchange, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<deleteExchangeRequest>(std::bind(&BrokerServer::on_deleteExchange, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<declareQueueRequest>(std::bind(&BrokerServer::on_declareQueue, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<deleteQueueRequest>(std::bind(&BrokerServer::on_deleteQueue, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<bindRequest>(std::bind(&BrokerServer::on_bind, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<unbindRequest>(std::bind(&BrokerServer::on_unbind, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<basicPublishRequest>(std::bind(&BrokerServer::on_basicPublish, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<basicAckRequest>(std::bind(&BrokerServer::on_basicAck, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<basicConsumeRequest>(std::bind(&BrokerServer::on_basicConsume, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<basicCancelRequest>(std::bind(&BrokerServer::on_basicCancel, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        __dispatcher.registerMessageCallback<basicQueryRequest>(std::bind(&BrokerServer::on_basicQuery, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-        // 设置消息回调
-        __server.setMessageCallback(std::bind(&ProtobufCodec::onMessage, __codec,
+        __dispatcher.on_connection<openChannelRequest, &connection::open_channel>();
+        __dispatcher.on_connection<closeChannelRequest, &connection::close_channel>();
+        __dispatcher.on_channel<declareExchangeRequest, &channel::declare_exchange>();
+        __dispatcher.on_channel<deleteExchangeRequest, &channel::delete_exchange>();
+        __dispatcher.on_channel<declareQueueRequest, &channel::declare_queue>();
+        __dispatcher.on_channel<deleteQueueRequest, &channel::delete_queue>();
+        __dispatcher.on_channel<bindRequest, &channel::bind>();
+        __dispatcher.on_channel<unbindRequest, &channel::unbind>();
+        __dispatcher.on_channel<basicPublishRequest, &channel::basic_publish>();
+        __dispatcher.on_channel<basicAckRequest, &channel::basic_ack>();
+        __dispatcher.on_channel<basicNackRequest, &channel::basic_nack>();
+        __dispatcher.on_channel<basicRejectRequest, &channel::basic_reject>();
+        __dispatcher.on_channel<basicConsumeRequest, &channel::basic_consume>();
+        __dispatcher.on_channel<basicCancelRequest, &channel::basic_cancel>();
+        __dispatcher.on_channel<basicGetRequest, &channel::basic_get>();
+        __dispatcher.on_channel<basicQueryRequest, &channel::basic_query>();
+        __dispatcher.on_channel<metricsRequest, &channel::metrics>();
+        __dispatcher.on_channel<statsRequest, &channel::stats>();
+        __dispatcher.on_connection<heartbeatRequest, &connection::heartbeat_negotiate>();
+        __dispatcher.on_connection<heartbeat, &connection::heartbeat_reply>(false); // 心跳帧太频繁了，不打日志
+        // 设置消息回调(先记录连接的活跃时间，再交给协议处理器)
+        __server.setMessageCallback(std::bind(&BrokerServer::onMessage, this,
             std::placeholders::_1,
             std::placeholders::_2,
             std::placeholders::_3));
         __server.setConnectionCallback(std::bind(&BrokerServer::onConnection, this, std::placeholders::_1));
+        if (metrics_port != 0) {
+            __metrics_server.reset(new muduo::net::TcpServer(&__base_loop, muduo::net::InetAddress(METRICS_LISTEN_IP, metrics_port), "metrics"));
+            __metrics_server->setMessageCallback(std::bind(&BrokerServer::onMetricsMessage, this,
+                std::placeholders::_1,
+                std::placeholders::_2,
+                std::placeholders::_3));
+        }
     }
     void start() {
         printServerInfo();
         __server.start();
+        if (__metrics_server)
+            __metrics_server->start();
+        __base_loop.runEvery(HEARTBEAT_CHECK_INTERVAL, std::bind(&BrokerServer::check_idle_connections, this));
         __base_loop.loop();
     } //
 private:
@@ -104,206 +124,73 @@ private:
                   << "-------------------------------------------------------" << std::endl;
     } //
 private:
-    // list all the request
-    // 打开信道请求
-    void on_openChannel(const muduo::net::TcpConnectionPtr& conn, const openChannelRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: openChannelRequest" << std::endl;
-        return new_conn->open_channel(message);
-    }
-    // 关闭信道请求
-    void on_closeChannel(const muduo::net::TcpConnectionPtr& conn, const closeChannelRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: closeChannelRequest" << std::endl;
-        return new_conn->close_channel(message);
-    }
-    // 声明交换机请求
-    void on_declareExchange(const muduo::net::TcpConnectionPtr& conn, const declareExchangeRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: declareExchangeRequest" << std::endl;
-        return cp->declare_exchange(message);
-    }
-    // 删除交换机请求
-    void on_deleteExchange(const muduo::net::TcpConnectionPtr& conn, const deleteExchangeRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: deleteExchangeRequest" << std::endl;
-        return cp->delete_exchange(message);
-    }
-    // 声明队列请求
-    void on_declareQueue(const muduo::net::TcpConnectionPtr& conn, const declareQueueRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: declareQueueRequest" << std::endl;
-        return cp->declare_queue(message);
-    }
-    // 删除队列请求
-    void on_deleteQueue(const muduo::net::TcpConnectionPtr& conn, const deleteQueueRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: deleteQueueRequest" << std::endl;
-        return cp->delete_queue(message);
-    }
-    // 绑定请求
-    void on_bind(const muduo::net::TcpConnectionPtr& conn, const bindRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
+    void check_idle_connections() {
+        // 心跳超时的连接直接关闭，onConnection 里删除连接时，信道析构会把没有确认的消息重新入队
+        for (const auto& conn : __connection_manager->idle_connections()) {
+            LOG(WARNING) << "heartbeat timeout, close connection: " << conn->peerAddress().toIpPort() << std::endl;
+            conn->forceClose();
         }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: bindRequest" << std::endl;
-        return cp->bind(message);
-    }
-    // 解绑请求
-    void on_unbind(const muduo::net::TcpConnectionPtr& conn, const unbindRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: unbindRequest" << std::endl;
-        return cp->unbind(message);
-    }
-    // 消息发布
-    void on_basicPublish(const muduo::net::TcpConnectionPtr& conn, const basicPublishRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: basicPublishRequest" << std::endl;
-        return cp->basic_publish(message);
-    }
-    // 消息确认
-    void on_basicAck(const muduo::net::TcpConnectionPtr& conn, const basicAckRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: basicAckRequest" << std::endl;
-        return cp->basic_ack(message);
-    }
-    // 消息订阅
-    void on_basicConsume(const muduo::net::TcpConnectionPtr& conn, const basicConsumeRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: basicConsumeRequest" << std::endl;
-        return cp->basic_consume(message);
     }
-    // 取消订阅
-    void on_basicCancel(const muduo::net::TcpConnectionPtr& conn, const basicCancelRequestPtr& message, muduo::Timestamp ts) {
+    void onMessage(const muduo::net::TcpConnectionPtr& conn, muduo::net::Buffer* buf, muduo::Timestamp ts) {
         connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: basicCancelRequest" << std::endl;
-        return cp->basic_cancel(message);
+        if (new_conn != nullptr)
+            new_conn->touch();
+        __codec->onMessage(conn, buf, ts);
+    }
+    void onMetricsMessage(const muduo::net::TcpConnectionPtr& conn, muduo::net::Buffer* buf, muduo::Timestamp ts) {
+        // 极简的 HTTP: 读到请求头结束的空行就回复，然后关闭连接，不支持长连接
+        const char* begin = buf->peek();
+        const char* end = begin + buf->readableBytes();
+        const char crlf2[] = "\r\n\r\n";
+        const char* header_end = std::search(begin, end, crlf2, crlf2 + 4);
+        if (header_end == end) {
+            if (buf->readableBytes() > METRICS_MAX_REQUEST)
+                conn->shutdown();
+            return; // 请求头还没有收完
+        }
+        std::string request_line(begin, std::find(begin, header_end, '\r'));
+        buf->retrieveAll();
+        std::string status = "200 OK";
+        std::string content_type = "text/plain; version=0.0.4";
+        std::string body;
+        std::string target = request_target(request_line);
+        if (target == "/metrics") {
+            body = __virtual_host->metrics().to_prometheus();
+        } else if (target == "/trace") {
+            body = tracer::instance().to_chrome_json(); // chrome://tracing 或 Perfetto 打开
+            content_type = "application/json";
+        } else if (target.compare(0, 13, "/trace/start?") == 0 && target.find("every=") != std::string::npos) {
+            // 开始追踪: 每 every 个请求采样一个，之前记录的事件清空
+            std::string every = target.substr(target.find("every=") + 6);
+            if (every.empty() || every.size() > 9 || every.find_first_not_of("0123456789") != std::string::npos) {
+                status = "400 Bad Request";
+                body = "every must be a positive integer\n";
+            } else {
+                tracer::instance().clear();
+                tracer::instance().set_sample_every(std::stoul(every));
+                body = "tracing 1/" + every + " requests\n";
+            }
+        } else if (target == "/trace/stop") {
+            tracer::instance().set_sample_every(0);
+            body = "tracing stopped\n";
+        } else {
+            status = "404 Not Found";
+            body = "not found\n";
+        }
+        conn->send("HTTP/1.1 " + status + "\r\n"
+            + "Content-Type: " + content_type + "\r\n"
+            + "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            + "Connection: close\r\n\r\n"
+            + body);
+        conn->shutdown();
     }
-    // 查询
-    void on_basicQuery(const muduo::net::TcpConnectionPtr& conn, const basicQueryRequestPtr& message, muduo::Timestamp ts) {
-        connection::ptr new_conn = __connection_manager->select_connection(conn);
-        if (new_conn == nullptr) {
-            LOG(WARNING) << "unknown connection" << std::endl;
-            conn->shutdown();
-            return;
-        }
-        channel::ptr cp = new_conn->select_channel(message->cid());
-        if (cp == nullptr) {
-            LOG(WARNING) << "unknown channel in this connection" << std::endl;
-            return;
-        }
-        LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: basicQueryRequest" << std::endl;
-        return cp->basic_query(message);
+    static std::string request_target(const std::string& request_line) {
+        // "GET /path HTTP/1.1" -> "/path"，只支持 GET
+        if (request_line.compare(0, 4, "GET ") != 0)
+            return std::string();
+        size_t end = request_line.find(' ', 4);
+        return request_line.substr(4, end == std::string::npos ? std::string::npos : end - 4);
     }
-    // 未知请求
     void onUnknownMessage(const muduo::net::TcpConnectionPtr& conn, const MessagePtr& message, muduo::Timestamp ts) {
         LOG(WARNING) << "onUnknownMessage: " << message->GetTypeName() << std::endl;
         conn->shutdown();
@@ -323,7 +210,7 @@ private:
         if (conn->connected()) {
             LOG(INFO) << "connected" << std::endl;
             printConnectionInfo(conn);
-            __connection_manager->new_connection(__virtual_host, __consumer_manager, __codec, conn, __thread_pool);
+            __connection_manager->new_connection(__virtual_host, __consumer_manager, conn);
         } else {
             LOG(INFO) << "disconnected" << std::endl;
             __connection_manager->delete_connection(conn);
@@ -11,15 +11,18 @@
 #include "../mqcommon/logger.hpp"
 #include "../mqcommon/msg.pb.h"
 #include "../mqcommon/protocol.pb.h"
-#include "../mqcommon/thread_pool.hpp"
+#include "../mqcommon/trace.hpp"
 #include "consumer.hpp"
+#include "metrics.hpp"
 #include "muduo/net/TcpConnection.h"
 #include "muduo/protoc/codec.h"
-#include "muduo/protoc/dispatcher.h"
+#include "outbound.hpp"
 #include "route.hpp"
 #include "virtual_host.hpp"
+#include <unordered_map>
 
 namespace hare_mq {
+#define DELIVERY_BATCH_SIZE 64 // 一个推送任务最多连续推送的消息数，剩下的重新安排
 using ProtobufCodecPtr = std::shared_ptr<ProtobufCodec>;
 using openChannelRequestPtr = std::shared_ptr<openChannelRequest>;
 using closeChannelRequestPtr = std::shared_ptr<closeChannelRequest>;
@@ -31,85 +34,174 @@ using bindRequestPtr = std::shared_ptr<bindRequest>;
 using unbindRequestPtr = std::shared_ptr<unbindRequest>;
 using basicPublishRequestPtr = std::shared_ptr<basicPublishRequest>;
 using basicAckRequestPtr = std::shared_ptr<basicAckRequest>;
+using basicNackRequestPtr = std::shared_ptr<basicNackRequest>;
+using basicRejectRequestPtr = std::shared_ptr<basicRejectRequest>;
 using basicConsumeRequestPtr = std::shared_ptr<basicConsumeRequest>;
 using basicCancelRequestPtr = std::shared_ptr<basicCancelRequest>;
 using basicQueryRequestPtr = std::shared_ptr<basicQueryRequest>;
+using basicGetRequestPtr = std::shared_ptr<basicGetRequest>;
+using metricsRequestPtr = std::shared_ptr<metricsRequest>;
+using statsRequestPtr = std::shared_ptr<statsRequest>;
 using basicCommonResponsePtr = std::shared_ptr<basicCommonResponse>; //
 class channel {
 public:
     using ptr = std::shared_ptr<channel>; //
 private:
     std::string __cid; // 信道标识
-    consumer::ptr __consumer; // 在haremq中一个信道对应一个消费者，不一定有效，因为信道不一定是消费者关联的
-    muduo::net::TcpConnectionPtr __conn; // 连接句柄
-    ProtobufCodecPtr __codec; // 协议处理
+    std::unordered_map<std::string, consumer::ptr> __consumers; // 信道上的所有消费者: consumer_tag -> consumer, 信道不一定关联消费者
+    std::unordered_map<std::string, consumer::ptr> __getters; // 拉取模式下记录待确认消息用的内部消费者: qname -> consumer, 不参与推送, 只保留还有待确认消息的
+    delivery_seq_ptr __delivery_seq; // 信道内的投递标签生成器
+    frame_writer::ptr __writer; // 连接的发送缓冲(连接上的所有信道共用)
     consumer_manager::ptr __cmp; // 消费者管理句柄
     virtual_host::ptr __host; // 虚拟机对象管理句柄
-    thread_pool::ptr __pool; // 异步的线程池
 private:
     void basic_response(bool ok, const std::string& rid, const std::string& cid) {
         basicCommonResponse resp;
         resp.set_rid(rid);
         resp.set_cid(cid);
         resp.set_ok(ok);
-        __codec->send(__conn, resp); // 发送响应给客户端
+        __writer->send(resp); // 发送响应给客户端
     } //
-    void consume(const std::string& qname) {
-        // 线程池的回调：向指定队列的订阅者去推送消息
-        // 1. 从队列中取出一条消息
-        message_ptr mp = __host->basic_consume(qname);
-        if (mp == nullptr) {
-            LOG(ERROR) << "asyn run 'void consume(const std::string& qname)' failed, there's no mesg in the queue: " << qname << std::endl;
+    static void dispatch(const virtual_host::ptr& host, const consumer_manager::ptr& cmp, const std::string& qname, size_t count = 1) {
+        // 选出一个订阅者，把 count 条消息的推送交给订阅者所在连接的 IO 线程，同一轮事件循环里的推送一起编码、一次写出
+        // 只持有 host 和 cmp，不依赖 this，信道析构之后已经投递的任务依然可以安全执行
+        consumer::ptr cp = cmp->choose(qname);
+        if (cp == nullptr) {
+            // 没有订阅者的时候消息留在队列中，等有订阅者了再推送
+            LOG(ERROR) << "dispatch failed, the queue has no consumers (nobody subscribed this queue)" << qname << std::endl;
             return;
         }
-        // 2. 从队列的订阅者中取出一个订阅者
-        consumer::ptr cp = __cmp->choose(qname); // 这个是在发布消息，不能找 __consumer，__consumer是这个channel作为消费者的时候才有用，我现在是在发布消息
-        // 3. 调用订阅者对应的消息处理函数，实现消息的推送
-        if (cp == nullptr) {
-            LOG(ERROR) << "asyn run 'void consume(const std::string& qname)' failed, the queue has no consumers (nobody subscribed this queue)"
-                       << qname << std::endl;
+        if (cp->add_pending(count) != 0)
+            return; // 这个订阅者已经有推送任务在排队了，跟着那个任务一起推送，不再投递新的任务
+        if (!cp->executor)
+            return deliver(host, cmp, cp);
+        cp->executor(std::bind(&channel::deliver, host, cmp, cp));
+    }
+    static void deliver(const virtual_host::ptr& host, const consumer_manager::ptr& cmp, const consumer::ptr& cp) {
+        // 在订阅者所在连接的 IO 线程中执行，取消订阅和关闭信道也在这个线程，推送过程中订阅者的状态不会变
+        // 一个任务连续推送安排给这个订阅者的消息，最多 DELIVERY_BATCH_SIZE 条，剩下的重新安排，不让一个队列长时间占住 IO 线程
+        size_t count = cp->take_pending();
+        if (count == 0)
+            return;
+        // 1. 订阅者在任务执行之前已经被取消了，换一个订阅者
+        if (!cp->active())
+            return dispatch(host, cmp, cp->qname, count);
+        size_t delivered = 0;
+        std::vector<uint64_t> auto_acked;
+        while (delivered < count && delivered < DELIVERY_BATCH_SIZE) {
+            // 2. 从队列中取出一条消息，取不到说明已经被其他订阅者或者拉取请求取走了，这一批提前结束
+            uint64_t seq = 0;
+            message_ptr mp = host->basic_consume(cp->qname, &seq);
+            if (mp == nullptr) {
+                count = delivered;
+                break;
+            }
+            // 3. 记录到订阅者的待确认消息中并分配投递标签，失败说明订阅者已经被取消了，剩下的换一个订阅者
+            uint64_t delivery_tag = 0;
+            if (!cp->auto_ack && (delivery_tag = cp->track(seq)) == 0) {
+                host->basic_reject(cp->qname, std::vector<uint64_t> { seq }, true);
+                break;
+            }
+            // 4. 调用订阅者对应的消息处理函数，编码进连接的发送缓冲，这一批推送执行完之后一次写出
+            {
+                trace_context trace(mp->trace_id()); // 发布时被采样的消息，接着记录推送阶段
+                trace_scope send(TRACE_DELIVERY_SEND);
+                cp->callback(cp->tag, delivery_tag, &mp->payload().properties(), mp->payload().body()); // 只读，消息可能被多个队列共享
+            }
+            if (cp->auto_ack)
+                auto_acked.push_back(seq);
+            ++delivered;
+        }
+        // 5. 自动确认的订阅者不需要等待确认，整批推送完之后一次删除，否则需要等待外部收到消息确认后再删除
+        if (!auto_acked.empty())
+            host->basic_ack(cp->qname, auto_acked);
+        // 6. 这一批没有推送完的消息重新安排(轮转，可能交给其他订阅者)
+        if (delivered < count)
+            dispatch(host, cmp, cp->qname, count - delivered);
+    }
+    void schedule_delivery(const std::string& qname, size_t count = 1) {
+        dispatch(__host, __cmp, qname, count);
+    } // 为队列中的 count 条消息安排推送
+    void schedule_delivery(const std::vector<std::string>& ready_queues) {
+        std::unordered_map<std::string, size_t> counts;
+        for (const auto& q : ready_queues)
+            ++counts[q];
+        for (const auto& e : counts)
+            schedule_delivery(e.first, e.second);
+    } // 一批重新变为可推送的消息，每个队列只安排一次
+    void requeue_unacked(const consumer::ptr& cp) {
+        // 消费者被取消/信道关闭: 把它所有未确认的消息按推送顺序放回队首，然后重新推送
+        std::vector<uint64_t> unacked = cp->take_unacked();
+        if (unacked.empty())
             return;
+        schedule_delivery(__host->basic_reject(cp->qname, unacked, true));
+    }
+    void reject_mesgs(const std::string& qname, const std::vector<uint64_t>& seqs, bool requeue) {
+        // 重新入队或者被转投到死信交换机的消息，都需要重新推送给订阅者
+        schedule_delivery(__host->basic_reject(qname, seqs, requeue));
+    }
+    uint64_t untrack_message(const std::string& qname, const std::string& msg_id) {
+        // 兼容按消息id确认的老客户端: 先换成出队序号，再和按投递标签确认走同样的流程
+        uint64_t seq = __host->delivery_seq(qname, msg_id);
+        if (seq == 0)
+            return 0;
+        for (const auto& cp : trackers()) {
+            if (cp->qname != qname)
+                continue;
+            cp->untrack_seq(seq);
+            release_getter(cp);
         }
-        cp->callback(cp->tag, mp->mutable_payload()->mutable_properties(), mp->payload().body());
-        // 4. 判断如果订阅者如果自动ack，则不需要等待确认，直接删除消息，否则需要等待外部收到消息确认后再删除
-        if (cp->auto_ack)
-            __host->basic_ack(qname, mp->payload().properties().id());
+        return seq;
     }
-    void consume_cb(const std::string& tag, const BasicProperties* bp, const std::string& body) {
+    void release_getter(const consumer::ptr& cp) {
+        auto it = __getters.find(cp->qname);
+        if (it != __getters.end() && it->second == cp && cp->unacked_count() == 0)
+            __getters.erase(it);
+    } // 拉取用的内部消费者没有待确认的消息了就删掉，下次拉取时再创建(投递标签由信道统一分配，不会重复)
+    std::vector<consumer::ptr> trackers() {
+        std::vector<consumer::ptr> result;
+        result.reserve(__consumers.size() + __getters.size());
+        for (const auto& e : __consumers)
+            result.push_back(e.second);
+        for (const auto& e : __getters)
+            result.push_back(e.second);
+        return result;
+    } // 信道上所有记录了待确认消息的消费者(投递标签在信道内唯一)
+    void consume_cb(const std::string& tag, uint64_t delivery_tag, const BasicProperties* bp, const std::string& body) {
         // 这个是消费者的回调，也就是说，消费一条信息，具体是如何消费
         // __cmp->create(req->consumer_tag(), req->queue_name(), req->auto_ack(), /*?*/);
         // 需要和这个保持一致: consumer.hpp
-        //      using consumer_callback = std::function<void(const std::string&, const BasicProperties*, const std::string&)>;
+        //      using consumer_callback = std::function<void(const std::string&, uint64_t, const BasicProperties*, const std::string&)>;
         // 那推送一条消息给客户端，具体是做什么？就是组织一个响应的格式: basicConsumeResponse
         basicConsumeResponse resp;
         resp.set_cid(__cid);
         resp.set_body(body);
         resp.set_consumer_tag(tag);
-        if (bp) {
-            resp.mutable_properties()->set_id(bp->id());
-            resp.mutable_properties()->set_delivery_mode(bp->delivery_mode());
-            resp.mutable_properties()->set_routing_key(bp->routing_key());
-        }
-        __codec->send(__conn, resp);
+        resp.set_delivery_tag(delivery_tag);
+        if (bp)
+            *resp.mutable_properties() = *bp; // 头部、优先级等属性一起推送给客户端
+        __writer->send(resp);
     }
 
 public:
     channel(const std::string& cid,
         const virtual_host::ptr& host,
         const consumer_manager::ptr& cmp,
-        const ProtobufCodecPtr& codec,
-        const muduo::net::TcpConnectionPtr conn,
-        const thread_pool::ptr& pool)
+        const frame_writer::ptr& writer)
         : __cid(cid)
-        , __conn(conn)
-        , __codec(codec)
+        , __delivery_seq(std::make_shared<std::atomic<uint64_t>>(0))
+        , __writer(writer)
         , __cmp(cmp)
-        , __host(host)
-        , __pool(pool) { }
+        , __host(host) { }
     ~channel() {
-        if (__consumer != nullptr)
-            __cmp->remove(__consumer->tag, __consumer->qname); // 删除这个队列相关连的消费者
+        for (const auto& e : __consumers) {
+            __cmp->remove(e.second->tag, e.second->qname); // 删除这个队列相关连的消费者
+            requeue_unacked(e.second); // 没有确认的消息要还给队列
+        }
+        for (const auto& e : __getters)
+            requeue_unacked(e.second);
     }
+    const std::string& cid() const { return __cid; }
     // 交换机的声明和删除
     void declare_exchange(const declareExchangeRequestPtr& req) {
         // 处理请求
@@ -158,44 +250,149 @@ public:
         if (ep == nullptr) // 没找到这台交换机
             return basic_response(false, req->rid(), req->cid());
         // 2. 进行路由（判断消息可以发布到交换机绑定的哪一个队列中去）
-        msg_queue_binding_map mqbm = __host->exchange_bindings(req->exchange_name());
         BasicProperties* properties = nullptr;
-        std::string routing_key;
-        if (req->has_properties()) {
-            properties = req->mutable_properties();
-            routing_key = properties->routing_key();
-        } // 因为不一定有 properties() 这个字段，所以要在外面先判断一下
-        for (const auto& e : mqbm) {
-            // 2.1 判断mqbm里面哪些队列是可以发的
-            if (router::route(ep->type, routing_key, e.second->binding_key)) {
-                // 3. 将消息添加到队列中（添加消息的管理）
-                __host->basic_publish(e.first, properties, req->body());
-                // 4. 向线程池中添加一个消息消费任务（向指定队列的订阅者去推送消息）
-                auto task = std::bind(&channel::consume, this, e.first);
-                __pool->push(task);
+        if (req->has_properties())
+            properties = req->mutable_properties(); // 因为不一定有 properties() 这个字段，所以要在外面先判断一下
+        std::vector<std::string> qnames;
+        {
+            metrics_timer timer(METRIC_ROUTE_LATENCY);
+            trace_scope trace(TRACE_ROUTE);
+            qnames = __host->route(ep, properties);
+        }
+        if (qnames.empty())
+            metrics_registry::instance().add(METRIC_PUBLISH_UNROUTED);
+        for (const auto& qname : qnames) {
+            // 3. 将消息添加到队列中（添加消息的管理）
+            {
+                trace_scope trace(TRACE_ENQUEUE);
+                __host->basic_publish(qname, properties, req->body());
             }
+            // 4. 安排推送（交给订阅者所在连接的 IO 线程）
+            trace_scope trace(TRACE_SCHEDULE_DELIVERY);
+            schedule_delivery(qname);
         }
+        trace_scope trace(TRACE_RESPONSE_SEND);
         return basic_response(true, req->rid(), req->cid());
     }
     void basic_ack(const basicAckRequestPtr& req) {
-        __host->basic_ack(req->queue_name(), req->message_id()); // ack this mesg
+        if (req->delivery_tag() != 0) {
+            // 按投递标签确认(可以一次确认多条)，客户端不等待响应
+            for (const auto& cp : trackers()) {
+                std::vector<uint64_t> seqs = cp->untrack(req->delivery_tag(), req->multiple());
+                if (seqs.empty())
+                    continue;
+                release_getter(cp);
+                __host->basic_ack(cp->qname, seqs);
+                if (!req->multiple())
+                    break; // 投递标签在信道内唯一，找到就可以停了
+            }
+            return;
+        }
+        uint64_t seq = untrack_message(req->queue_name(), req->message_id());
+        if (seq != 0)
+            __host->basic_ack(req->queue_name(), std::vector<uint64_t> { seq }); // ack this mesg
+        return basic_response(true, req->rid(), req->cid());
+    }
+    void basic_nack(const basicNackRequestPtr& req) {
+        if (req->delivery_tag() != 0) {
+            for (const auto& cp : trackers()) {
+                std::vector<uint64_t> seqs = cp->untrack(req->delivery_tag(), req->multiple());
+                if (seqs.empty())
+                    continue;
+                release_getter(cp);
+                reject_mesgs(cp->qname, seqs, req->requeue());
+                if (!req->multiple())
+                    break;
+            }
+            return;
+        }
+        uint64_t seq = untrack_message(req->queue_name(), req->message_id());
+        if (seq != 0)
+            reject_mesgs(req->queue_name(), { seq }, req->requeue());
         return basic_response(true, req->rid(), req->cid());
     }
+    void basic_reject(const basicRejectRequestPtr& req) {
+        if (req->delivery_tag() != 0) {
+            for (const auto& cp : trackers()) {
+                std::vector<uint64_t> seqs = cp->untrack(req->delivery_tag(), false);
+                if (seqs.empty())
+                    continue;
+                release_getter(cp);
+                reject_mesgs(cp->qname, seqs, req->requeue());
+                break;
+            }
+            return;
+        }
+        uint64_t seq = untrack_message(req->queue_name(), req->message_id());
+        if (seq != 0)
+            reject_mesgs(req->queue_name(), { seq }, req->requeue());
+        return basic_response(true, req->rid(), req->cid());
+    }
+    // 拉取模式: 一次从队列中取出一批消息，一帧返回
+    void basic_get(const basicGetRequestPtr& req) {
+        basicGetResponse resp;
+        resp.set_rid(req->rid());
+        resp.set_cid(__cid);
+        if (__host->exists_queue(req->queue_name()) == false) {
+            resp.set_ok(false);
+            __writer->send(resp);
+            return;
+        }
+        size_t max_count = req->max_count() == 0 ? 1 : req->max_count();
+        std::vector<uint64_t> seqs;
+        std::vector<message_ptr> msgs = __host->basic_get(req->queue_name(), max_count, req->max_bytes(), &seqs);
+        consumer::ptr getter;
+        if (!req->auto_ack() && !msgs.empty()) {
+            consumer::ptr& slot = __getters[req->queue_name()];
+            if (slot == nullptr)
+                slot = std::make_shared<consumer>("", req->queue_name(), false, consumer_callback(), __delivery_seq);
+            getter = slot;
+        }
+        for (size_t i = 0; i < msgs.size(); ++i) {
+            basicConsumeResponse* entry = resp.add_messages();
+            entry->set_body(msgs[i]->payload().body());
+            *entry->mutable_properties() = msgs[i]->payload().properties();
+            if (getter != nullptr)
+                entry->set_delivery_tag(getter->track(seqs[i]));
+        }
+        if (getter == nullptr && !seqs.empty())
+            __host->basic_ack(req->queue_name(), seqs); // 自动确认
+        resp.set_ok(true);
+        __writer->send(resp);
+    }
     // 订阅/取消订阅队列消息
     void basic_consume(const basicConsumeRequestPtr& req) {
         // 1. 判断队列是否存在
         bool ret = __host->exists_queue(req->queue_name());
         if (ret == false)
             return basic_response(false, req->rid(), req->cid());
-        // 2. 创建队列的消费者
-        auto cb = std::bind(&channel::consume_cb, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-        // 创建了消费者之后，当前的 channel 就是一个消费者
-        __consumer = __cmp->create(req->consumer_tag(), req->queue_name(), req->auto_ack(), /*important*/ cb);
+        // 2. 同一个信道上的消费者标识不能重复
+        if (__consumers.find(req->consumer_tag()) != __consumers.end())
+            return basic_response(false, req->rid(), req->cid());
+        // 3. 创建队列的消费者
+        auto cb = std::bind(&channel::consume_cb, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4);
+        // 一个信道上可以有多个消费者，推送时按 consumer_tag 区分
+        // 推送在信道所属连接的 IO 线程中执行
+        consumer_executor exec = std::bind(&frame_writer::post, __writer, std::placeholders::_1);
+        consumer::ptr cp = __cmp->create(req->consumer_tag(), req->queue_name(), req->auto_ack(), /*important*/ cb, __delivery_seq, exec);
+        if (cp == nullptr)
+            return basic_response(false, req->rid(), req->cid());
+        __consumers.insert({ req->consumer_tag(), cp });
+        // 4. 队列中积压的消息(包括其他消费者退出时还回来的消息)也要推送
+        size_t backlog = __host->getable_count(req->queue_name());
+        if (backlog > 0)
+            schedule_delivery(req->queue_name(), backlog); // 整个积压只安排一次，推送任务分批取
         return basic_response(true, req->rid(), req->cid());
     }
     void basic_cancel(const basicCancelRequestPtr& req) {
-        __cmp->remove(req->consumer_tag(), req->queue_name());
-        return basic_response(false, req->rid(), req->cid());
+        auto it = __consumers.find(req->consumer_tag());
+        if (it == __consumers.end())
+            return basic_response(false, req->rid(), req->cid());
+        consumer::ptr cp = it->second;
+        __consumers.erase(it);
+        __cmp->remove(cp->tag, cp->qname);
+        requeue_unacked(cp);
+        return basic_response(true, req->rid(), req->cid());
     }
     void basic_query(const basicQueryRequestPtr& req) {
         std::string ret = __host->basic_query();
@@ -203,14 +400,73 @@ public:
         resp.set_rid(req->rid());
         resp.set_cid(__cid);
         resp.set_body(ret);
-        __codec->send(__conn, resp);
+        __writer->send(resp);
     }
+    void metrics(const metricsRequestPtr& req) {
+        metrics_snapshot snap = __host->metrics();
+        metricsResponse resp;
+        resp.set_rid(req->rid());
+        resp.set_cid(__cid);
+        resp.set_ok(true);
+        for (int c = 0; c < METRIC_COUNTER_MAX; ++c) {
+            metricCounter* mc = resp.add_counters();
+            mc->set_name(metrics_snapshot::counter_name(c));
+            mc->set_value(snap.counters[c]);
+        }
+        for (int h = 0; h < METRIC_HISTOGRAM_MAX; ++h) {
+            const histogram_summary& s = snap.histograms[h];
+            metricHistogram* mh = resp.add_histograms();
+            mh->set_name(metrics_snapshot::histogram_name(h));
+            mh->set_count(s.count);
+            mh->set_sum(s.sum);
+            mh->set_p50(s.p50);
+            mh->set_p90(s.p90);
+            mh->set_p99(s.p99);
+            mh->set_p999(s.p999);
+            mh->set_max(s.max);
+        }
+        for (const auto& op : snap.ops) {
+            const histogram_summary& s = op.latency;
+            metricHistogram* mh = resp.add_requests();
+            mh->set_name(op.name);
+            mh->set_count(s.count);
+            mh->set_sum(s.sum);
+            mh->set_p50(s.p50);
+            mh->set_p90(s.p90);
+            mh->set_p99(s.p99);
+            mh->set_p999(s.p999);
+            mh->set_max(s.max);
+        }
+        for (const auto& q : snap.queues) {
+            queueMetrics* qm = resp.add_queues();
+            qm->set_name(q.name);
+            qm->set_depth(q.depth);
+            qm->set_unacked(q.unacked);
+            qm->set_disk_bytes(q.disk_bytes);
+            qm->set_published(q.published);
+            qm->set_delivered(q.delivered);
+            qm->set_acked(q.acked);
+            qm->set_redelivered(q.redelivered);
+        }
+        if (req->prometheus_text())
+            resp.set_text(snap.to_prometheus());
+        __writer->send(resp);
+    }
+    void stats(const statsRequestPtr& req) {
+        statsResponse resp;
+        resp.set_rid(req->rid());
+        resp.set_cid(__cid);
+        resp.set_ok(true);
+        stats_query::fill(*req, *__host->topology(), *__cmp->snapshot(), &resp);
+        __writer->send(resp);
+    } // 结构化的状态查询，读取快照，不加队列锁
 };
 
+/* 一条连接上的所有信道: 只在连接所属的 IO 线程中访问(打开/关闭/查找都来自这条连接上的请求)，不需要加锁 */
 class channel_manager {
 private:
     std::unordered_map<std::string, channel::ptr> __channels;
-    std::mutex __mtx; //
+    channel::ptr __last; // 上一次查找到的信道，大部分连接只用一个信道，命中时不需要哈希查找 //
 public:
     using ptr = std::shared_ptr<channel_manager>;
     channel_manager() = default;
@@ -218,27 +474,27 @@ public:
     bool open_channel(const std::string& cid,
         const virtual_host::ptr& host,
         const consumer_manager::ptr& cmp,
-        const ProtobufCodecPtr& codec,
-        const muduo::net::TcpConnectionPtr conn,
-        const thread_pool::ptr& pool) {
-        std::unique_lock<std::mutex> lock(__mtx);
+        const frame_writer::ptr& writer) {
         auto it = __channels.find(cid);
         if (it != __channels.end())
             return false;
-        auto ch = std::make_shared<channel>(cid, host, cmp, codec, conn, pool);
+        auto ch = std::make_shared<channel>(cid, host, cmp, writer);
         __channels.insert({ cid, ch });
         return true;
     }
     void close_channel(const std::string& cid) {
-        std::unique_lock<std::mutex> lock(__mtx);
+        if (__last != nullptr && __last->cid() == cid)
+            __last.reset();
         __channels.erase(cid);
     }
     channel::ptr select_channel(const std::string& cid) {
-        std::unique_lock<std::mutex> lock(__mtx);
+        if (__last != nullptr && __last->cid() == cid)
+            return __last;
         auto it = __channels.find(cid);
         if (it == __channels.end())
             return channel::ptr();
-        return it->second;
+        __last = it->second;
+        return __last;
     }
 };
 
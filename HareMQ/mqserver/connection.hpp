@@ -8,33 +8,41 @@
 #define __YUFC_CONNECTION__
 
 #include "channel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <boost/any.hpp>
+#include <vector>
 
 namespace hare_mq {
+using heartbeatRequestPtr = std::shared_ptr<heartbeatRequest>;
+using heartbeatPtr = std::shared_ptr<heartbeat>;
+#define HEARTBEAT_MAX_INTERVAL 60 // 服务器允许的最大心跳间隔(秒)，客户端要求的更大时按这个来
+#define HEARTBEAT_TIMEOUT_FACTOR 2 // 超过 心跳间隔*这个倍数 没有收到任何数据，就认为连接已经断了
 class connection {
 private:
     muduo::net::TcpConnectionPtr __conn;
-    ProtobufCodecPtr __codec;
+    frame_writer::ptr __writer; // 响应和推送都经过这里合并写出
     consumer_manager::ptr __cmp;
     virtual_host::ptr __host;
-    thread_pool::ptr __pool;
-    channel_manager::ptr __channels; //
+    channel_manager::ptr __channels;
+    std::atomic<int64_t> __last_active; // 最近一次收到数据的时间(毫秒)
+    std::atomic<uint32_t> __heartbeat_interval; // 协商之后的心跳间隔(秒)，0 表示不做空闲检测 //
 public:
     using ptr = std::shared_ptr<connection>;
     connection(const virtual_host::ptr& host,
         const consumer_manager::ptr& cmp,
-        const ProtobufCodecPtr& codec,
-        const muduo::net::TcpConnectionPtr& conn,
-        const thread_pool::ptr& pool)
+        const muduo::net::TcpConnectionPtr& conn)
         : __conn(conn)
-        , __codec(codec)
+        , __writer(std::make_shared<frame_writer>(conn))
         , __cmp(cmp)
         , __host(host)
-        , __pool(pool)
-        , __channels(std::make_shared<channel_manager>()) { }
+        , __channels(std::make_shared<channel_manager>())
+        , __last_active(time_helper::steady_ms())
+        , __heartbeat_interval(0) { }
     ~connection() = default;
     void open_channel(const openChannelRequestPtr& req) {
         // 1. 判断信道ID是否重复 2. 创建信道
-        bool ret = __channels->open_channel(req->cid(), __host, __cmp, __codec, __conn, __pool); // bug found!
+        bool ret = __channels->open_channel(req->cid(), __host, __cmp, __writer); // bug found!
         if (ret == false)
             return basic_response(false, req->rid(), req->cid());
         // 3. 给客户端回复
@@ -47,16 +55,47 @@ public:
     channel::ptr select_channel(const std::string& cid) {
         return __channels->select_channel(cid);
     } //
+    void touch() {
+        __last_active = time_helper::steady_ms();
+    } // 收到任何数据都算活跃
+    void heartbeat_negotiate(const heartbeatRequestPtr& req) {
+        // 取客户端要求的间隔和服务器上限中较小的一个，客户端要求 0 则不使用心跳
+        uint32_t interval = std::min<uint32_t>(req->interval(), HEARTBEAT_MAX_INTERVAL);
+        __heartbeat_interval = interval;
+        heartbeatResponse resp;
+        resp.set_rid(req->rid());
+        resp.set_interval(interval);
+        __writer->send(resp);
+    }
+    void heartbeat_reply(const heartbeatPtr& req) {
+        if (__heartbeat_interval == 0)
+            return;
+        heartbeat resp;
+        resp.set_timestamp(req->timestamp());
+        __writer->send(resp); // 回一个心跳，客户端据此判断服务器是否还活着
+    }
+    bool idle_timeout(int64_t now_ms) {
+        uint32_t interval = __heartbeat_interval;
+        if (interval == 0)
+            return false;
+        return now_ms - __last_active > (int64_t)interval * HEARTBEAT_TIMEOUT_FACTOR * 1000;
+    } // 协商过心跳的连接，太久没有收到数据就是超时了
 private:
     void basic_response(bool ok, const std::string& rid, const std::string& cid) {
         basicCommonResponse resp;
         resp.set_rid(rid);
         resp.set_cid(cid);
         resp.set_ok(ok);
-        __codec->send(__conn, resp); // 发送响应给客户端
+        __writer->send(resp); // 发送响应给客户端
     } //
 };
 
+/**
+ * 连接管理
+ * 1. broker 的 connection 对象挂在 muduo TcpConnection 的 context 上，请求处理时直接从 context 取，不加全局锁也不用哈希查找
+ * 2. context 只在连接所属的 IO 线程中设置、读取和清除(连接建立/请求/断开的回调都在这个线程)
+ * 3. __conns 只用于心跳超时的扫描，只在建立和断开连接时加锁修改
+ */
 class connection_manager {
 private:
     std::mutex __mtx;
@@ -67,27 +106,36 @@ public:
     ~connection_manager() = default;
     void new_connection(const virtual_host::ptr& host,
         const consumer_manager::ptr& cmp,
-        const ProtobufCodecPtr& codec,
-        const muduo::net::TcpConnectionPtr& conn,
-        const thread_pool::ptr& pool) {
+        const muduo::net::TcpConnectionPtr& conn) {
         std::unique_lock<std::mutex> lock(__mtx);
         auto it = __conns.find(conn);
         if (it != __conns.end()) // 已经有了
             return;
-        auto self_conn = std::make_shared<connection>(host, cmp, codec, conn, pool);
+        auto self_conn = std::make_shared<connection>(host, cmp, conn);
         __conns.insert({ conn, self_conn });
+        conn->setContext(self_conn);
     }
     void delete_connection(const muduo::net::TcpConnectionPtr& conn) {
+        conn->setContext(boost::any()); // connection 持有 TcpConnectionPtr，context 不清除的话两者循环引用
         std::unique_lock<std::mutex> lock(__mtx);
         __conns.erase(conn);
     }
-    connection::ptr select_connection(const muduo::net::TcpConnectionPtr& conn) {
-        std::unique_lock<std::mutex> lock(__mtx);
-        auto it = __conns.find(conn);
-        if (it == __conns.end()) // 没找到
+    static connection::ptr select_connection(const muduo::net::TcpConnectionPtr& conn) {
+        const connection::ptr* cp = boost::any_cast<connection::ptr>(&conn->getContext());
+        if (cp == nullptr) // 没有建立(或者已经断开)
             return connection::ptr();
-        return it->second;
-    }
+        return *cp;
+    } // 只能在连接所属的 IO 线程中调用
+    std::vector<muduo::net::TcpConnectionPtr> idle_connections() {
+        int64_t now = time_helper::steady_ms();
+        std::vector<muduo::net::TcpConnectionPtr> result;
+        std::unique_lock<std::mutex> lock(__mtx);
+        for (const auto& e : __conns) {
+            if (e.second->idle_timeout(now))
+                result.push_back(e.first);
+        }
+        return result;
+    } // 心跳超时的连接
 };
 
 } // namespace hare_mq
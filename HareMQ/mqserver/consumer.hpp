@@ -10,28 +10,113 @@
 #include "../mqcommon/helper.hpp"
 #include "../mqcommon/logger.hpp"
 #include "../mqcommon/msg.pb.h"
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
 
 namespace hare_mq {
-using consumer_callback = std::function<void(const std::string&, const BasicProperties*, const std::string&)>;
+using consumer_callback = std::function<void(const std::string&, uint64_t, const BasicProperties*, const std::string&)>; // tag, delivery_tag, properties, body
+using delivery_seq_ptr = std::shared_ptr<std::atomic<uint64_t>>; // 投递标签生成器, 同一个信道上的消费者共享
+using consumer_executor = std::function<void(const std::function<void()>&)>; // 推送任务在哪里执行(消费者所在连接的 IO 线程)
 struct consumer {
     using ptr = std::shared_ptr<consumer>;
     std::string tag; // 消费者标识
     std::string qname; // 订阅的队列名称
     bool auto_ack; // 自动确认标志
     consumer_callback callback; // 回调
+    consumer_executor executor; // 为空时推送在调用线程中直接执行
+private:
+    std::mutex __mtx;
+    bool __active = true; // 消费者被取消之后就不能再接收推送了
+    delivery_seq_ptr __delivery_seq;
+    std::map<uint64_t, uint64_t> __unacked; // 已推送但还没有确认的消息: delivery_tag -> 队列内的出队序号, 标签有序即推送顺序
+    std::unordered_map<uint64_t, uint64_t> __unacked_seqs; // 同上的反向索引: 出队序号 -> delivery_tag(按消息id确认时使用)
+    std::atomic<size_t> __unacked_size { 0 }; // __unacked 的大小，持有锁修改，读取不需要加锁
+    std::atomic<size_t> __pending { 0 }; // 已经安排给这个消费者、还没有推送的消息数
+
+public:
     consumer() { }
-    consumer(const std::string& ctag, const std::string& queue_name, bool ack_flag, const consumer_callback& cb)
+    consumer(const std::string& ctag, const std::string& queue_name, bool ack_flag, const consumer_callback& cb,
+        const delivery_seq_ptr& seq = delivery_seq_ptr(), const consumer_executor& exec = consumer_executor())
         : tag(ctag)
         , qname(queue_name)
         , auto_ack(ack_flag)
-        , callback(cb) { }
+        , callback(cb)
+        , executor(exec)
+        , __delivery_seq(seq ? seq : std::make_shared<std::atomic<uint64_t>>(0)) { }
+    uint64_t track(uint64_t seq) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        if (__active == false)
+            return 0; // 已经被取消了，上层需要把消息放回队列
+        uint64_t delivery_tag = __delivery_seq->fetch_add(1) + 1; // 在锁内分配，保证同一个消费者的标签单调递增
+        __unacked.emplace_hint(__unacked.end(), delivery_tag, seq);
+        __unacked_seqs.insert({ seq, delivery_tag });
+        __unacked_size.store(__unacked.size(), std::memory_order_relaxed);
+        return delivery_tag;
+    } // 记录一条推送给该消费者的待确认消息，返回分配的投递标签(失败返回0)
+    std::vector<uint64_t> untrack(uint64_t delivery_tag, bool multiple) {
+        std::vector<uint64_t> seqs;
+        std::unique_lock<std::mutex> lock(__mtx);
+        if (multiple == false) {
+            auto it = __unacked.find(delivery_tag);
+            if (it == __unacked.end())
+                return seqs;
+            seqs.push_back(it->second);
+            __unacked_seqs.erase(it->second);
+            __unacked.erase(it);
+            __unacked_size.store(__unacked.size(), std::memory_order_relaxed);
+            return seqs;
+        }
+        auto last = __unacked.upper_bound(delivery_tag);
+        for (auto it = __unacked.begin(); it != last; ++it) {
+            seqs.push_back(it->second);
+            __unacked_seqs.erase(it->second);
+        }
+        __unacked.erase(__unacked.begin(), last);
+        __unacked_size.store(__unacked.size(), std::memory_order_relaxed);
+        return seqs;
+    } // 按投递标签结束跟踪(multiple: 所有 <= delivery_tag 的消息)，返回对应的出队序号
+    void untrack_seq(uint64_t seq) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        auto it = __unacked_seqs.find(seq);
+        if (it == __unacked_seqs.end())
+            return;
+        __unacked.erase(it->second);
+        __unacked_seqs.erase(it);
+        __unacked_size.store(__unacked.size(), std::memory_order_relaxed);
+    } // 兼容按消息id确认的老客户端
+    std::vector<uint64_t> take_unacked() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        __active = false;
+        std::vector<uint64_t> seqs;
+        seqs.reserve(__unacked.size());
+        for (auto& e : __unacked)
+            seqs.push_back(e.second);
+        __unacked.clear();
+        __unacked_seqs.clear();
+        __unacked_size.store(0, std::memory_order_relaxed);
+        return seqs;
+    } // 取消消费者: 取走所有未确认消息的出队序号(按推送顺序)，之后不再接收新的推送
+    bool active() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        return __active;
+    } // 取消订阅/信道关闭之后为 false
+    size_t add_pending(size_t n) {
+        return __pending.fetch_add(n, std::memory_order_acq_rel);
+    } // 安排 n 条消息给这个消费者推送，返回之前的值(为0说明没有排队的推送任务，需要投递一个)
+    size_t take_pending() {
+        return __pending.exchange(0, std::memory_order_acq_rel);
+    } // 推送任务开始执行: 取走所有安排给这个消费者的消息数，之后安排的消息会投递新的任务
+    size_t unacked_count() {
+        return __unacked_size.load(std::memory_order_relaxed);
+    } // 不加锁，并发修改时是近似值
 };
 
 /* 以队列为单元的消费者结构 */
@@ -46,7 +131,8 @@ public:
     queue_consumer(const std::string& qname)
         : __qname(qname)
         , __rr_seq(0) { }
-    consumer::ptr create(const std::string& ctag, const std::string& queue_name, bool ack_flag, const consumer_callback& cb) {
+    consumer::ptr create(const std::string& ctag, const std::string& queue_name, bool ack_flag, const consumer_callback& cb,
+        const delivery_seq_ptr& seq = delivery_seq_ptr(), const consumer_executor& exec = consumer_executor()) {
         // 1. lock
         std::unique_lock<std::mutex> lock(__mtx);
         // 2. 判断消费者是否重复
@@ -56,22 +142,23 @@ public:
                 return consumer::ptr(); // 创建失败
             }
         // 3. 没有重复则新增，构造对象
-        auto new_consumer = std::make_shared<consumer>(ctag, queue_name, ack_flag, cb);
+        auto new_consumer = std::make_shared<consumer>(ctag, queue_name, ack_flag, cb, seq, exec);
         // 4. 田间管理后返回对象
         __consumers.push_back(new_consumer);
         return new_consumer;
     } // 创建消费者
-    void remove(const std::string& ctag) {
+    consumer::ptr remove(const std::string& ctag) {
         std::unique_lock<std::mutex> lock(__mtx);
         for (auto it = __consumers.begin(); it != __consumers.end(); ++it) {
             if ((*it)->tag == ctag) {
+                consumer::ptr cp = *it;
                 __consumers.erase(it);
-                return;
+                return cp;
             }
         }
         LOG(WARNING) << "consumer not founded, remove failed" << std::endl;
-        return;
-    } // 删除一个消费者
+        return consumer::ptr();
+    } // 删除一个消费者, 返回被删除的消费者(用于回收它未确认的消息)
     consumer::ptr rr_choose() {
         std::unique_lock<std::mutex> lock(__mtx);
         if (__consumers.size() == 0)
@@ -91,17 +178,30 @@ public:
                 return true;
         return false;
     } // 判断消费者是否存在
+    std::vector<consumer::ptr> all() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        return __consumers;
+    } // 所有消费者(拷贝)
     void clear() {
         std::unique_lock<std::mutex> lock(__mtx);
         __consumers.clear();
         __rr_seq = 0;
     } // 清理所有消费者
 };
+/* 状态查询读取的消费者快照，生成之后不再修改 */
+struct consumer_snapshot {
+    using ptr = std::shared_ptr<const consumer_snapshot>;
+    uint64_t version = 0;
+    std::vector<consumer::ptr> consumers; // 按 (队列名称, 标签) 排序
+};
 /* 对外提供的消费者管理 */
 class consumer_manager {
 private:
     std::mutex __mtx;
     std::unordered_map<std::string, queue_consumer::ptr> __queue_consumers; // 映射关系
+    std::atomic<uint64_t> __version { 1 }; // 消费者集合的版本，订阅/取消订阅之后递增
+    std::mutex __snapshot_mtx; // 只有状态查询会用到
+    consumer_snapshot::ptr __snapshot;
 public:
     using ptr = std::shared_ptr<consumer_manager>;
     consumer_manager() = default;
@@ -116,11 +216,14 @@ public:
     void destroy_queue_consumer(const std::string& qname) {
         std::unique_lock<std::mutex> lock(__mtx);
         __queue_consumers.erase(qname);
+        __version.fetch_add(1, std::memory_order_release);
     }
     consumer::ptr create(const std::string& ctag,
         const std::string& queue_name,
         bool ack_flag,
-        const consumer_callback& cb) {
+        const consumer_callback& cb,
+        const delivery_seq_ptr& seq = delivery_seq_ptr(),
+        const consumer_executor& exec = consumer_executor()) {
         queue_consumer::ptr qcp;
         {
             std::unique_lock<std::mutex> lock(__mtx); // 这个锁是保护查找操作的
@@ -131,20 +234,26 @@ public:
             }
             qcp = it->second;
         }
-        return qcp->create(ctag, queue_name, ack_flag, cb); // 这里面有自己的锁
+        consumer::ptr cp = qcp->create(ctag, queue_name, ack_flag, cb, seq, exec); // 这里面有自己的锁
+        if (cp != nullptr)
+            __version.fetch_add(1, std::memory_order_release);
+        return cp;
     }
-    void remove(const std::string& ctag, const std::string& queue_name) {
+    consumer::ptr remove(const std::string& ctag, const std::string& queue_name) {
         queue_consumer::ptr qcp;
         {
             std::unique_lock<std::mutex> lock(__mtx); // 这个锁是保护查找操作的
             auto it = __queue_consumers.find(queue_name);
             if (it == __queue_consumers.end()) {
                 LOG(ERROR) << "cannot find this queue_consumer handler: [" << queue_name << "]" << std::endl;
-                return;
+                return consumer::ptr();
             }
             qcp = it->second;
         }
-        return qcp->remove(ctag);
+        consumer::ptr cp = qcp->remove(ctag);
+        if (cp != nullptr)
+            __version.fetch_add(1, std::memory_order_release);
+        return cp;
     } // 删除指定队列里面的指定消费者
     consumer::ptr choose(const std::string& queue_name) {
         queue_consumer::ptr qcp;
@@ -185,9 +294,36 @@ public:
         }
         return qcp->exists(ctag);
     }
+    consumer_snapshot::ptr snapshot() {
+        // 订阅关系没有变化的时候直接复用上一次的快照，变化之后第一次查询才重新生成
+        // 推送路径上只多了一次原子加(订阅/取消订阅时)，查询不会长时间持有推送要用的锁
+        std::unique_lock<std::mutex> snapshot_lock(__snapshot_mtx);
+        uint64_t version = __version.load(std::memory_order_acquire); // 先读版本，生成期间的修改会让下一次查询重新生成
+        if (__snapshot != nullptr && __snapshot->version == version)
+            return __snapshot;
+        std::vector<queue_consumer::ptr> qcps;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            qcps.reserve(__queue_consumers.size());
+            for (const auto& e : __queue_consumers)
+                qcps.push_back(e.second);
+        }
+        auto snap = std::make_shared<consumer_snapshot>();
+        snap->version = version;
+        for (const auto& qcp : qcps) {
+            std::vector<consumer::ptr> cps = qcp->all();
+            snap->consumers.insert(snap->consumers.end(), cps.begin(), cps.end());
+        }
+        std::sort(snap->consumers.begin(), snap->consumers.end(), [](const consumer::ptr& a, const consumer::ptr& b) {
+            return a->qname != b->qname ? a->qname < b->qname : a->tag < b->tag;
+        });
+        __snapshot = snap;
+        return __snapshot;
+    } // 所有消费者的快照
     void clear() {
         std::unique_lock<std::mutex> lock(__mtx);
         __queue_consumers.clear();
+        __version.fetch_add(1, std::memory_order_release);
     }
 };
 } // namespace hare_mq
@@ -0,0 +1,119 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_DISPATCH__
+#define __YUFC_DISPATCH__
+
+#include "../mqcommon/logger.hpp"
+#include "../mqcommon/protocol.pb.h"
+#include "../mqcommon/trace.hpp"
+#include "connection.hpp"
+#include "metrics.hpp"
+#include "muduo/net/TcpConnection.h"
+#include "muduo/protoc/codec.h"
+#include <cassert>
+#include <functional>
+#include <vector>
+
+namespace hare_mq {
+/**
+ * 请求分发表(替代 ProtobufDispatcher + 每种请求一个手写的 on_* 处理函数)
+ * 1. 每种请求一个表项，处理函数由模板按 (请求类型, 信道/连接的成员函数) 实例化，查找连接和信道的逻辑只有一份
+ * 2. 请求都定义在 protocol.proto 中，表的下标就是消息在文件中的序号(Descriptor::index)，分发是一次数组下标和一次间接调用，
+ *    不需要按 Descriptor 查 std::map，也不需要 dynamic_cast
+ * 3. 注册请求类型时自动创建这种请求的耗时直方图(见 metrics_registry::register_op)，追踪的采样也在这里统一做
+ */
+class request_dispatcher {
+public:
+    using unknown_callback = std::function<void(const muduo::net::TcpConnectionPtr&, const MessagePtr&, muduo::Timestamp)>;
+
+private:
+    using handler = void (*)(const muduo::net::TcpConnectionPtr&, const MessagePtr&);
+    struct op {
+        handler fn = nullptr;
+        op_metrics* metrics = nullptr;
+        bool log = true; // 是否打印请求日志(心跳太频繁了，不打)
+    };
+    const google::protobuf::FileDescriptor* __file;
+    std::vector<op> __ops; // 下标: 请求类型在 protocol.proto 中的序号
+    unknown_callback __unknown;
+
+public:
+    explicit request_dispatcher(const unknown_callback& cb)
+        : __file(openChannelRequest::descriptor()->file())
+        , __ops(__file->message_type_count())
+        , __unknown(cb) { }
+    template <class Req, void (channel::*Fn)(const std::shared_ptr<Req>&)>
+    void on_channel(bool log = true) {
+        add(Req::descriptor(), &channel_handler<Req, Fn>, log);
+    } // 注册一种在信道上处理的请求
+    template <class Req, void (connection::*Fn)(const std::shared_ptr<Req>&)>
+    void on_connection(bool log = true) {
+        add(Req::descriptor(), &connection_handler<Req, Fn>, log);
+    } // 注册一种在连接上处理的请求(信道的打开关闭、心跳)
+    void dispatch(const muduo::net::TcpConnectionPtr& conn, const MessagePtr& message, muduo::Timestamp ts) {
+        const google::protobuf::Descriptor* desc = message->GetDescriptor();
+        if (desc->file() != __file || __ops[desc->index()].fn == nullptr)
+            return __unknown(conn, message, ts);
+        const op& o = __ops[desc->index()];
+        if (o.log)
+            LOG(REQUEST) << "<from " << conn->peerAddress().toIpPort() << "> Request: " << desc->name() << std::endl;
+        trace_context trace(tracer::instance().sample()); // 没有开启追踪时只有一次原子读
+        if (tracer::current() != 0)
+            trace_receive(ts);
+        uint64_t begin = tracer::now_ns();
+        o.fn(conn, message);
+        o.metrics->latency.record((tracer::now_ns() - begin) / 1000);
+    } // 交给 codec 的消息回调
+
+private:
+    void add(const google::protobuf::Descriptor* desc, handler fn, bool log) {
+        assert(desc->file() == __file); // 只能注册 protocol.proto 中的请求
+        op& o = __ops[desc->index()];
+        o.fn = fn;
+        o.metrics = metrics_registry::instance().register_op(desc->name());
+        o.log = log;
+    }
+    template <class Req, void (channel::*Fn)(const std::shared_ptr<Req>&)>
+    static void channel_handler(const muduo::net::TcpConnectionPtr& conn, const MessagePtr& message) {
+        std::shared_ptr<Req> req = std::static_pointer_cast<Req>(message); // 表项按类型注册，类型一定匹配
+        channel::ptr cp;
+        {
+            trace_scope lookup(TRACE_LOOKUP);
+            connection::ptr mq_conn = connection_manager::select_connection(conn);
+            if (mq_conn == nullptr) {
+                LOG(WARNING) << "unknown connection" << std::endl;
+                conn->shutdown();
+                return;
+            }
+            cp = mq_conn->select_channel(req->cid());
+            if (cp == nullptr) {
+                LOG(WARNING) << "unknown channel in this connection" << std::endl;
+                return;
+            }
+        }
+        ((*cp).*Fn)(req);
+    }
+    template <class Req, void (connection::*Fn)(const std::shared_ptr<Req>&)>
+    static void connection_handler(const muduo::net::TcpConnectionPtr& conn, const MessagePtr& message) {
+        connection::ptr mq_conn = connection_manager::select_connection(conn);
+        if (mq_conn == nullptr) {
+            LOG(WARNING) << "unknown connection" << std::endl;
+            conn->shutdown();
+            return;
+        }
+        ((*mq_conn).*Fn)(std::static_pointer_cast<Req>(message));
+    }
+    static void trace_receive(muduo::Timestamp ts) {
+        // ts 是数据到达(poll 返回)的时间，和 steady_clock 不是同一个时钟，按经过的时间换算
+        int64_t elapsed_us = muduo::Timestamp::now().microSecondsSinceEpoch() - ts.microSecondsSinceEpoch();
+        uint64_t now = tracer::now_ns();
+        tracer::instance().record(tracer::current(), TRACE_RECEIVE, now - std::max<int64_t>(elapsed_us, 0) * 1000, now);
+    } // 解码 + 分发阶段
+};
+} // namespace hare_mq
+
+#endif
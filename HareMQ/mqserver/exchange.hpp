@@ -204,6 +204,7 @@ public:
         return it->second;
     }
     std::unordered_map<std::string, exchange::ptr> select_all_exchanges() {
+        std::unique_lock<std::mutex> lock(__mtx); // 需要加锁保护
         return this->__exchanges;
     }
     bool exists(const std::string& name) {
@@ -10,12 +10,18 @@
 #include "../mqcommon/helper.hpp"
 #include "../mqcommon/logger.hpp"
 #include "../mqcommon/msg.pb.h"
+#include "../mqcommon/trace.hpp"
+#include "metrics.hpp"
+#include "mpsc_ring.hpp"
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <iostream>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace hare_mq {
 #define DATAFILE_SUBFIX ".mqd"
@@ -58,9 +64,12 @@ public:
         file_helper::remove(__tmp_file);
     }
     bool insert(message_ptr& msg) {
+        metrics_timer timer(METRIC_DISK_WRITE_LATENCY);
+        trace_scope trace(TRACE_DISK_WRITE);
         return __insert(__data_file, msg);
     }
     bool remove(message_ptr& msg) {
+        metrics_timer timer(METRIC_DISK_WRITE_LATENCY);
         // 1. 将msg的有效位改为0
         msg->mutable_payload()->set_valid("0");
         // 2. 对msg进行序列化
@@ -106,6 +115,9 @@ public:
         // 5. 返回新的有效数据
         return result_lst;
     } // 垃圾回收
+    size_t disk_bytes() {
+        return file_helper(__data_file).size();
+    } // 持久化文件的大小
 private:
     bool __load(std::list<message_ptr>& lst) {
         // 1. 加载文件中所有的有效数据
@@ -161,6 +173,152 @@ private:
     }
 };
 
+#define MSG_RING_CHUNK_SHIFT 8 // 每个块存放 256 个消息句柄(4KB)
+#define MSG_RING_SPARE_CHUNKS 2 // 保留的空闲块数，队列在块边界附近反复进出时不会反复申请释放内存
+/* 分段的环形缓冲区: 消息句柄存放在固定大小的连续块里，块指针按块号组成一个环
+ * 1. 和 std::list 相比，每条消息只占一个 shared_ptr 的槽位，不需要单独申请链表节点，出队时按顺序访问内存
+ * 2. 位置是单调变化的绝对下标，块号对环的大小取模就是块指针所在的位置，两端都可以进出
+ * 3. 只有 [head, tail) 覆盖到的块才会被申请，空队列不占用块 */
+class msg_ring {
+private:
+    using chunk_ptr = std::unique_ptr<message_ptr[]>;
+    static const size_t CHUNK_SIZE = (size_t)1 << MSG_RING_CHUNK_SHIFT;
+    static const size_t ORIGIN = (size_t)1 << 62; // 初始位置放在中间，push_front 不会下溢
+    std::vector<chunk_ptr> __map; // 大小是 2 的幂
+    std::vector<chunk_ptr> __spare; // 空闲块
+    size_t __head; // 队首的绝对位置
+    size_t __tail; // 队尾的下一个位置
+public:
+    msg_ring()
+        : __head(ORIGIN)
+        , __tail(ORIGIN) { }
+    void push_back(const message_ptr& msg) {
+        reserve_chunk(__tail, (__tail >> MSG_RING_CHUNK_SHIFT) - (__head >> MSG_RING_CHUNK_SHIFT) + 1);
+        slot(__tail) = msg;
+        ++__tail;
+    }
+    void push_front(const message_ptr& msg) {
+        reserve_chunk(__head - 1, (last() >> MSG_RING_CHUNK_SHIFT) - ((__head - 1) >> MSG_RING_CHUNK_SHIFT) + 1);
+        --__head;
+        slot(__head) = msg;
+    }
+    message_ptr& front() { return slot(__head); } // 调用之前要保证不为空
+    void pop_front() {
+        size_t old = __head++;
+        slot(old).reset();
+        if (__head == __tail) {
+            release_chunk(old >> MSG_RING_CHUNK_SHIFT);
+            __head = __tail = ORIGIN; // 空了就回到初始位置
+        } else if ((__head >> MSG_RING_CHUNK_SHIFT) != (old >> MSG_RING_CHUNK_SHIFT)) {
+            release_chunk(old >> MSG_RING_CHUNK_SHIFT); // 队首离开了这个块
+        }
+    }
+    size_t size() const { return __tail - __head; }
+    bool empty() const { return __head == __tail; }
+    void clear() {
+        while (!empty())
+            pop_front();
+    }
+
+private:
+    size_t last() const { return empty() ? __head : __tail - 1; } // 最后一个元素的位置(空的时候取队首)
+    message_ptr& slot(size_t pos) {
+        return __map[(pos >> MSG_RING_CHUNK_SHIFT) & (__map.size() - 1)][pos & (CHUNK_SIZE - 1)];
+    }
+    void reserve_chunk(size_t pos, size_t span) {
+        // 保证 pos 所在的块已经申请了，span 是写入之后需要的块数
+        if (empty())
+            span = 1;
+        if (span > __map.size())
+            grow(span);
+        chunk_ptr& c = __map[(pos >> MSG_RING_CHUNK_SHIFT) & (__map.size() - 1)];
+        if (c != nullptr)
+            return;
+        if (!__spare.empty()) {
+            c = std::move(__spare.back());
+            __spare.pop_back();
+        } else {
+            c.reset(new message_ptr[CHUNK_SIZE]);
+        }
+    }
+    void grow(size_t span) {
+        size_t n = __map.empty() ? 1 : __map.size();
+        while (n < span)
+            n <<= 1;
+        std::vector<chunk_ptr> map(n);
+        if (!empty()) {
+            for (size_t c = __head >> MSG_RING_CHUNK_SHIFT; c <= (last() >> MSG_RING_CHUNK_SHIFT); ++c)
+                map[c & (n - 1)] = std::move(__map[c & (__map.size() - 1)]);
+        }
+        __map.swap(map);
+    }
+    void release_chunk(size_t chunk) {
+        chunk_ptr& c = __map[chunk & (__map.size() - 1)];
+        if (__spare.size() < MSG_RING_SPARE_CHUNKS)
+            __spare.push_back(std::move(c));
+        else
+            c.reset();
+    }
+};
+
+#define MAX_PRIORITY_LIMIT 63 // 队列最多支持 0~63 共 64 个优先级，非空级别正好用一个 uint64_t 记录
+/* 按优先级分桶的待推送消息: 每个优先级一个先进先出的桶，加一个记录非空桶的位图，取队首是 O(1) 的 */
+class priority_buckets {
+private:
+    std::vector<msg_ring> __buckets; // 下标就是优先级
+    uint64_t __bitmap; // 第 i 位为 1 表示优先级 i 的桶非空
+    size_t __size;
+public:
+    priority_buckets(uint32_t max_priority = 0)
+        : __buckets(std::min<uint32_t>(max_priority, MAX_PRIORITY_LIMIT) + 1)
+        , __bitmap(0)
+        , __size(0) { }
+    void push_back(const message_ptr& msg) {
+        uint32_t level = level_of(msg);
+        __buckets[level].push_back(msg);
+        __bitmap |= (1ULL << level);
+        ++__size;
+    } // 新消息放到自己优先级的桶尾
+    void push_front(const message_ptr& msg) {
+        uint32_t level = level_of(msg);
+        __buckets[level].push_front(msg);
+        __bitmap |= (1ULL << level);
+        ++__size;
+    } // 重新入队的消息放回自己优先级的桶首
+    message_ptr& front() {
+        return __buckets[top_level()].front();
+    } // 调用之前要保证不为空
+    void pop_front() {
+        uint32_t level = top_level();
+        __buckets[level].pop_front();
+        if (__buckets[level].empty())
+            __bitmap &= ~(1ULL << level);
+        --__size;
+    }
+    size_t size() const { return __size; }
+    bool empty() const { return __size == 0; }
+    void clear() {
+        for (auto& b : __buckets)
+            b.clear();
+        __bitmap = 0;
+        __size = 0;
+    }
+
+private:
+    uint32_t level_of(const message_ptr& msg) const {
+        uint32_t priority = msg->payload().properties().priority();
+        return std::min<uint32_t>(priority, __buckets.size() - 1); // 超过队列最大优先级的按最大优先级处理
+    }
+    uint32_t top_level() const {
+        return 63 - __builtin_clzll(__bitmap); // 最高的非空优先级
+    }
+};
+
+#define QUEUE_INBOX_CAPACITY 16384 // 无锁入口的容量，满了之后走有锁的路径
+enum queue_inbox_mode {
+    INBOX_NONE = 0, // 所有操作都加队列锁
+    INBOX_MPSC // 非持久化消息经过无锁入口(多生产者)进入队列
+};
 /* 队列管理（上面是持久化，这里是内存的）*/
 class queue_message {
 private:
@@ -169,24 +327,40 @@ private:
     size_t __valid_count; // 有效消息数量
     size_t __total_count; // 总共消息数量
     message_mapper __mapper; // 持久化的句柄
-    std::list<message_ptr> __msgs; // 待推送的消息
+    priority_buckets __msgs; // 待推送的消息(按优先级分桶)
     std::unordered_map<std::string, message_ptr> __durable_msgs; // 待持久化的消息
-    std::unordered_map<std::string, message_ptr> __wait_ack_msgs; // 待确认的消息
+    std::unordered_map<uint64_t, message_ptr> __wait_ack_msgs; // 待确认的消息: 出队序号 -> 消息
+    std::unordered_map<std::string, uint64_t> __wait_ack_ids; // 待确认的消息: 消息id -> 出队序号(按消息id确认时使用)
+    uint64_t __ack_seq; // 出队序号，队列内唯一，上层按序号确认，不需要用消息id查找
+    // 无锁入口: IO 线程发布的非持久化消息先放到这里，推送线程取消息的时候(持有锁)再批量搬进 __msgs
+    std::unique_ptr<mpsc_ring<message_ptr>> __inbox;
+    std::atomic<size_t> __ready_count; // 可推送的消息数(包括还在入口中的)，读取不需要加锁
+    std::atomic<size_t> __unacked_count; // __wait_ack_msgs 的大小，持有锁修改，读取不需要加锁
+    queue_counters __counters; // 队列维度的运行指标
 public:
     using ptr = std::shared_ptr<queue_message>;
-    queue_message(const std::string& base_dir, const std::string& qname)
-        : __mapper(base_dir, qname)
-        , __queue_name(qname)
+    queue_message(const std::string& base_dir, const std::string& qname, uint32_t max_priority = 0, queue_inbox_mode mode = INBOX_NONE)
+        : __queue_name(qname)
         , __valid_count(0)
-        , __total_count(0) { }
+        , __total_count(0)
+        , __mapper(base_dir, qname)
+        , __msgs(max_priority)
+        , __ack_seq(0)
+        , __ready_count(0)
+        , __unacked_count(0) {
+        if (mode != INBOX_NONE)
+            __inbox.reset(new mpsc_ring<message_ptr>(QUEUE_INBOX_CAPACITY));
+    }
     bool recovery() {
         // 恢复历史消息
         std::unique_lock<std::mutex> lock(__mtx);
-        __msgs = __mapper.gc();
-        for (auto& msg : __msgs) {
+        std::list<message_ptr> msgs = __mapper.gc();
+        for (auto& msg : msgs) {
             __durable_msgs.insert({ msg->payload().properties().id(), msg });
+            __msgs.push_back(msg); // 按文件中的顺序放回各自优先级的桶，恢复之后优先级顺序不变
         }
-        __valid_count = __total_count = __msgs.size();
+        __valid_count = __total_count = msgs.size();
+        __ready_count = msgs.size();
         return true;
     }
     bool insert(const BasicProperties* bp, const std::string& body, bool queue_durable) {
@@ -196,69 +370,103 @@ public:
         msg->mutable_payload()->set_body(body);
         if (bp != nullptr) {
             DeliveryMode mode = queue_durable ? bp->delivery_mode() : DeliveryMode::UNDURABLE;
-            msg->mutable_payload()->mutable_properties()->set_id(bp->id());
+            *msg->mutable_payload()->mutable_properties() = *bp; // 优先级、头部等属性一起带上
             msg->mutable_payload()->mutable_properties()->set_delivery_mode(mode);
-            msg->mutable_payload()->mutable_properties()->set_routing_key(bp->routing_key());
         } else {
             DeliveryMode mode = queue_durable ? DeliveryMode::DURABLE : DeliveryMode::UNDURABLE;
             msg->mutable_payload()->mutable_properties()->set_id(uuid_helper::uuid());
             msg->mutable_payload()->mutable_properties()->set_delivery_mode(mode);
             msg->mutable_payload()->mutable_properties()->set_routing_key("");
         }
-        std::unique_lock<std::mutex> lock(__mtx); // lock
-        // 2. 判断是否需要持久化
-        if (msg->payload().properties().delivery_mode() == DeliveryMode::DURABLE) {
-            // 需要持久化
-            msg->mutable_payload()->set_valid("1"); // 在持久化存储中表示数据有效
-            // 这个valid字段也就是持久化才有用，如果不需要持久化，就没用了
-            // 3. (持久化)
-            bool ret = __mapper.insert(msg);
-            if (ret == false) {
-                LOG(ERROR) << "durable storage failed: " << body.c_str() << std::endl;
-                return false;
-            }
-            __valid_count += 1; // 持久化信息的量+1
-            __total_count += 1;
-            __durable_msgs.insert({ msg->payload().properties().id(), msg });
-        }
-        // 4. 内存的管理
-        __msgs.push_back(msg);
-        return true;
+        msg->set_trace_id(tracer::current()); // 推送线程据此接上发布时的追踪
+        return enqueue(msg, queue_durable, true);
+    }
+    bool insert(message_ptr msg, bool queue_durable) {
+        /* 插入一个已经构造好的消息对象(死信转投时直接复用原消息，不再拷贝消息体) */
+        // 死信转投不走无锁入口，和原来一样加锁入队
+        return enqueue(msg, queue_durable, false);
     }
     bool remove(const std::string& msg_id) {
         std::unique_lock<std::mutex> lock(__mtx); // lock
-        // 1. 从待确认队列中查找消息
-        auto it = __wait_ack_msgs.find(msg_id);
-        if (it == __wait_ack_msgs.end()) // 没找到这条消息
+        uint64_t seq = find_seq(msg_id);
+        if (seq == 0) // 没找到这条消息
             return true;
-        // 2. 根据消息的持久化模式，决定是否删除持久化消息
-        if (it->second->payload().properties().delivery_mode() == DeliveryMode::DURABLE) {
-            // 3. 删除持久化信息
-            __mapper.remove(it->second);
-            // 4. 删除内存中的信息
-            __durable_msgs.erase(msg_id);
-            __valid_count -= 1; // 持久化文件有效数量-=1
-            // 判断是否需要垃圾回收
+        if (remove_locked(seq))
             this->gc(); // 内部会判断是否需要垃圾回收的
-        }
-        __wait_ack_msgs.erase(msg_id);
         return true;
-    } // ack, 每次remove后要去检查是否需要gc
-    message_ptr front() {
+    } // ack(兼容按消息id确认), 每次remove后要去检查是否需要gc
+    void remove(const std::vector<std::string>& msg_ids) {
+        std::unique_lock<std::mutex> lock(__mtx); // 整批只加一次锁
+        bool durable_removed = false;
+        for (uint64_t seq : find_seqs(msg_ids))
+            durable_removed |= remove_locked(seq);
+        if (durable_removed)
+            this->gc(); // 整批确认完之后再检查一次是否需要垃圾回收
+    } // 批量ack(兼容按消息id确认)
+    void remove(const std::vector<uint64_t>& seqs) {
+        std::unique_lock<std::mutex> lock(__mtx); // 整批只加一次锁
+        bool durable_removed = false;
+        for (uint64_t seq : seqs)
+            durable_removed |= remove_locked(seq);
+        if (durable_removed)
+            this->gc();
+    } // 按出队序号批量ack
+    std::list<message_ptr> reject(const std::vector<std::string>& msg_ids, bool requeue) {
+        std::unique_lock<std::mutex> lock(__mtx); // lock
+        return reject_locked(find_seqs(msg_ids), requeue);
+    } // nack/reject(兼容按消息id拒绝)
+    std::list<message_ptr> reject(const std::vector<uint64_t>& seqs, bool requeue) {
+        std::unique_lock<std::mutex> lock(__mtx); // lock
+        return reject_locked(seqs, requeue);
+    } // 按出队序号 nack/reject
+    uint64_t delivery_seq(const std::string& msg_id) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        return find_seq(msg_id);
+    } // 待确认消息的出队序号，找不到返回0
+    message_ptr front(uint64_t* seq = nullptr) {
         std::unique_lock<std::mutex> lock(__mtx);
+        drain_inbox();
         if (__msgs.size() == 0)
             return message_ptr();
         // 从mesg中取出数据
         message_ptr msg = __msgs.front();
         __msgs.pop_front();
-        // 将这个消息，向代确认的hashmap中放进去
-        __wait_ack_msgs.insert({ msg->payload().properties().id(), msg });
+        __ready_count.fetch_sub(1, std::memory_order_relaxed);
+        count(__counters.delivered, METRIC_DELIVERED);
+        // 分配出队序号，放到待确认的hashmap中去
+        uint64_t ack_seq = ++__ack_seq;
+        track_locked(ack_seq, msg);
+        __unacked_count.store(__wait_ack_msgs.size(), std::memory_order_relaxed);
+        if (seq)
+            *seq = ack_seq;
         return msg;
-    } // 获取队首消息
+    } // 获取队首消息，seq 返回这条消息的出队序号，确认时使用
+    std::vector<message_ptr> front(size_t max_count, size_t max_bytes, std::vector<uint64_t>* seqs = nullptr) {
+        std::vector<message_ptr> result;
+        std::unique_lock<std::mutex> lock(__mtx); // 整批只加一次锁
+        drain_inbox();
+        size_t total_bytes = 0;
+        while (!__msgs.empty() && result.size() < max_count) {
+            message_ptr& msg = __msgs.front();
+            total_bytes += msg->payload().body().size();
+            if (max_bytes != 0 && total_bytes > max_bytes && !result.empty())
+                break; // 超过字节数限制了(但至少要返回一条)
+            uint64_t ack_seq = ++__ack_seq;
+            track_locked(ack_seq, msg);
+            if (seqs)
+                seqs->push_back(ack_seq);
+            result.push_back(std::move(msg));
+            __msgs.pop_front();
+        }
+        __ready_count.fetch_sub(result.size(), std::memory_order_relaxed);
+        __unacked_count.store(__wait_ack_msgs.size(), std::memory_order_relaxed);
+        if (!result.empty())
+            count(__counters.delivered, METRIC_DELIVERED, result.size());
+        return result;
+    } // 批量获取队首消息
     size_t getable_count() {
-        std::unique_lock<std::mutex> lock(__mtx);
-        return __msgs.size();
-    }
+        return __ready_count.load(std::memory_order_relaxed);
+    } // 不加锁，并发修改时是近似值
     size_t total_count() {
         std::unique_lock<std::mutex> lock(__mtx);
         return __total_count;
@@ -270,16 +478,156 @@ public:
         std::unique_lock<std::mutex> lock(__mtx);
         return __wait_ack_msgs.size();
     }
+    queue_stats live_stats() {
+        queue_stats s;
+        s.name = __queue_name;
+        s.depth = getable_count();
+        s.unacked = __unacked_count.load(std::memory_order_relaxed);
+        s.published = __counters.published.load(std::memory_order_relaxed);
+        s.delivered = __counters.delivered.load(std::memory_order_relaxed);
+        s.acked = __counters.acked.load(std::memory_order_relaxed);
+        s.redelivered = __counters.redelivered.load(std::memory_order_relaxed);
+        return s;
+    } // 不加锁读取队列的状态和累计计数(不含磁盘占用)，并发修改时是近似值
+    queue_stats stats() {
+        queue_stats s = live_stats();
+        std::unique_lock<std::mutex> lock(__mtx); // 垃圾回收会替换持久化文件
+        s.disk_bytes = __mapper.disk_bytes();
+        return s;
+    } // 队列当前的状态和累计计数
     void clear() {
         std::unique_lock<std::mutex> lock(__mtx);
         __mapper.remove_msg_file();
+        drain_inbox();
         __msgs.clear();
+        __ready_count = 0;
         __durable_msgs.clear();
         __wait_ack_msgs.clear();
+        __wait_ack_ids.clear();
+        __unacked_count = 0;
         __valid_count = __total_count = 0;
     }
 
 private:
+    bool enqueue(message_ptr msg, bool queue_durable, bool use_inbox) {
+        if (queue_durable == false && msg->payload().properties().delivery_mode() != DeliveryMode::UNDURABLE)
+            msg->mutable_payload()->mutable_properties()->set_delivery_mode(DeliveryMode::UNDURABLE); // 非持久化消息不会被修改，可以在多个队列之间共享
+        __ready_count.fetch_add(1, std::memory_order_relaxed); // 先加，保证计数不会比实际的少到下溢
+        if (use_inbox && __inbox != nullptr && msg->payload().properties().delivery_mode() != DeliveryMode::DURABLE && __inbox->push(msg)) {
+            count(__counters.published, METRIC_PUBLISHED);
+            return true; // 快速路径: 不需要持久化的消息不加锁直接进入口
+        }
+        if (__inbox != nullptr)
+            __inbox->wait_published(); // 不持有锁: 入口里更早的消息可能排在其他生产者还没发布的槽位后面
+        std::unique_lock<std::mutex> lock(__mtx); // lock
+        drain_inbox(); // 先把入口里更早的消息搬进来，保证同一个生产者的消息顺序不变
+        // 2. 判断是否需要持久化
+        if (msg->payload().properties().delivery_mode() == DeliveryMode::DURABLE) {
+            // 需要持久化
+            msg->mutable_payload()->set_valid("1"); // 在持久化存储中表示数据有效
+            // 这个valid字段也就是持久化才有用，如果不需要持久化，就没用了
+            // 3. (持久化)
+            bool ret = __mapper.insert(msg);
+            if (ret == false) {
+                LOG(ERROR) << "durable storage failed: " << msg->payload().body() << std::endl;
+                __ready_count.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            __valid_count += 1; // 持久化信息的量+1
+            __total_count += 1;
+            __durable_msgs.insert({ msg->payload().properties().id(), msg });
+        }
+        // 4. 内存的管理
+        __msgs.push_back(msg);
+        count(__counters.published, METRIC_PUBLISHED);
+        return true;
+    } // 发布的消息 use_inbox 为 true
+    static void count(std::atomic<uint64_t>& queue_counter, metric_counter c, uint64_t n = 1) {
+        queue_counter.fetch_add(n, std::memory_order_relaxed);
+        metrics_registry::instance().add(c, n);
+    } // 同时更新队列的计数和全局计数
+    void drain_inbox() {
+        if (__inbox == nullptr)
+            return;
+        message_ptr msg;
+        while (__inbox->pop(msg))
+            __msgs.push_back(std::move(msg));
+    } // 持有锁的时候调用，同一时刻只有一个消费者；停在还没有发布的槽位，剩下的下一次再搬
+    bool remove_locked(uint64_t seq) {
+        // 1. 从待确认队列中查找消息
+        auto it = __wait_ack_msgs.find(seq);
+        if (it == __wait_ack_msgs.end())
+            return false;
+        // 2. 根据消息的持久化模式，决定是否删除持久化消息
+        bool durable = it->second->payload().properties().delivery_mode() == DeliveryMode::DURABLE;
+        if (durable) {
+            // 3. 删除持久化信息和内存中的信息
+            __mapper.remove(it->second);
+            __durable_msgs.erase(it->second->payload().properties().id());
+            __valid_count -= 1; // 持久化文件有效数量-=1
+        }
+        untrack_locked(it);
+        __unacked_count.fetch_sub(1, std::memory_order_relaxed);
+        count(__counters.acked, METRIC_ACKED);
+        return durable;
+    } // 确认一条待确认的消息，返回是否删除了持久化数据(需要检查gc)
+    std::list<message_ptr> reject_locked(const std::vector<uint64_t>& seqs, bool requeue) {
+        /**
+         * 批量拒绝待确认的消息，返回被拒绝的消息（找不到的序号会被忽略）
+         * requeue == true: 消息按原有顺序放回队首
+         * requeue == false: 消息被删除（包括持久化的部分），交给上层做死信转投
+         */
+        std::list<message_ptr> rejected_msgs;
+        for (auto rit = seqs.rbegin(); rit != seqs.rend(); ++rit) {
+            // 倒序遍历，这样 push_front 之后的顺序和 seqs 的顺序一致
+            auto it = __wait_ack_msgs.find(*rit);
+            if (it == __wait_ack_msgs.end()) // 没找到这条消息
+                continue;
+            message_ptr msg = it->second;
+            untrack_locked(it);
+            __unacked_count.fetch_sub(1, std::memory_order_relaxed);
+            rejected_msgs.push_front(msg);
+            if (requeue) {
+                __msgs.push_front(msg);
+                __ready_count.fetch_add(1, std::memory_order_relaxed);
+                count(__counters.redelivered, METRIC_REDELIVERED);
+                continue;
+            }
+            metrics_registry::instance().add(METRIC_REJECTED);
+            if (msg->payload().properties().delivery_mode() == DeliveryMode::DURABLE) {
+                __mapper.remove(msg);
+                __durable_msgs.erase(msg->payload().properties().id());
+                __valid_count -= 1;
+            }
+        }
+        if (!requeue && !rejected_msgs.empty())
+            this->gc(); // 内部会判断是否需要垃圾回收的
+        return rejected_msgs;
+    }
+    void track_locked(uint64_t seq, const message_ptr& msg) {
+        __wait_ack_msgs.insert({ seq, msg });
+        __wait_ack_ids[msg->payload().properties().id()] = seq;
+    } // 放入待确认的消息，两个索引一起维护
+    void untrack_locked(std::unordered_map<uint64_t, message_ptr>::iterator it) {
+        auto id_it = __wait_ack_ids.find(it->second->payload().properties().id());
+        if (id_it != __wait_ack_ids.end() && id_it->second == it->first)
+            __wait_ack_ids.erase(id_it); // 同一个id有多条待确认消息时，只删除指向这一条的索引
+        __wait_ack_msgs.erase(it);
+    } // 移除待确认的消息，两个索引一起维护
+    uint64_t find_seq(const std::string& msg_id) {
+        auto it = __wait_ack_ids.find(msg_id);
+        return it == __wait_ack_ids.end() ? 0 : it->second;
+    } // 兼容按消息id确认的老客户端
+    std::vector<uint64_t> find_seqs(const std::vector<std::string>& msg_ids) {
+        std::vector<uint64_t> seqs;
+        seqs.reserve(msg_ids.size());
+        for (const auto& id : msg_ids) {
+            uint64_t seq = find_seq(id);
+            if (seq != 0)
+                seqs.push_back(seq);
+        }
+        return seqs;
+    } // 按 msg_ids 的顺序返回对应的出队序号
     bool gc_check() {
         // 判断当前状态是否需要进行垃圾回收
         // 持久化消息总量 > 2000 且其中有效比例 <50% 的时候进行垃圾回收
@@ -291,6 +639,8 @@ private:
         // 进行垃圾回收，获取有效的消息链表
         if (gc_check() == false)
             return;
+        metrics_registry::instance().add(METRIC_GC_RUNS);
+        metrics_timer timer(METRIC_GC_PAUSE);
         auto new_valid_msgs = __mapper.gc();
         assert(new_valid_msgs.size() == __valid_count); // for debug
         // 更新每一条消息的实际存储位置
@@ -300,6 +650,7 @@ private:
                 // 不应该出现这种情况，__durable_msgs里面的消息和new_valid_msgs的消息应该是相同的，都是有效消息
                 LOG(ERROR) << "a msg after gc missed" << std::endl;
                 __msgs.push_back(m); // 丢到消息的内存管理中去
+                __ready_count.fetch_add(1, std::memory_order_relaxed);
                 __durable_msgs.insert({ m->payload().properties().id(), m });
                 continue;
             }
@@ -321,14 +672,14 @@ public:
     using ptr = std::shared_ptr<message_manager>;
     message_manager(const std::string& base_dir)
         : __base_dir(base_dir) { }
-    void init_queue_msg(const std::string& qname) {
+    void init_queue_msg(const std::string& qname, uint32_t max_priority = 0, queue_inbox_mode mode = INBOX_NONE) {
         queue_message::ptr qmp;
         { // lock
             std::unique_lock<std::mutex> lock(__mtx);
             auto it = __queue_msgs.find(qname);
             if (it != __queue_msgs.end())
                 return;
-            qmp = std::make_shared<queue_message>(__base_dir, qname);
+            qmp = std::make_shared<queue_message>(__base_dir, qname, max_priority, mode);
             __queue_msgs.insert(std::make_pair(qname, qmp));
         }
         qmp->recovery(); // no lock
@@ -358,7 +709,20 @@ public:
         }
         return qmp->insert(bp, body, queue_durable);
     } // 向 qname 插入一个消息
-    message_ptr front(const std::string& qname) {
+    bool insert(const std::string& qname, const message_ptr& msg, bool queue_durable) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end()) {
+                LOG(ERROR) << "insert msg failed, no this queue: " << qname << std::endl;
+                return false;
+            }
+            qmp = it->second;
+        }
+        return qmp->insert(msg, queue_durable);
+    } // 向 qname 插入一个已经构造好的消息
+    message_ptr front(const std::string& qname, uint64_t* seq = nullptr) {
         queue_message::ptr qmp;
         {
             std::unique_lock<std::mutex> lock(__mtx);
@@ -369,8 +733,21 @@ public:
             }
             qmp = it->second;
         }
-        return qmp->front();
+        return qmp->front(seq);
     } // 获取 qname 这个队列的队首消息
+    std::vector<message_ptr> front(const std::string& qname, size_t max_count, size_t max_bytes, std::vector<uint64_t>* seqs = nullptr) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end()) {
+                LOG(ERROR) << "get queue front failed, no this queue: " << qname << std::endl;
+                return std::vector<message_ptr>();
+            }
+            qmp = it->second;
+        }
+        return qmp->front(max_count, max_bytes, seqs);
+    } // 批量获取 qname 这个队列的队首消息
     void ack(const std::string& qname, const std::string msg_id) {
         queue_message::ptr qmp;
         {
@@ -384,6 +761,69 @@ public:
         }
         qmp->remove(msg_id); // 确认就是删除
     } // 对 qname 中的 msg_id 进行确认
+    void ack(const std::string& qname, const std::vector<std::string>& msg_ids) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end()) {
+                LOG(ERROR) << "ack mesg failed, no this queue: " << qname << std::endl;
+                return;
+            }
+            qmp = it->second;
+        }
+        qmp->remove(msg_ids);
+    } // 对 qname 中的一批消息进行确认
+    uint64_t delivery_seq(const std::string& qname, const std::string& msg_id) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end())
+                return 0;
+            qmp = it->second;
+        }
+        return qmp->delivery_seq(msg_id);
+    } // 查找待确认消息的出队序号
+    void ack(const std::string& qname, const std::vector<uint64_t>& seqs) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end()) {
+                LOG(ERROR) << "ack mesg failed, no this queue: " << qname << std::endl;
+                return;
+            }
+            qmp = it->second;
+        }
+        qmp->remove(seqs);
+    } // 按出队序号对 qname 中的一批消息进行确认
+    std::list<message_ptr> reject(const std::string& qname, const std::vector<std::string>& msg_ids, bool requeue) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end()) {
+                LOG(ERROR) << "reject mesg failed, no this queue: " << qname << std::endl;
+                return std::list<message_ptr>();
+            }
+            qmp = it->second;
+        }
+        return qmp->reject(msg_ids, requeue);
+    } // 对 qname 中的一批消息进行拒绝
+    std::list<message_ptr> reject(const std::string& qname, const std::vector<uint64_t>& seqs, bool requeue) {
+        queue_message::ptr qmp;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            auto it = __queue_msgs.find(qname);
+            if (it == __queue_msgs.end()) {
+                LOG(ERROR) << "reject mesg failed, no this queue: " << qname << std::endl;
+                return std::list<message_ptr>();
+            }
+            qmp = it->second;
+        }
+        return qmp->reject(seqs, requeue);
+    } // 按出队序号对 qname 中的一批消息进行拒绝
     size_t getable_count(const std::string& qname) {
         queue_message::ptr qmp;
         {
@@ -436,6 +876,24 @@ public:
         }
         return qmp->wait_ack_count();
     }
+    std::unordered_map<std::string, queue_message::ptr> all() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        return __queue_msgs;
+    } // 所有队列的消息句柄(拷贝)
+    std::vector<queue_stats> stats() {
+        std::vector<queue_message::ptr> qmps;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            qmps.reserve(__queue_msgs.size());
+            for (const auto& q : __queue_msgs)
+                qmps.push_back(q.second);
+        }
+        std::vector<queue_stats> result;
+        result.reserve(qmps.size());
+        for (const auto& qmp : qmps)
+            result.push_back(qmp->stats()); // 逐个队列加锁读取，不会同时持有管理器的锁
+        return result;
+    } // 所有队列的状态
     void clear() {
         std::unique_lock<std::mutex> lock(__mtx);
         for (auto& q : __queue_msgs)
@@ -0,0 +1,263 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_METRICS__
+#define __YUFC_METRICS__
+
+#include "../mqcommon/histogram.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hare_mq {
+// 服务器的运行指标
+// 1. 全局计数器和直方图按线程分片: 每个线程第一次记录时注册自己的分片，之后只写自己的分片，没有锁也没有跨线程的缓存行争用
+// 2. 读取时(统计请求/Prometheus 抓取)才把所有分片汇总，线程退出之后分片保留，计数不会丢
+// 3. 队列维度的计数在 queue_message 中(见 queue_counters)，队列深度、待确认数、磁盘占用在读取时直接取当前值
+enum metric_counter {
+    METRIC_PUBLISHED = 0, // 进入队列的消息数(一条消息路由到多个队列算多次)
+    METRIC_DELIVERED, // 推送/拉取出队的消息数
+    METRIC_ACKED, // 确认的消息数
+    METRIC_REDELIVERED, // 被拒绝之后重新入队的消息数
+    METRIC_REJECTED, // 被拒绝并且不重新入队的消息数(丢弃或者转投死信交换机)
+    METRIC_PUBLISH_UNROUTED, // 没有路由到任何队列的发布请求数
+    METRIC_GC_RUNS, // 持久化文件垃圾回收次数
+    METRIC_FRAMES_SENT, // 发送给客户端的帧数(响应 + 推送)
+    METRIC_SOCKET_WRITES, // 把合并之后的帧写到连接上的次数，和上一个的比值就是平均每次写出的帧数
+    METRIC_COUNTER_MAX
+};
+enum metric_histogram {
+    METRIC_ROUTE_LATENCY = 0, // 一次发布的路由耗时(微秒)
+    METRIC_DISK_WRITE_LATENCY, // 一次持久化写入(追加或者标记删除)的耗时(微秒)
+    METRIC_GC_PAUSE, // 一次垃圾回收持有队列锁的时间(微秒)
+    METRIC_HISTOGRAM_MAX
+};
+
+// 一个队列的计数，和全局计数同时更新
+struct queue_counters {
+    std::atomic<uint64_t> published { 0 };
+    std::atomic<uint64_t> delivered { 0 };
+    std::atomic<uint64_t> acked { 0 };
+    std::atomic<uint64_t> redelivered { 0 };
+};
+
+// 读取时某个队列的状态
+struct queue_stats {
+    std::string name;
+    uint64_t depth = 0; // 待推送的消息数
+    uint64_t unacked = 0; // 待确认的消息数
+    uint64_t disk_bytes = 0; // 持久化文件大小
+    uint64_t published = 0;
+    uint64_t delivered = 0;
+    uint64_t acked = 0;
+    uint64_t redelivered = 0;
+};
+
+struct histogram_summary {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+    uint64_t max = 0;
+    void summarize(const histogram& h) {
+        count = h.count();
+        sum = h.sum();
+        p50 = h.percentile(0.50);
+        p90 = h.percentile(0.90);
+        p99 = h.percentile(0.99);
+        p999 = h.percentile(0.999);
+        max = h.max();
+    }
+};
+
+// 一种请求的处理耗时(微秒)，直方图的 count 就是请求数，由请求分发表在注册请求类型时创建
+struct op_metrics {
+    std::string name;
+    histogram latency;
+    op_metrics(const std::string& n)
+        : name(n) { }
+};
+struct op_summary {
+    std::string name;
+    histogram_summary latency;
+};
+
+// 某一时刻汇总之后的全部指标
+struct metrics_snapshot {
+    uint64_t counters[METRIC_COUNTER_MAX] = { 0 };
+    histogram_summary histograms[METRIC_HISTOGRAM_MAX];
+    std::vector<op_summary> ops; // 按请求类型
+    std::vector<queue_stats> queues;
+
+    static const char* counter_name(int c) {
+        static const char* names[METRIC_COUNTER_MAX] = {
+            "published", "delivered", "acked", "redelivered", "rejected", "publish_unrouted", "gc_runs", "frames_sent", "socket_writes"
+        };
+        return names[c];
+    }
+    static const char* histogram_name(int h) {
+        static const char* names[METRIC_HISTOGRAM_MAX] = { "route_latency_us", "disk_write_latency_us", "gc_pause_us" };
+        return names[h];
+    }
+    std::string to_prometheus() const {
+        // Prometheus 文本格式(0.0.4)，直方图按 summary 输出分位数
+        std::string out;
+        for (int c = 0; c < METRIC_COUNTER_MAX; ++c) {
+            std::string name = std::string("hare_") + counter_name(c) + "_total";
+            out += "# TYPE " + name + " counter\n";
+            out += name + " " + std::to_string(counters[c]) + "\n";
+        }
+        for (int h = 0; h < METRIC_HISTOGRAM_MAX; ++h) {
+            std::string name = std::string("hare_") + histogram_name(h);
+            const histogram_summary& s = histograms[h];
+            out += "# TYPE " + name + " summary\n";
+            out += name + "{quantile=\"0.5\"} " + std::to_string(s.p50) + "\n";
+            out += name + "{quantile=\"0.9\"} " + std::to_string(s.p90) + "\n";
+            out += name + "{quantile=\"0.99\"} " + std::to_string(s.p99) + "\n";
+            out += name + "{quantile=\"0.999\"} " + std::to_string(s.p999) + "\n";
+            out += name + "_sum " + std::to_string(s.sum) + "\n";
+            out += name + "_count " + std::to_string(s.count) + "\n";
+        }
+        out += "# TYPE hare_request_latency_us summary\n";
+        for (const auto& op : ops) {
+            std::string label = "op=\"" + escape_label(op.name) + "\"";
+            const histogram_summary& s = op.latency;
+            out += "hare_request_latency_us{" + label + ",quantile=\"0.5\"} " + std::to_string(s.p50) + "\n";
+            out += "hare_request_latency_us{" + label + ",quantile=\"0.9\"} " + std::to_string(s.p90) + "\n";
+            out += "hare_request_latency_us{" + label + ",quantile=\"0.99\"} " + std::to_string(s.p99) + "\n";
+            out += "hare_request_latency_us{" + label + ",quantile=\"0.999\"} " + std::to_string(s.p999) + "\n";
+            out += "hare_request_latency_us_sum{" + label + "} " + std::to_string(s.sum) + "\n";
+            out += "hare_request_latency_us_count{" + label + "} " + std::to_string(s.count) + "\n";
+        }
+        queue_family(out, "hare_queue_depth", "gauge", &queue_stats::depth);
+        queue_family(out, "hare_queue_unacked", "gauge", &queue_stats::unacked);
+        queue_family(out, "hare_queue_disk_bytes", "gauge", &queue_stats::disk_bytes);
+        queue_family(out, "hare_queue_published_total", "counter", &queue_stats::published);
+        queue_family(out, "hare_queue_delivered_total", "counter", &queue_stats::delivered);
+        queue_family(out, "hare_queue_acked_total", "counter", &queue_stats::acked);
+        queue_family(out, "hare_queue_redelivered_total", "counter", &queue_stats::redelivered);
+        return out;
+    }
+
+private:
+    void queue_family(std::string& out, const std::string& name, const char* type, uint64_t queue_stats::*field) const {
+        out += "# TYPE " + name + " " + type + "\n";
+        for (const auto& q : queues)
+            out += name + "{queue=\"" + escape_label(q.name) + "\"} " + std::to_string(q.*field) + "\n";
+    }
+    static std::string escape_label(const std::string& s) {
+        std::string r;
+        for (char c : s) {
+            if (c == '\\' || c == '"')
+                r.push_back('\\');
+            if (c == '\n') {
+                r += "\\n";
+                continue;
+            }
+            r.push_back(c);
+        }
+        return r;
+    }
+};
+
+class metrics_registry {
+private:
+    struct shard {
+        std::atomic<uint64_t> counters[METRIC_COUNTER_MAX];
+        histogram histograms[METRIC_HISTOGRAM_MAX];
+        shard() {
+            for (auto& c : counters)
+                c.store(0, std::memory_order_relaxed);
+        }
+    };
+    std::mutex __mtx; // 只保护分片列表和请求类型列表
+    std::vector<std::shared_ptr<shard>> __shards;
+    std::vector<std::shared_ptr<op_metrics>> __ops;
+
+public:
+    static metrics_registry& instance() {
+        static metrics_registry registry;
+        return registry;
+    } // 全局唯一，和日志一样，任何模块都可以直接记录
+    void add(metric_counter c, uint64_t n = 1) {
+        std::atomic<uint64_t>& v = local().counters[c];
+        v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed); // 只有本线程写，不需要原子加
+    }
+    void observe(metric_histogram h, uint64_t v) {
+        local().histograms[h].record(v);
+    }
+    op_metrics* register_op(const std::string& name) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        for (const auto& op : __ops)
+            if (op->name == name)
+                return op.get();
+        __ops.push_back(std::make_shared<op_metrics>(name));
+        return __ops.back().get();
+    } // 同名的请求类型共用一个，返回的指针一直有效
+    metrics_snapshot snapshot() {
+        metrics_snapshot snap;
+        std::vector<std::shared_ptr<shard>> shards;
+        std::vector<std::shared_ptr<op_metrics>> ops;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            shards = __shards;
+            ops = __ops;
+        }
+        histogram merged[METRIC_HISTOGRAM_MAX];
+        for (const auto& s : shards) {
+            for (int c = 0; c < METRIC_COUNTER_MAX; ++c)
+                snap.counters[c] += s->counters[c].load(std::memory_order_relaxed);
+            for (int h = 0; h < METRIC_HISTOGRAM_MAX; ++h)
+                merged[h].merge(s->histograms[h]);
+        }
+        for (int h = 0; h < METRIC_HISTOGRAM_MAX; ++h)
+            snap.histograms[h].summarize(merged[h]);
+        for (const auto& op : ops) {
+            op_summary s;
+            s.name = op->name;
+            s.latency.summarize(op->latency);
+            snap.ops.push_back(s);
+        }
+        return snap;
+    } // 汇总所有线程的分片(不含队列维度的数据)
+
+private:
+    metrics_registry() = default;
+    shard& local() {
+        thread_local shard* s = register_shard();
+        return *s;
+    }
+    shard* register_shard() {
+        std::shared_ptr<shard> s = std::make_shared<shard>();
+        std::unique_lock<std::mutex> lock(__mtx);
+        __shards.push_back(s);
+        return s.get();
+    }
+};
+
+// 作用域计时: 析构时把经过的时间(微秒)记到直方图里
+class metrics_timer {
+private:
+    metric_histogram __h;
+    std::chrono::steady_clock::time_point __start;
+
+public:
+    metrics_timer(metric_histogram h)
+        : __h(h)
+        , __start(std::chrono::steady_clock::now()) { }
+    ~metrics_timer() {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - __start).count();
+        metrics_registry::instance().observe(__h, us);
+    }
+};
+} // namespace hare_mq
+
+#endif
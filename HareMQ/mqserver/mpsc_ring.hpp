@@ -0,0 +1,100 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_MPSC_RING__
+#define __YUFC_MPSC_RING__
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <thread>
+
+namespace hare_mq {
+#define RING_CACHE_LINE 64 // 读写位置之间的填充，避免生产者和消费者在同一个缓存行上互相干扰
+// 有界的无锁环形队列: 多个生产者，一个消费者
+// 1. 每个槽位带一个序号，生产者用 CAS 抢占位置，写完数据之后再发布序号
+// 2. 消费者只有一个(或者由外部的锁保证同一时刻只有一个)，不需要原子的读写位置
+// 3. 满了 push 返回 false，由调用方走有锁的路径
+// 4. pop 遇到已经被抢占但还没有发布的槽位就当作空的返回，不等待生产者(消费者通常持有外部的锁)
+template <typename T>
+class mpsc_ring {
+private:
+    struct cell {
+        std::atomic<size_t> seq;
+        T data;
+    };
+    std::unique_ptr<cell[]> __cells;
+    size_t __mask;
+    // 用显式填充隔开，不用 alignas: C++11 的 new 不保证超过 alignof(max_align_t) 的对齐
+    char __pad0[RING_CACHE_LINE];
+    std::atomic<size_t> __tail; // 生产者的写位置
+    char __pad1[RING_CACHE_LINE - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> __head; // 消费者的读位置(只有消费者写，原子只是为了 size() 可以在其他线程读)
+    char __pad2[RING_CACHE_LINE - sizeof(std::atomic<size_t>)];
+
+public:
+    explicit mpsc_ring(size_t capacity)
+        : __tail(0)
+        , __head(0) {
+        size_t n = 1;
+        while (n < capacity)
+            n <<= 1; // 容量取 2 的幂，下标用掩码计算
+        __cells.reset(new cell[n]);
+        __mask = n - 1;
+        for (size_t i = 0; i < n; ++i)
+            __cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+    bool push(const T& v) {
+        cell* c = nullptr;
+        size_t pos = __tail.load(std::memory_order_relaxed);
+        while (true) {
+            c = &__cells[pos & __mask];
+            size_t seq = c->seq.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+            if (dif == 0) {
+                if (__tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (dif < 0) {
+                return false; // 满了
+            } else {
+                pos = __tail.load(std::memory_order_relaxed); // 被其他生产者抢先了
+            }
+        }
+        c->data = v;
+        c->seq.store(pos + 1, std::memory_order_release); // 发布
+        return true;
+    }
+    bool pop(T& v) {
+        size_t head = __head.load(std::memory_order_relaxed);
+        if (head == __tail.load(std::memory_order_acquire))
+            return false; // 空的
+        cell& c = __cells[head & __mask];
+        if (c.seq.load(std::memory_order_acquire) != head + 1)
+            return false; // 位置已经被生产者抢占了，但数据还没写完，这一次先停在这里，下一次再取
+        v = std::move(c.data);
+        c.data = T();
+        c.seq.store(head + __mask + 1, std::memory_order_release); // 槽位留给下一圈的生产者
+        __head.store(head + 1, std::memory_order_relaxed);
+        return true;
+    } // 空的或者队首还没有发布时返回 false
+    void wait_published() const {
+        size_t tail = __tail.load(std::memory_order_acquire);
+        for (size_t pos = __head.load(std::memory_order_relaxed); pos < tail; ++pos) {
+            const cell& c = __cells[pos & __mask];
+            while ((intptr_t)c.seq.load(std::memory_order_acquire) - (intptr_t)(pos + 1) < 0)
+                std::this_thread::yield(); // 只有几条指令的窗口
+        }
+    } // 等到调用之前已经被抢占的槽位全部发布(或者已经被取走)，调用方不能持有消费者的锁
+    size_t size() const {
+        size_t tail = __tail.load(std::memory_order_acquire);
+        size_t head = __head.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    } // 近似值
+    size_t capacity() const { return __mask + 1; }
+};
+} // namespace hare_mq
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_OUTBOUND__
+#define __YUFC_OUTBOUND__
+
+#include "metrics.hpp"
+#include "muduo/net/Buffer.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpConnection.h"
+#include "muduo/protoc/codec.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <zlib.h>
+
+namespace hare_mq {
+#define OUTBOUND_FLUSH_BYTES (64 * 1024) // 待发送的数据超过这个大小，IO 线程里立即写出，不等到本轮事件循环结束
+/**
+ * 一条连接的发送缓冲(写合并)和推送任务队列
+ * 1. 响应和推送都直接编码追加到缓冲里，连接所属的 IO 线程每轮事件循环只写一次(queueInLoop 的回调在本轮事件处理完之后执行)
+ * 2. 其他线程追加帧或者投递推送任务时，只有从空变成非空的那一次需要唤醒 IO 线程，之后的都跟着同一批处理
+ * 3. 推送任务(post)在 IO 线程中一批执行完，这一批编码出来的帧一次写出
+ * 4. 连接上的所有信道共用一个 frame_writer，帧的先后顺序和调用 send 的顺序一致
+ */
+class frame_writer : public std::enable_shared_from_this<frame_writer> {
+public:
+    using ptr = std::shared_ptr<frame_writer>;
+    using task = std::function<void()>;
+
+private:
+    muduo::net::TcpConnectionPtr __conn;
+    std::mutex __mtx;
+    muduo::net::Buffer __pending; // 已经编码、还没有写到连接上的帧
+    size_t __frames = 0; // __pending 中的帧数
+    std::vector<task> __tasks; // 等待在 IO 线程中执行的推送任务
+    bool __scheduled = false; // 已经向 IO 线程投递了 drain，还没有执行完 //
+public:
+    explicit frame_writer(const muduo::net::TcpConnectionPtr& conn)
+        : __conn(conn) { }
+    static void encode(muduo::net::Buffer* buf, const google::protobuf::Message& message) {
+        // 和 ProtobufCodec::fillEmptyBuffer 相同的帧格式: len | nameLen | typeName\0 | protobuf | adler32(nameLen..protobuf)
+        // fillEmptyBuffer 要求缓冲是空的，这里先算出长度，直接追加在 buf 的末尾，不需要临时缓冲
+        const std::string type_name = message.GetTypeName();
+        int32_t name_len = static_cast<int32_t>(type_name.size() + 1);
+        size_t byte_size = message.ByteSizeLong();
+        int32_t len = static_cast<int32_t>(sizeof(int32_t) + name_len + byte_size + sizeof(int32_t));
+        buf->ensureWritableBytes(sizeof(int32_t) + len); // 之后的追加不会再移动数据
+        buf->appendInt32(len);
+        const char* checked = buf->beginWrite();
+        buf->appendInt32(name_len);
+        buf->append(type_name.c_str(), name_len);
+        message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(buf->beginWrite()));
+        buf->hasWritten(byte_size);
+        buf->appendInt32(static_cast<int32_t>(::adler32(1, reinterpret_cast<const Bytef*>(checked), static_cast<uInt>(buf->beginWrite() - checked))));
+    } // 编码一帧追加到 buf
+    void send(const google::protobuf::Message& message) {
+        bool schedule = false;
+        bool flush_now = false;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            encode(&__pending, message); // 直接编码进发送缓冲，只做一次序列化，不经过临时缓冲
+            ++__frames;
+            if (!__scheduled)
+                __scheduled = schedule = true;
+            flush_now = __pending.readableBytes() >= OUTBOUND_FLUSH_BYTES;
+        }
+        muduo::net::EventLoop* loop = __conn->getLoop();
+        if (schedule)
+            loop->queueInLoop(std::bind(&frame_writer::drain, shared_from_this()));
+        if (flush_now && loop->isInLoopThread())
+            flush();
+    } // 任意线程都可以调用
+    void post(const task& t) {
+        bool schedule = false;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            __tasks.push_back(t);
+            if (!__scheduled)
+                __scheduled = schedule = true;
+        }
+        if (schedule)
+            __conn->getLoop()->queueInLoop(std::bind(&frame_writer::drain, shared_from_this()));
+    } // 任意线程都可以调用，任务在连接所属的 IO 线程中执行
+
+private:
+    void drain() {
+        std::vector<task> tasks;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            tasks.swap(__tasks);
+        }
+        for (const auto& t : tasks)
+            t(); // 推送在这里编码进 __pending，执行期间 __scheduled 还是 true，不会重复唤醒
+        bool again = false;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            again = !__tasks.empty(); // 执行期间其他线程投递的任务
+            __scheduled = again;
+        }
+        flush();
+        if (again)
+            __conn->getLoop()->queueInLoop(std::bind(&frame_writer::drain, shared_from_this()));
+    } // IO 线程: 执行这一批推送任务，然后一次写出所有的帧
+    void flush() {
+        muduo::net::Buffer out;
+        size_t frames = 0;
+        {
+            std::unique_lock<std::mutex> lock(__mtx);
+            out.swap(__pending);
+            frames = __frames;
+            __frames = 0;
+        }
+        if (frames == 0 || !__conn->connected())
+            return; // 连接已经断开，没有写出的帧直接丢掉(和 TcpConnection::send 的行为一致)
+        __conn->send(&out); // IO 线程中直接写 socket，写不完的部分进入连接的输出缓冲
+        metrics_registry& reg = metrics_registry::instance();
+        reg.add(METRIC_FRAMES_SENT, frames);
+        reg.add(METRIC_SOCKET_WRITES);
+    } // 只在连接所属的 IO 线程中调用
+};
+} // namespace hare_mq
+
+#endif
@@ -10,8 +10,16 @@
 #include "../mqcommon/helper.hpp"
 #include "../mqcommon/logger.hpp"
 #include "../mqcommon/msg.pb.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 
 namespace hare_mq {
+#define HASH_RING_VNODES 100 // 一致性哈希交换机: 权重为 1 的队列在环上的虚拟节点数
+#define HASH_RING_MAX_WEIGHT 1000 // 绑定权重的上限，避免一个队列占用过多的虚拟节点
+#define HASH_HEADER_ARG "x-hash-header" // 一致性哈希交换机参数: 按这个头部的值哈希，不设置则按 routing_key 哈希
+#define HEADERS_MATCH_ARG "x-match" // 头部交换机的绑定参数: all(默认)/any
 class router {
 public:
     static bool is_legal_routing_key(const std::string& routing_key) {
@@ -49,6 +57,8 @@ public:
             return routing_key == binding_key;
         } else if (type == ExchangeType::FANOUT) {
             return true;
+        } else if (type == ExchangeType::CONSISTENT_HASH || type == ExchangeType::HEADERS) {
+            return false; // 这两种交换机不按 routing_key 匹配，由 hash_ring/headers_index 决定
         } else {
             // dp 模式匹配
             return __dp_matching(routing_key, binding_key);
@@ -85,7 +95,206 @@ private:
         }
         return dp[n_bkey][n_rkey];
     }
+
+public:
+    static uint32_t hash_weight(const std::string& binding_key) {
+        // 一致性哈希交换机的 binding_key 是队列的权重(正整数)，不合法的按 1 处理
+        uint32_t weight = 0;
+        for (const auto& ch : binding_key) {
+            if (ch < '0' || ch > '9')
+                return 1;
+            weight = weight * 10 + (ch - '0');
+            if (weight > HASH_RING_MAX_WEIGHT)
+                weight = HASH_RING_MAX_WEIGHT;
+        }
+        return weight == 0 ? 1 : weight;
+    }
+    static uint64_t hash(const std::string& key) {
+        // FNV-1a 再做一次 murmur3 的 fmix64 打散，结果和平台、进程无关，重启之后同一个 key 仍然落在同一个队列
+        uint64_t h = 14695981039346656037ULL;
+        for (const auto& ch : key) {
+            h ^= (unsigned char)ch;
+            h *= 1099511628211ULL;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+};
+
+// 一致性哈希环: 每个队列按权重在环上放若干个虚拟节点，routing_key 顺时针找到的第一个节点就是目标队列
+// 增删队列只会影响这个队列相邻区间上的 key，其他 key 的去向不变
+class hash_ring {
+public:
+    using ptr = std::shared_ptr<hash_ring>;
+private:
+    std::map<uint64_t, std::string> __ring; // 虚拟节点 -> 队列名
+    std::unordered_map<std::string, uint32_t> __weights; // 队列名 -> 权重
+public:
+    void add(const std::string& qname, uint32_t weight) {
+        remove(qname); // 重复添加视为修改权重
+        __weights[qname] = weight;
+        for (uint32_t i = 0; i < weight * HASH_RING_VNODES; ++i)
+            __ring.insert({ router::hash(qname + "#" + std::to_string(i)), qname }); // 极少数冲突的节点归先加入的队列
+    }
+    void remove(const std::string& qname) {
+        if (__weights.erase(qname) == 0)
+            return;
+        for (auto it = __ring.begin(); it != __ring.end();) {
+            if (it->second == qname)
+                it = __ring.erase(it);
+            else
+                ++it;
+        }
+    }
+    void bind(const std::string& qname, const std::string& binding_key) {
+        add(qname, router::hash_weight(binding_key));
+    } // 一致性哈希交换机的 binding_key 是权重
+    bool contains(const std::string& qname) const { return __weights.count(qname) > 0; }
+    bool empty() const { return __ring.empty(); }
+    size_t size() const { return __weights.size(); }
+    std::string select(const std::string& key) const {
+        if (__ring.empty())
+            return std::string();
+        auto it = __ring.lower_bound(router::hash(key)); // O(log n)
+        if (it == __ring.end())
+            it = __ring.begin(); // 环: 超过最后一个节点就回到第一个
+        return it->second;
+    }
+};
+
+// 一个交换机的头部匹配索引: (header, value) -> 绑定的队列
+// 消息只需要按自己的每个头部查一次倒排表，统计每个队列命中的条件数，不需要逐个检查绑定
+class headers_index {
+public:
+    using ptr = std::shared_ptr<headers_index>;
+private:
+    struct rule {
+        bool match_all = true; // x-match=all: 所有条件都满足; x-match=any: 满足一个即可
+        std::vector<std::pair<std::string, std::string>> conditions;
+    };
+    std::unordered_map<std::string, rule> __rules; // 队列名 -> 绑定条件
+    std::unordered_map<std::string, std::unordered_map<std::string, std::vector<std::string>>> __index; // header -> value -> 队列名
+    std::vector<std::string> __match_everything; // x-match=all 并且没有任何条件的绑定
+public:
+    void bind(const std::string& qname, const std::string& binding_key) {
+        // binding_key 的格式和交换机参数相同: x-match=any&region=eu&tenant=t1，x- 开头的是控制参数，不参与匹配
+        remove(qname);
+        rule r;
+        std::vector<std::string> sub;
+        string_helper::split(binding_key, "&", &sub);
+        for (const auto& e : sub) {
+            size_t pos = e.find('=');
+            std::string key = e.substr(0, pos);
+            std::string val = pos == std::string::npos ? std::string() : e.substr(pos + 1);
+            if (key == HEADERS_MATCH_ARG)
+                r.match_all = (val != "any");
+            else if (key.compare(0, 2, "x-") != 0)
+                r.conditions.push_back({ key, val });
+        }
+        for (const auto& c : r.conditions)
+            __index[c.first][c.second].push_back(qname);
+        if (r.match_all && r.conditions.empty())
+            __match_everything.push_back(qname);
+        __rules.insert({ qname, std::move(r) });
+    }
+    void remove(const std::string& qname) {
+        auto it = __rules.find(qname);
+        if (it == __rules.end())
+            return;
+        for (const auto& c : it->second.conditions) {
+            auto hit = __index.find(c.first);
+            auto vit = hit->second.find(c.second);
+            std::vector<std::string>& qnames = vit->second;
+            qnames.erase(std::find(qnames.begin(), qnames.end(), qname));
+            if (qnames.empty())
+                hit->second.erase(vit);
+            if (hit->second.empty())
+                __index.erase(hit);
+        }
+        auto eit = std::find(__match_everything.begin(), __match_everything.end(), qname);
+        if (eit != __match_everything.end())
+            __match_everything.erase(eit);
+        __rules.erase(it);
+    }
+    bool empty() const { return __rules.empty(); }
+    size_t size() const { return __rules.size(); }
+    std::vector<std::string> select(const google::protobuf::Map<std::string, std::string>& headers) const {
+        std::vector<std::string> qnames = __match_everything;
+        std::unordered_map<std::string, size_t> hits; // 队列名 -> 命中的条件数
+        for (const auto& h : headers) {
+            auto hit = __index.find(h.first);
+            if (hit == __index.end())
+                continue;
+            auto vit = hit->second.find(h.second);
+            if (vit == hit->second.end())
+                continue;
+            for (const auto& qname : vit->second)
+                ++hits[qname];
+        }
+        for (const auto& e : hits) {
+            const rule& r = __rules.find(e.first)->second;
+            if (!r.match_all || e.second == r.conditions.size())
+                qnames.push_back(e.first);
+        }
+        return qnames;
+    }
+};
+
+// 按交换机管理预先计算好的路由索引(一致性哈希环、头部倒排索引)，绑定关系变化时更新，发布消息时只做一次查找
+template <typename T>
+class route_index_manager {
+public:
+    using ptr = std::shared_ptr<route_index_manager<T>>;
+private:
+    std::mutex __mtx;
+    std::unordered_map<std::string, T> __indexes; // 交换机名 -> 索引
+public:
+    void bind(const std::string& ename, const std::string& qname, const std::string& binding_key) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        __indexes[ename].bind(qname, binding_key);
+    }
+    void unbind(const std::string& ename, const std::string& qname) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        auto it = __indexes.find(ename);
+        if (it == __indexes.end())
+            return;
+        it->second.remove(qname);
+        if (it->second.empty())
+            __indexes.erase(it);
+    }
+    void remove_exchange(const std::string& ename) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        __indexes.erase(ename);
+    }
+    void clear() {
+        std::unique_lock<std::mutex> lock(__mtx);
+        __indexes.clear();
+    }
+    void remove_queue(const std::string& qname) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        for (auto it = __indexes.begin(); it != __indexes.end();) {
+            it->second.remove(qname);
+            if (it->second.empty())
+                it = __indexes.erase(it);
+            else
+                ++it;
+        }
+    }
+    template <typename K>
+    auto select(const std::string& ename, const K& key) -> decltype(std::declval<const T&>().select(key)) {
+        std::unique_lock<std::mutex> lock(__mtx);
+        auto it = __indexes.find(ename);
+        if (it == __indexes.end())
+            return decltype(std::declval<const T&>().select(key))();
+        return it->second.select(key);
+    } // 交换机没有绑定任何队列时返回空值
 };
+using hash_ring_manager = route_index_manager<hash_ring>;
+using headers_index_manager = route_index_manager<headers_index>;
 } // namespace hare_mq
 
 #endif
\ No newline at end of file
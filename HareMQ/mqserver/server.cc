@@ -7,7 +7,7 @@
 #include "broker_server.hpp"
 
 int main() {
-    hare_mq::BrokerServer svr(8085, "./data");
+    hare_mq::BrokerServer svr(8085, "./data", 9085); // 9085: 本机的 Prometheus 抓取端点
     svr.start();
     return 0;
 }
\ No newline at end of file
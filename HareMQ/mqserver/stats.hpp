@@ -0,0 +1,140 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#ifndef __YUFC_STATS__
+#define __YUFC_STATS__
+
+#include "../mqcommon/protocol.pb.h"
+#include "binding.hpp"
+#include "consumer.hpp"
+#include "exchange.hpp"
+#include "message.hpp"
+#include "queue.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hare_mq {
+// 结构化的状态查询(statsRequest)
+// 1. 交换机、队列、绑定只在声明/删除/绑定/解绑时变化，查询读取按版本缓存的拓扑快照，拓扑没变就直接复用，不会每次都拷贝全部绑定
+// 2. 队列深度、待确认数、累计计数直接读 queue_message 中的原子变量，不加队列锁，和推送路径互不阻塞
+// 3. 每个部分都按名称排序，名称前缀过滤是一段连续的区间，二分查找之后按 offset/limit 截取
+struct topology_snapshot {
+    using ptr = std::shared_ptr<const topology_snapshot>;
+    struct exchange_entry {
+        exchange::ptr ep;
+        std::vector<binding::ptr> bindings; // 按队列名称排序
+    };
+    struct queue_entry {
+        msg_queue::ptr mqp;
+        queue_message::ptr qmp; // 读取实时的深度和计数
+    };
+    uint64_t version = 0;
+    std::vector<exchange_entry> exchanges; // 按名称排序
+    std::vector<queue_entry> queues; // 按名称排序
+};
+
+class stats_query {
+public:
+    static void fill(const statsRequest& req, const topology_snapshot& topo, const consumer_snapshot& consumers, statsResponse* resp) {
+        resp->set_version(topo.version + consumers.version); // 两个版本都只增不减，和也只在有变化时改变
+        if (wants(req, STATS_EXCHANGES))
+            fill_exchanges(req, topo, resp);
+        if (wants(req, STATS_QUEUES))
+            fill_queues(req, topo, consumers, resp);
+        if (wants(req, STATS_CONSUMERS))
+            fill_consumers(req, consumers, resp);
+    } // 按请求的过滤和分页条件填充响应
+
+private:
+    static bool wants(const statsRequest& req, StatsSection section) {
+        return req.section() == STATS_ALL || req.section() == section;
+    }
+    static bool has_prefix(const std::string& name, const std::string& prefix) {
+        return name.compare(0, prefix.size(), prefix) == 0;
+    }
+    template <class T, class KeyFn>
+    static std::pair<size_t, size_t> page(const std::vector<T>& entries, KeyFn key, const statsRequest& req, uint64_t* total) {
+        // 返回本页在 entries 中的下标区间 [first, last)
+        const std::string& prefix = req.name_prefix();
+        auto lo = std::lower_bound(entries.begin(), entries.end(), prefix,
+            [&key](const T& e, const std::string& p) { return key(e) < p; });
+        auto hi = std::partition_point(lo, entries.end(),
+            [&key, &prefix](const T& e) { return has_prefix(key(e), prefix); });
+        *total = hi - lo;
+        size_t first = (lo - entries.begin()) + std::min<size_t>(req.offset(), *total);
+        size_t last = hi - entries.begin();
+        if (req.limit() != 0)
+            last = std::min(last, first + req.limit());
+        return std::make_pair(first, last);
+    }
+    static void fill_exchanges(const statsRequest& req, const topology_snapshot& topo, statsResponse* resp) {
+        uint64_t total = 0;
+        auto range = page(topo.exchanges, [](const topology_snapshot::exchange_entry& e) -> const std::string& { return e.ep->name; }, req, &total);
+        resp->set_total_exchanges(total);
+        for (size_t i = range.first; i < range.second; ++i) {
+            const topology_snapshot::exchange_entry& e = topo.exchanges[i];
+            exchangeStats* es = resp->add_exchanges();
+            es->set_name(e.ep->name);
+            es->set_type(e.ep->type);
+            es->set_durable(e.ep->durable);
+            es->set_auto_delete(e.ep->auto_delete);
+            es->set_binding_count(e.bindings.size());
+            if (req.include_bindings() == false)
+                continue;
+            for (const auto& b : e.bindings) {
+                bindingStats* bs = es->add_bindings();
+                bs->set_queue_name(b->msg_queue_name);
+                bs->set_binding_key(b->binding_key);
+            }
+        }
+    }
+    static void fill_queues(const statsRequest& req, const topology_snapshot& topo, const consumer_snapshot& consumers, statsResponse* resp) {
+        uint64_t total = 0;
+        auto range = page(topo.queues, [](const topology_snapshot::queue_entry& e) -> const std::string& { return e.mqp->name; }, req, &total);
+        resp->set_total_queues(total);
+        for (size_t i = range.first; i < range.second; ++i) {
+            const topology_snapshot::queue_entry& e = topo.queues[i];
+            queue_stats live = e.qmp->live_stats();
+            queueStats* qs = resp->add_queues();
+            qs->set_name(e.mqp->name);
+            qs->set_durable(e.mqp->durable);
+            qs->set_exclusive(e.mqp->exclusive);
+            qs->set_auto_delete(e.mqp->auto_delete);
+            qs->set_depth(live.depth);
+            qs->set_unacked(live.unacked);
+            qs->set_consumer_count(consumer_count(consumers, e.mqp->name));
+            qs->set_published(live.published);
+            qs->set_delivered(live.delivered);
+            qs->set_acked(live.acked);
+            qs->set_redelivered(live.redelivered);
+        }
+    }
+    static void fill_consumers(const statsRequest& req, const consumer_snapshot& consumers, statsResponse* resp) {
+        uint64_t total = 0;
+        auto range = page(consumers.consumers, [](const consumer::ptr& c) -> const std::string& { return c->qname; }, req, &total);
+        resp->set_total_consumers(total);
+        for (size_t i = range.first; i < range.second; ++i) {
+            const consumer::ptr& c = consumers.consumers[i];
+            consumerStats* cs = resp->add_consumers();
+            cs->set_tag(c->tag);
+            cs->set_queue_name(c->qname);
+            cs->set_auto_ack(c->auto_ack);
+            cs->set_unacked(c->unacked_count());
+        }
+    }
+    static size_t consumer_count(const consumer_snapshot& consumers, const std::string& qname) {
+        auto lo = std::lower_bound(consumers.consumers.begin(), consumers.consumers.end(), qname,
+            [](const consumer::ptr& c, const std::string& q) { return c->qname < q; });
+        auto hi = std::upper_bound(lo, consumers.consumers.end(), qname,
+            [](const std::string& q, const consumer::ptr& c) { return q < c->qname; });
+        return hi - lo;
+    } // 消费者快照按队列名称排序，二分查找
+};
+} // namespace hare_mq
+
+#endif
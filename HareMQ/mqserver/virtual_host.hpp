@@ -11,10 +11,17 @@
 #include "binding.hpp"
 #include "exchange.hpp"
 #include "message.hpp"
+#include "metrics.hpp"
 #include "queue.hpp"
+#include "route.hpp"
+#include "stats.hpp"
 #include <tuple>
 
 namespace hare_mq {
+#define DEAD_LETTER_EXCHANGE_ARG "x-dead-letter-exchange" // 队列参数: 死信交换机
+#define MAX_PRIORITY_ARG "x-max-priority" // 队列参数: 最大优先级(不设置则不区分优先级)
+#define INBOX_MODE_ARG "x-inbox-mode" // 队列参数: mpsc，非持久化消息经过无锁入口入队(不设置则全部加锁)
+#define DEAD_LETTER_ROUTING_KEY_ARG "x-dead-letter-routing-key" // 队列参数: 死信路由键(不设置则沿用原消息的routing_key)
 class virtual_host {
 public:
     using ptr = std::shared_ptr<virtual_host>; // ptr
@@ -24,29 +31,47 @@ private:
     msg_queue_manager::ptr __mqmp;
     binding_manager::ptr __bmp;
     message_manager::ptr __mmp; // 四个句柄
+    hash_ring_manager::ptr __hrmp; // 一致性哈希交换机的环
+    headers_index_manager::ptr __himp; // 头部交换机的倒排索引
+    std::atomic<uint64_t> __topology_version; // 拓扑的版本，声明/删除/绑定/解绑之后递增
+    std::mutex __topology_mtx; // 只有状态查询会用到
+    topology_snapshot::ptr __topology;
 public:
     virtual_host(const std::string& host_name, const std::string& basedir, const std::string& dbfile)
         : __host_name(host_name)
         , __emp(std::make_shared<exchange_manager>(dbfile))
         , __mqmp(std::make_shared<msg_queue_manager>(dbfile))
         , __bmp(std::make_shared<binding_manager>(dbfile))
-        , __mmp(std::make_shared<message_manager>(basedir)) {
+        , __mmp(std::make_shared<message_manager>(basedir))
+        , __hrmp(std::make_shared<hash_ring_manager>())
+        , __himp(std::make_shared<headers_index_manager>())
+        , __topology_version(1) {
         // 获取到所有的队列信息，通过队列名称恢复历史消息数据
         auto qm = __mqmp->all();
         for (auto& q : qm)
-            __mmp->init_queue_msg(q.first); // 恢复了历史数据
+            __mmp->init_queue_msg(q.first, max_priority(q.second->args), inbox_mode(q.second->args)); // 恢复了历史数据
+        // 根据持久化的绑定信息重建路由索引
+        for (const auto& e : __emp->select_all_exchanges()) {
+            for (const auto& b : __bmp->get_exchange_bindings(e.first))
+                index_binding(e.second, b.first, b.second->binding_key);
+        }
     }
     bool declare_exchange(const std::string& name,
         ExchangeType type,
         bool durable,
         bool auto_delete,
         std::unordered_map<std::string, std::string>& args) {
-        return __emp->declare_exchange(name, type, durable, auto_delete, args);
+        bool ret = __emp->declare_exchange(name, type, durable, auto_delete, args);
+        bump_topology();
+        return ret;
     } // 声明交换机
     void delete_exchange(const std::string& name) {
         // 删除交换机的时候，和这台交换机相关的绑定信息也要删除
         __bmp->unbind_exchange(name);
+        __hrmp->remove_exchange(name);
+        __himp->remove_exchange(name);
         __emp->delete_exchange(name);
+        bump_topology();
     } // 删除交换机
     bool declare_queue(const std::string& qname,
         bool qdurable,
@@ -55,13 +80,18 @@ public:
         const std::unordered_map<std::string, std::string>& qargs) {
         // 初始化队列的消息句柄（消息的存储管理）
         // 队列的创建
-        __mmp->init_queue_msg(qname);
-        return __mqmp->declare_queue(qname, qdurable, qexclusive, qauto_delete, qargs);
+        __mmp->init_queue_msg(qname, max_priority(qargs), inbox_mode(qargs));
+        bool ret = __mqmp->declare_queue(qname, qdurable, qexclusive, qauto_delete, qargs);
+        bump_topology();
+        return ret;
     } // 声明队列
     void delete_queue(const std::string& name) {
         __mmp->destroy_queue_msg(name);
         __bmp->unbind_queue(name);
+        __hrmp->remove_queue(name);
+        __himp->remove_queue(name);
         __mqmp->delete_queue(name);
+        bump_topology();
     } // 删除队列
     bool bind(const std::string& ename, const std::string& qname, const std::string& key) {
         exchange::ptr ep = __emp->select_exchange(ename);
@@ -74,15 +104,60 @@ public:
             LOG(ERROR) << "binding [exchange:" << ename << "] and [queue:" << qname << "] failed, queue undefined" << std::endl;
             return false;
         }
-        return __bmp->bind(ename, qname, key, (ep->durable && mqp->durable)); // 需要两个都是持久化才能设置持久化
+        if (__bmp->bind(ename, qname, key, (ep->durable && mqp->durable)) == false) // 需要两个都是持久化才能设置持久化
+            return false;
+        binding::ptr bp = __bmp->get_binding(ename, qname); // 已经存在的绑定沿用原来的 binding_key
+        if (bp != nullptr)
+            index_binding(ep, qname, bp->binding_key);
+        bump_topology();
+        return true;
     } // 绑定交换机和队列
     void unbind(const std::string& ename, const std::string& qname) {
         __bmp->unbind(ename, qname);
+        __hrmp->unbind(ename, qname);
+        __himp->unbind(ename, qname);
+        bump_topology();
         return;
     } // 解除绑定交换机和队列
     msg_queue_binding_map exchange_bindings(const std::string& ename) {
         return __bmp->get_exchange_bindings(ename); // 获取交换机的绑定信息
     } // 获取一台交换机的所有绑定信息
+    std::vector<std::string> route(const exchange::ptr& ep, const BasicProperties* bp, const msg_queue_binding_map& mqbm) {
+        std::vector<std::string> qnames;
+        std::string routing_key = bp ? bp->routing_key() : std::string();
+        if (ep->type == ExchangeType::CONSISTENT_HASH) {
+            // 一致性哈希: 在预先算好的环上查找，只投递到一个队列
+            auto hit = ep->args.find(HASH_HEADER_ARG);
+            if (hit != ep->args.end()) {
+                routing_key.clear(); // 按头部哈希，消息没有这个头部时按空串处理
+                if (bp && bp->headers().count(hit->second))
+                    routing_key = bp->headers().at(hit->second);
+            }
+            std::string qname = __hrmp->select(ep->name, routing_key);
+            if (!qname.empty())
+                qnames.push_back(qname);
+            return qnames;
+        }
+        if (ep->type == ExchangeType::HEADERS) {
+            // 头部匹配: 按消息的每个头部查倒排索引
+            if (bp == nullptr)
+                return __himp->select(ep->name, google::protobuf::Map<std::string, std::string>());
+            return __himp->select(ep->name, bp->headers());
+        }
+        for (const auto& e : mqbm) {
+            if (router::route(ep->type, routing_key, e.second->binding_key))
+                qnames.push_back(e.first);
+        }
+        return qnames;
+    } // 计算一条消息要投递到交换机的哪些队列(mqbm 是这台交换机的绑定信息)
+    std::vector<std::string> route(const exchange::ptr& ep, const BasicProperties* bp) {
+        if (ep->type == ExchangeType::CONSISTENT_HASH || ep->type == ExchangeType::HEADERS)
+            return route(ep, bp, msg_queue_binding_map()); // 走索引，不需要拷贝绑定信息
+        return route(ep, bp, exchange_bindings(ep->name));
+    } // 计算一条消息要投递到交换机的哪些队列
+    size_t getable_count(const std::string& qname) {
+        return __mmp->getable_count(qname);
+    } // 队列中待推送的消息数量
     queue_map all_queues() {
         return __mqmp->all();
     }
@@ -94,61 +169,193 @@ public:
         }
         return __mmp->insert(qname, bp, body, mqp->durable);
     } // 发布一条消息
-    message_ptr basic_consume(const std::string& qname) {
-        return __mmp->front(qname);
-    } // 消费一条消息
+    message_ptr basic_consume(const std::string& qname, uint64_t* seq = nullptr) {
+        return __mmp->front(qname, seq);
+    } // 消费一条消息，seq 返回出队序号
+    std::vector<message_ptr> basic_get(const std::string& qname, size_t max_count, size_t max_bytes, std::vector<uint64_t>* seqs = nullptr) {
+        return __mmp->front(qname, max_count, max_bytes, seqs);
+    } // 拉取一批消息
     void basic_ack(const std::string& qname, const std::string& msgid) {
         __mmp->ack(qname, msgid);
     } // 确认一条消息
+    void basic_ack(const std::string& qname, const std::vector<std::string>& msgids) {
+        __mmp->ack(qname, msgids);
+    } // 确认一批消息
+    uint64_t delivery_seq(const std::string& qname, const std::string& msgid) {
+        return __mmp->delivery_seq(qname, msgid);
+    } // 待确认消息的出队序号，找不到返回0
+    void basic_ack(const std::string& qname, const std::vector<uint64_t>& seqs) {
+        __mmp->ack(qname, seqs);
+    } // 按出队序号确认一批消息
+    std::vector<std::string> basic_reject(const std::string& qname, const std::vector<std::string>& msgids, bool requeue) {
+        /**
+         * 拒绝一批消息
+         * 返回值: 每有一条消息重新变为可推送，就返回一次它所在的队列名，上层据此添加推送任务
+         */
+        std::list<message_ptr> rejected_msgs = __mmp->reject(qname, msgids, requeue);
+        return requeue_or_dead_letter(qname, rejected_msgs, requeue);
+    } // 拒绝一批消息（重新入队或投递到死信交换机）
+    std::vector<std::string> basic_reject(const std::string& qname, const std::vector<uint64_t>& seqs, bool requeue) {
+        std::list<message_ptr> rejected_msgs = __mmp->reject(qname, seqs, requeue);
+        return requeue_or_dead_letter(qname, rejected_msgs, requeue);
+    } // 按出队序号拒绝一批消息
     std::string basic_query() {
+        // 老接口(客户端的 svrstat 命令)，新的客户端使用 statsRequest; 这里同样读取拓扑快照，不再遍历每台交换机拷贝绑定信息
         std::string yellow_bold = "\033[1;33m"; // 1 表示加粗, 33 表示前景色为黄色
         std::string reset = "\033[0m"; // 重置样式
-        std::vector<std::tuple<std::string, std::string, std::string>> all_bindings;
-        // 获取所有交换机
-        auto all_ex = __emp->select_all_exchanges();
+        topology_snapshot::ptr snap = topology();
         std::string res_str;
         res_str += yellow_bold + "------------------------ Query ------------------------\n" + reset;
         res_str += yellow_bold + "exists exchanges: " + reset + '\n';
         res_str += "    ";
-        for (const auto& e : all_ex) {
-            // 先获取这台交换机的所有绑定信息
-            msg_queue_binding_map this_ex_bindings = exchange_bindings(e.first);
-            for (const auto& q : this_ex_bindings) {
-                assert(q.second->exchange_name == e.first);
-                all_bindings.push_back(std::make_tuple(q.second->exchange_name, q.second->msg_queue_name, q.second->binding_key));
-            }
-            res_str += e.first;
+        for (const auto& e : snap->exchanges) {
+            res_str += e.ep->name;
             res_str += ", ";
         }
         res_str += '\n';
-        // 获取所有队列
-        auto all_q = all_queues();
         res_str += yellow_bold + "exists queues: \n" + reset;
         res_str += "    ";
-        for (const auto& e : all_q) {
-            res_str += e.first;
+        for (const auto& q : snap->queues) {
+            res_str += q.mqp->name;
             res_str += ", ";
         }
         res_str += '\n';
         // 整理所有binding
         res_str += yellow_bold + "exists bindings: \n" + reset;
-        for (const auto& e : all_bindings) {
-            std::string tmp_ename = std::get<0>(e);
-            std::string tmp_qname = std::get<1>(e);
-            std::string tmp_binding_key = std::get<2>(e);
-            std::string line = "    " + tmp_ename + "<-->" + tmp_qname + ", binding_key: " + tmp_binding_key + "\n";
-            res_str += line;
+        for (const auto& e : snap->exchanges) {
+            for (const auto& b : e.bindings)
+                res_str += "    " + b->exchange_name + "<-->" + b->msg_queue_name + ", binding_key: " + b->binding_key + "\n";
         }
         res_str += yellow_bold + "-------------------------------------------------------" + reset;
         return res_str;
     }
+    metrics_snapshot metrics() {
+        metrics_snapshot snap = metrics_registry::instance().snapshot();
+        snap.queues = __mmp->stats();
+        return snap;
+    } // 汇总运行指标(全局计数、延迟直方图、每个队列的状态)
+    topology_snapshot::ptr topology() {
+        // 拓扑没有变化的时候直接复用上一次的快照，变化之后第一次查询才重新生成
+        std::unique_lock<std::mutex> snapshot_lock(__topology_mtx);
+        uint64_t version = __topology_version.load(std::memory_order_acquire); // 先读版本，生成期间的修改会让下一次查询重新生成
+        if (__topology != nullptr && __topology->version == version)
+            return __topology;
+        auto snap = std::make_shared<topology_snapshot>();
+        snap->version = version;
+        binding_map bindings = __bmp->all();
+        for (const auto& e : __emp->select_all_exchanges()) {
+            topology_snapshot::exchange_entry entry;
+            entry.ep = e.second;
+            auto bit = bindings.find(e.first);
+            if (bit != bindings.end()) {
+                for (const auto& b : bit->second)
+                    entry.bindings.push_back(b.second);
+                std::sort(entry.bindings.begin(), entry.bindings.end(), [](const binding::ptr& a, const binding::ptr& b) {
+                    return a->msg_queue_name < b->msg_queue_name;
+                });
+            }
+            snap->exchanges.push_back(std::move(entry));
+        }
+        std::sort(snap->exchanges.begin(), snap->exchanges.end(), [](const topology_snapshot::exchange_entry& a, const topology_snapshot::exchange_entry& b) {
+            return a.ep->name < b.ep->name;
+        });
+        auto qmsgs = __mmp->all();
+        for (const auto& q : __mqmp->all()) {
+            auto mit = qmsgs.find(q.first);
+            if (mit == qmsgs.end())
+                continue;
+            snap->queues.push_back({ q.second, mit->second });
+        }
+        std::sort(snap->queues.begin(), snap->queues.end(), [](const topology_snapshot::queue_entry& a, const topology_snapshot::queue_entry& b) {
+            return a.mqp->name < b.mqp->name;
+        });
+        __topology = snap;
+        return __topology;
+    } // 交换机、队列、绑定的快照(状态查询使用)
     void clear() {
         __emp->clear_exchange();
         __mqmp->clear_queues();
         __bmp->clear_bindings();
         __mmp->clear();
+        __hrmp->clear();
+        __himp->clear();
+        bump_topology();
     }
 
+private:
+    void bump_topology() {
+        __topology_version.fetch_add(1, std::memory_order_release);
+    } // 拓扑修改完成之后调用
+    std::vector<std::string> requeue_or_dead_letter(const std::string& qname, std::list<message_ptr>& rejected_msgs, bool requeue) {
+        std::vector<std::string> ready_queues;
+        if (requeue) {
+            ready_queues.assign(rejected_msgs.size(), qname); // 重新入队的消息都回到了原队列
+            return ready_queues;
+        }
+        if (rejected_msgs.empty())
+            return ready_queues;
+        // 1. 找到队列配置的死信交换机，没有配置的话，被拒绝的消息直接丢弃
+        msg_queue::ptr mqp = __mqmp->select_queue(qname);
+        if (mqp == nullptr)
+            return ready_queues;
+        auto dlx_it = mqp->args.find(DEAD_LETTER_EXCHANGE_ARG);
+        if (dlx_it == mqp->args.end())
+            return ready_queues;
+        exchange::ptr ep = __emp->select_exchange(dlx_it->second);
+        if (ep == nullptr) {
+            LOG(WARNING) << "dead letter exchange: " << dlx_it->second << " undefined, drop rejected mesgs of queue: " << qname << std::endl;
+            return ready_queues;
+        }
+        auto dlk_it = mqp->args.find(DEAD_LETTER_ROUTING_KEY_ARG);
+        // 2. 整批消息只获取一次绑定信息，然后逐条路由
+        msg_queue_binding_map mqbm = exchange_bindings(ep->name);
+        for (auto& msg : rejected_msgs) {
+            if (dlk_it != mqp->args.end() && msg->payload().properties().routing_key() != dlk_it->second) {
+                if (msg.use_count() > 1) // 还被其他队列共享(上一次死信扇出)，修改之前先拷贝一份
+                    msg = std::make_shared<Message>(*msg);
+                msg->mutable_payload()->mutable_properties()->set_routing_key(dlk_it->second);
+            }
+            const BasicProperties* bp = &msg->payload().properties();
+            std::vector<msg_queue::ptr> targets;
+            for (const auto& name : route(ep, bp, mqbm)) {
+                msg_queue::ptr target = __mqmp->select_queue(name);
+                if (target != nullptr)
+                    targets.push_back(target);
+            }
+            // 3. 非持久化消息入队之后不会再被修改，所有目标队列共享同一个消息对象(包括消息体)
+            //    持久化消息在每个队列的文件中有各自的偏移量和有效标志，最后一个目标队列复用原消息对象，其余的需要拷贝
+            bool shared = msg->payload().properties().delivery_mode() != DeliveryMode::DURABLE;
+            for (size_t i = 0; i < targets.size(); ++i) {
+                message_ptr mp = (shared || i + 1 == targets.size()) ? msg : std::make_shared<Message>(*msg);
+                if (__mmp->insert(targets[i]->name, mp, targets[i]->durable))
+                    ready_queues.push_back(targets[i]->name);
+            }
+        }
+        return ready_queues;
+    } // 被拒绝的消息: 重新入队的直接返回原队列，否则投递到队列配置的死信交换机
+    static uint32_t max_priority(const std::unordered_map<std::string, std::string>& qargs) {
+        auto it = qargs.find(MAX_PRIORITY_ARG);
+        if (it == qargs.end() || it->second.empty() || it->second.size() > 3
+            || it->second.find_first_not_of("0123456789") != std::string::npos)
+            return 0;
+        return std::min<uint32_t>(std::stoul(it->second), MAX_PRIORITY_LIMIT);
+    } // 解析队列的最大优先级参数，不合法的按不区分优先级处理
+    static queue_inbox_mode inbox_mode(const std::unordered_map<std::string, std::string>& qargs) {
+        auto it = qargs.find(INBOX_MODE_ARG);
+        if (it == qargs.end())
+            return INBOX_NONE;
+        if (it->second == "mpsc")
+            return INBOX_MPSC;
+        LOG(WARNING) << "unsupported " << INBOX_MODE_ARG << ": " << it->second << ", queue uses the locked path" << std::endl;
+        return INBOX_NONE;
+    } // 解析队列的无锁入口参数
+    void index_binding(const exchange::ptr& ep, const std::string& qname, const std::string& binding_key) {
+        if (ep->type == ExchangeType::CONSISTENT_HASH)
+            __hrmp->bind(ep->name, qname, binding_key);
+        else if (ep->type == ExchangeType::HEADERS)
+            __himp->bind(ep->name, qname, binding_key);
+    } // 需要路由索引的交换机类型，绑定时更新索引
+
 public:
     // for debugs
     bool exists_exchange(const std::string& ename) { return __emp->exists(ename); }
@@ -0,0 +1,266 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+// 服务器内部模块的微基准(Google Benchmark): 路由匹配、持久化、队列、uuid、协议编解码、日志
+// make bench 会把结果写到 bench.json，两次的结果可以用 benchmark 自带的 tools/compare.py 对比
+// 只跑一部分: ./broker_bench --benchmark_filter=route
+
+#include "../mqcommon/protocol.pb.h"
+#include "../mqserver/message.hpp"
+#include "../mqserver/route.hpp"
+#include "muduo/net/Buffer.h"
+#include "muduo/protoc/codec.h"
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <streambuf>
+
+using namespace hare_mq;
+
+#define BENCH_DIR "./data-broker-bench/"
+
+// 深度为 depth 的 routing_key: k0.k1.k2...
+static std::string make_key(int depth) {
+    std::string key;
+    for (int i = 0; i < depth; ++i) {
+        if (i != 0)
+            key += ".";
+        key += "k" + std::to_string(i);
+    }
+    return key;
+}
+
+static message_ptr make_message(size_t body_size) {
+    message_ptr msg = std::make_shared<Message>();
+    msg->mutable_payload()->mutable_properties()->set_id(uuid_helper::uuid());
+    msg->mutable_payload()->mutable_properties()->set_delivery_mode(DeliveryMode::DURABLE);
+    msg->mutable_payload()->set_body(std::string(body_size, 'x'));
+    msg->mutable_payload()->set_valid("1");
+    return msg;
+}
+
+/* 路由 */
+static void BM_route_direct(benchmark::State& state) {
+    std::string routing_key = make_key(state.range(0));
+    std::string binding_key = routing_key;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(router::route(ExchangeType::DIRECT, routing_key, binding_key));
+}
+BENCHMARK(BM_route_direct)->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_route_fanout(benchmark::State& state) {
+    std::string routing_key = make_key(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(router::route(ExchangeType::FANOUT, routing_key, "#"));
+}
+BENCHMARK(BM_route_fanout)->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_route_topic_exact(benchmark::State& state) {
+    std::string routing_key = make_key(state.range(0));
+    std::string binding_key = routing_key;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(router::route(ExchangeType::TOPIC, routing_key, binding_key));
+}
+BENCHMARK(BM_route_topic_exact)->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_route_topic_wildcard(benchmark::State& state) {
+    // # 在前面，需要和 routing_key 的每个位置都尝试匹配
+    int depth = state.range(0);
+    std::string routing_key = make_key(depth);
+    std::string binding_key = "#.*.k" + std::to_string(depth - 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(router::route(ExchangeType::TOPIC, routing_key, binding_key));
+}
+BENCHMARK(BM_route_topic_wildcard)->Arg(2)->Arg(4)->Arg(16);
+
+static void BM_route_consistent_hash(benchmark::State& state) {
+    hash_ring ring;
+    for (int i = 0; i < state.range(0); ++i)
+        ring.add("queue" + std::to_string(i), 1);
+    std::string key = make_key(4);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ring.select(key));
+}
+BENCHMARK(BM_route_consistent_hash)->Arg(4)->Arg(64);
+
+static void BM_route_headers(benchmark::State& state) {
+    headers_index index;
+    for (int i = 0; i < state.range(0); ++i)
+        index.bind("queue" + std::to_string(i), "x-match=all&region=r" + std::to_string(i % 8) + "&tenant=t" + std::to_string(i));
+    google::protobuf::Map<std::string, std::string> headers;
+    headers["region"] = "r1";
+    headers["tenant"] = "t1";
+    headers["trace"] = "abc";
+    for (auto _ : state)
+        benchmark::DoNotOptimize(index.select(headers));
+}
+BENCHMARK(BM_route_headers)->Arg(4)->Arg(64);
+
+/* 持久化 */
+static void BM_mapper_insert(benchmark::State& state) {
+    message_mapper mapper(BENCH_DIR, "bench_mapper_insert");
+    message_ptr msg = make_message(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(mapper.insert(msg));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    mapper.remove_msg_file();
+}
+BENCHMARK(BM_mapper_insert)->Arg(64)->Arg(4096);
+
+static void BM_mapper_remove(benchmark::State& state) {
+    message_mapper mapper(BENCH_DIR, "bench_mapper_remove");
+    std::vector<message_ptr> msgs;
+    size_t next = 0;
+    for (auto _ : state) {
+        if (next == msgs.size()) {
+            state.PauseTiming();
+            msgs.clear();
+            for (int i = 0; i < 1024; ++i) {
+                msgs.push_back(make_message(state.range(0)));
+                mapper.insert(msgs.back());
+            }
+            next = 0;
+            state.ResumeTiming();
+        }
+        benchmark::DoNotOptimize(mapper.remove(msgs[next++]));
+    }
+    mapper.remove_msg_file();
+}
+BENCHMARK(BM_mapper_remove)->Arg(64)->Arg(4096);
+
+static void BM_mapper_gc(benchmark::State& state) {
+    // 文件中有 range(0) 条消息，一半已经被删除
+    message_mapper mapper(BENCH_DIR, "bench_mapper_gc");
+    for (auto _ : state) {
+        state.PauseTiming();
+        mapper.remove_msg_file();
+        mapper.create_msg_file();
+        for (int i = 0; i < state.range(0); ++i) {
+            message_ptr msg = make_message(64);
+            mapper.insert(msg);
+            if (i % 2 == 0)
+                mapper.remove(msg);
+        }
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(mapper.gc());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    mapper.remove_msg_file();
+}
+BENCHMARK(BM_mapper_gc)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/* 队列 */
+static void BM_queue_insert(benchmark::State& state) {
+    // range(0): 是否持久化
+    bool durable = state.range(0) != 0;
+    std::unique_ptr<queue_message> qm(new queue_message(BENCH_DIR, "bench_queue_insert"));
+    BasicProperties bp;
+    bp.set_delivery_mode(durable ? DeliveryMode::DURABLE : DeliveryMode::UNDURABLE);
+    std::string body(64, 'x');
+    size_t count = 0;
+    for (auto _ : state) {
+        bp.set_id(std::to_string(count));
+        benchmark::DoNotOptimize(qm->insert(&bp, body, durable));
+        if (++count % 4096 == 0) {
+            state.PauseTiming();
+            qm->clear(); // clear 会删除持久化文件，换一个新的队列
+            qm.reset(new queue_message(BENCH_DIR, "bench_queue_insert"));
+            state.ResumeTiming();
+        }
+    }
+    qm->clear();
+}
+BENCHMARK(BM_queue_insert)->Arg(0)->Arg(1);
+
+static void BM_queue_front_remove(benchmark::State& state) {
+    bool durable = state.range(0) != 0;
+    queue_message qm(BENCH_DIR, "bench_queue_front");
+    BasicProperties bp;
+    bp.set_delivery_mode(durable ? DeliveryMode::DURABLE : DeliveryMode::UNDURABLE);
+    std::string body(64, 'x');
+    std::vector<uint64_t> seqs(1);
+    size_t count = 0;
+    for (auto _ : state) {
+        if (qm.getable_count() == 0) {
+            state.PauseTiming();
+            for (int i = 0; i < 4096; ++i) {
+                bp.set_id(std::to_string(count++));
+                qm.insert(&bp, body, durable);
+            }
+            state.ResumeTiming();
+        }
+        benchmark::DoNotOptimize(qm.front(&seqs[0]));
+        qm.remove(seqs);
+    }
+    qm.clear();
+}
+BENCHMARK(BM_queue_front_remove)->Arg(0)->Arg(1);
+
+/* 工具 */
+static void BM_uuid(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(uuid_helper::uuid());
+}
+BENCHMARK(BM_uuid);
+
+/* 协议编解码 */
+static basicPublishRequest make_publish_request(size_t body_size) {
+    basicPublishRequest req;
+    req.set_rid(uuid_helper::uuid());
+    req.set_cid(uuid_helper::uuid());
+    req.set_exchange_name("bench_exchange");
+    req.set_body(std::string(body_size, 'x'));
+    req.mutable_properties()->set_id(uuid_helper::uuid());
+    req.mutable_properties()->set_delivery_mode(DeliveryMode::DURABLE);
+    req.mutable_properties()->set_routing_key(make_key(4));
+    return req;
+}
+
+static void BM_codec_encode(benchmark::State& state) {
+    basicPublishRequest req = make_publish_request(state.range(0));
+    muduo::net::Buffer buf;
+    for (auto _ : state) {
+        ProtobufCodec::fillEmptyBuffer(&buf, req);
+        benchmark::DoNotOptimize(buf.peek());
+        buf.retrieveAll();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_codec_encode)->Arg(64)->Arg(4096);
+
+static void BM_codec_decode(benchmark::State& state) {
+    basicPublishRequest req = make_publish_request(state.range(0));
+    muduo::net::Buffer buf;
+    ProtobufCodec::fillEmptyBuffer(&buf, req);
+    const char* data = buf.peek() + sizeof(int32_t); // 跳过长度字段，和 onMessage 中传给 parse 的一样
+    int len = buf.readableBytes() - sizeof(int32_t);
+    for (auto _ : state) {
+        ProtobufCodec::ErrorCode err = ProtobufCodec::kNoError;
+        MessagePtr msg = ProtobufCodec::parse(data, len, &err);
+        benchmark::DoNotOptimize(msg);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_codec_decode)->Arg(64)->Arg(4096);
+
+/* 日志 */
+class null_buffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+static void BM_log(benchmark::State& state) {
+    // 终端输出丢弃，只测格式化 + 写日志文件(每条 std::endl 都会刷新)
+    null_buffer nb;
+    std::streambuf* old = std::cout.rdbuf(&nb);
+    std::string id = uuid_helper::uuid();
+    for (auto _ : state)
+        LOG(INFO) << "publish message: " << id << std::endl;
+    std::cout.rdbuf(old);
+}
+BENCHMARK(BM_log);
+
+BENCHMARK_MAIN();
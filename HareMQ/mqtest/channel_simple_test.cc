@@ -11,8 +11,6 @@ int main() {
     cmp->open_channel("c1",
         std::make_shared<hare_mq::virtual_host>("host1", "./host1/message/", "./host1/host1.db"),
         std::make_shared<hare_mq::consumer_manager>(),
-        hare_mq::ProtobufCodecPtr(),
-        muduo::net::TcpConnectionPtr(),
-        thread_pool::ptr());
+        hare_mq::frame_writer::ptr());
     return 0;
 }
\ No newline at end of file
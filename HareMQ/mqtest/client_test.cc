@@ -0,0 +1,137 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#include "../mqclient/connection.hpp"
+#include <condition_variable>
+#include <gtest/gtest.h>
+
+using namespace hare_mq;
+
+// 客户端到服务器的往返测试，需要先在本机启动服务器: cd mqserver && ./server (端口 8085)
+async_worker::ptr awp = nullptr;
+connection::ptr conn = nullptr;
+
+class client_test : public testing::Environment {
+public:
+    virtual void SetUp() override {
+        awp = std::make_shared<async_worker>();
+        conn = std::make_shared<connection>("127.0.0.1", 8085, awp);
+    }
+    virtual void TearDown() override {
+        conn.reset();
+        awp.reset();
+    }
+};
+
+struct received {
+    std::vector<BasicProperties> props;
+    std::vector<std::string> bodies;
+};
+size_t get_all(const channel::ptr& ch, const std::string& qname, received* out) {
+    return ch->basic_get(qname, 10, 0, true, [out](const std::string&, const BasicProperties* bp, const std::string& body) {
+        out->props.push_back(*bp);
+        out->bodies.push_back(body);
+    });
+}
+
+TEST(client_test, publish_with_headers) {
+    // 头部交换机按客户端发布时带上的头部路由，消费者收到的属性里也有这些头部
+    channel::ptr ch = conn->openChannel();
+    ASSERT_NE(ch, nullptr);
+    std::unordered_map<std::string, std::string> empty_map;
+    ASSERT_TRUE(ch->declare_exchange("rt.headers", ExchangeType::HEADERS, false, false, empty_map));
+    ASSERT_TRUE(ch->declare_queue("rt.headers.eu", false, false, false, empty_map));
+    ASSERT_TRUE(ch->bind("rt.headers", "rt.headers.eu", "x-match=all&region=eu"));
+    BasicProperties bp;
+    (*bp.mutable_headers())["region"] = "eu";
+    (*bp.mutable_headers())["tenant"] = "t1";
+    ch->basic_publish("rt.headers", &bp, "to eu");
+    (*bp.mutable_headers())["region"] = "us";
+    ch->basic_publish("rt.headers", &bp, "to us"); // 不匹配，不会进入队列
+    received got;
+    ASSERT_EQ(get_all(ch, "rt.headers.eu", &got), 1);
+    ASSERT_EQ(got.bodies[0], "to eu");
+    ASSERT_EQ(got.props[0].headers().at("region"), "eu");
+    ASSERT_EQ(got.props[0].headers().at("tenant"), "t1");
+    ASSERT_FALSE(got.props[0].id().empty()); // 没有设置消息id时客户端生成一个
+    ch->delete_queue("rt.headers.eu");
+    ch->delete_exchange("rt.headers");
+    conn->closeChannel(ch);
+}
+
+TEST(client_test, publish_with_priority) {
+    // 设置了 x-max-priority 的队列按客户端发布时带上的优先级出队
+    channel::ptr ch = conn->openChannel();
+    ASSERT_NE(ch, nullptr);
+    std::unordered_map<std::string, std::string> empty_map;
+    std::unordered_map<std::string, std::string> priority_args = { { "x-max-priority", "10" } };
+    ASSERT_TRUE(ch->declare_exchange("rt.direct", ExchangeType::DIRECT, false, false, empty_map));
+    ASSERT_TRUE(ch->declare_queue("rt.priority", false, false, false, priority_args));
+    ASSERT_TRUE(ch->bind("rt.direct", "rt.priority", "rt.priority"));
+    BasicProperties bp;
+    bp.set_routing_key("rt.priority");
+    bp.set_priority(1);
+    ch->basic_publish("rt.direct", &bp, "low");
+    bp.set_priority(9);
+    ch->basic_publish("rt.direct", &bp, "high");
+    received got;
+    ASSERT_EQ(get_all(ch, "rt.priority", &got), 2);
+    ASSERT_EQ(got.bodies[0], "high");
+    ASSERT_EQ(got.props[0].priority(), 9);
+    ASSERT_EQ(got.bodies[1], "low");
+    ch->delete_queue("rt.priority");
+    ch->delete_exchange("rt.direct");
+    conn->closeChannel(ch);
+}
+
+TEST(client_test, fanout_to_two_consumers) {
+    // 扇出到两个队列，同一个信道上的两个消费者收到同一个消息id，两次投递都要能确认掉
+    channel::ptr ch = conn->openChannel();
+    ASSERT_NE(ch, nullptr);
+    std::unordered_map<std::string, std::string> empty_map;
+    ASSERT_TRUE(ch->declare_exchange("rt.fanout", ExchangeType::FANOUT, false, false, empty_map));
+    ASSERT_TRUE(ch->declare_queue("rt.fanout.a", false, false, false, empty_map));
+    ASSERT_TRUE(ch->declare_queue("rt.fanout.b", false, false, false, empty_map));
+    ASSERT_TRUE(ch->bind("rt.fanout", "rt.fanout.a", ""));
+    ASSERT_TRUE(ch->bind("rt.fanout", "rt.fanout.b", ""));
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::string> got;
+    auto cb = [&](const std::string& ctag, const BasicProperties* bp, const std::string&) {
+        ch->basic_ack(bp->id(), ctag); // 按消费者确认各自收到的那一次投递
+        std::unique_lock<std::mutex> lock(mtx);
+        got.push_back(ctag + ":" + bp->id());
+        cv.notify_all();
+    };
+    ASSERT_TRUE(ch->basic_consume("rt.consumer.a", "rt.fanout.a", false, cb));
+    ASSERT_TRUE(ch->basic_consume("rt.consumer.b", "rt.fanout.b", false, cb));
+    BasicProperties bp;
+    bp.set_id("rt.same-id");
+    ch->basic_publish("rt.fanout", &bp, "to both");
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&got]() { return got.size() == 2; }));
+    }
+    ch->flush_acks();
+    statsResponsePtr resp = ch->stats(STATS_QUEUES, "rt.fanout."); // 同一条连接上按顺序处理，确认一定已经生效
+    ASSERT_TRUE(resp->ok());
+    ASSERT_EQ(resp->queues_size(), 2);
+    for (const auto& q : resp->queues())
+        ASSERT_EQ(q.unacked(), 0);
+    ch->basic_cancel();
+    ch->delete_queue("rt.fanout.a");
+    ch->delete_queue("rt.fanout.b");
+    ch->delete_exchange("rt.fanout");
+    conn->closeChannel(ch);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::AddGlobalTestEnvironment(new client_test);
+    auto res = RUN_ALL_TESTS();
+    LOG(INFO) << "res: " << std::to_string(res) << std::endl;
+    return 0;
+}
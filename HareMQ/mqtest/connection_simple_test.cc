@@ -10,8 +10,6 @@ int main() {
     auto cm = std::make_shared<connection_manager>();
     cm->new_connection(std::make_shared<hare_mq::virtual_host>("host1", "./host1/message/", "./host1/host1.db"),
         std::make_shared<hare_mq::consumer_manager>(),
-        hare_mq::ProtobufCodecPtr(),
-        muduo::net::TcpConnectionPtr(),
-        thread_pool::ptr());
+        muduo::net::TcpConnectionPtr());
     return 0;
 }
\ No newline at end of file
@@ -22,7 +22,7 @@ public:
     }
 };
 
-void cb(const std::string& tag, const BasicProperties* bp, const std::string& body) {
+void cb(const std::string& tag, uint64_t, const BasicProperties*, const std::string& body) {
     std::cout << tag << " consume a mesg: " << body << std::endl;
 }
 
@@ -58,6 +58,42 @@ TEST(consumer_test, choose_test) {
     ASSERT_EQ(cp->tag, "consumer2");
 }
 
+// 测试未确认消息的跟踪
+TEST(consumer_test, unacked_test) {
+    consumer::ptr cp = cmp->choose("queue1");
+    ASSERT_NE(cp, nullptr);
+    ASSERT_EQ(cp->track(11), 1);
+    ASSERT_EQ(cp->track(12), 2);
+    ASSERT_EQ(cp->track(13), 3);
+    ASSERT_EQ(cp->track(14), 4);
+    ASSERT_EQ(cp->track(15), 5);
+    cp->untrack_seq(12);
+    std::vector<uint64_t> seqs = cp->untrack(4, false);
+    ASSERT_EQ(seqs.size(), 1);
+    ASSERT_EQ(seqs[0], 14);
+    seqs = cp->untrack(3, true); // 累积确认 <= 3 的所有消息
+    ASSERT_EQ(seqs.size(), 2);
+    ASSERT_EQ(seqs[0], 11);
+    ASSERT_EQ(seqs[1], 13);
+    ASSERT_EQ(cp->unacked_count(), 1);
+    seqs = cp->take_unacked();
+    ASSERT_EQ(seqs.size(), 1);
+    ASSERT_EQ(seqs[0], 15);
+    ASSERT_EQ(cp->unacked_count(), 0);
+    ASSERT_EQ(cp->track(16), 0); // 取消之后不能再接收推送
+}
+
+// 测试推送任务的合并: 已经有任务在排队时，新安排的消息跟着同一个任务推送
+TEST(consumer_test, pending_test) {
+    consumer cp("pending", "queue1", true, cb);
+    ASSERT_EQ(cp.add_pending(1), 0); // 需要投递任务
+    ASSERT_EQ(cp.add_pending(1), 1); // 跟着排队的任务
+    ASSERT_EQ(cp.add_pending(100), 2);
+    ASSERT_EQ(cp.take_pending(), 102);
+    ASSERT_EQ(cp.take_pending(), 0);
+    ASSERT_EQ(cp.add_pending(1), 0); // 任务开始执行之后再安排的消息，需要投递新的任务
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     testing::AddGlobalTestEnvironment(new consumer_test);
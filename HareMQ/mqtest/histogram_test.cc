@@ -0,0 +1,76 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#include "../mqcommon/histogram.hpp"
+#include "../mqcommon/logger.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace hare_mq;
+
+class histogram_test : public testing::Environment {
+public:
+    virtual void SetUp() override { }
+    virtual void TearDown() override { }
+};
+
+TEST(histogram_test, small_values_exact) {
+    histogram h;
+    for (uint64_t v = 0; v < 100; ++v)
+        h.record(v);
+    ASSERT_EQ(h.count(), 100);
+    ASSERT_EQ(h.max(), 99);
+    ASSERT_EQ(h.percentile(0.5), 50);
+    ASSERT_EQ(h.percentile(0.99), 99);
+    ASSERT_EQ(h.percentile(1.0), 99);
+}
+
+TEST(histogram_test, relative_error) {
+    histogram h;
+    for (uint64_t v = 1; v <= 1000000; ++v)
+        h.record(v);
+    uint64_t p50 = h.percentile(0.5);
+    uint64_t p99 = h.percentile(0.99);
+    ASSERT_GE(p50, 500000);
+    ASSERT_LE(p50, 500000 + 500000 / 64);
+    ASSERT_GE(p99, 990000);
+    ASSERT_LE(p99, 990000 + 990000 / 64);
+    ASSERT_EQ(h.percentile(1.0), 1000000);
+    ASSERT_EQ(h.max(), 1000000);
+    h.record(UINT64_MAX); // 最大的值也要有桶
+    ASSERT_EQ(h.max(), UINT64_MAX);
+}
+
+TEST(histogram_test, concurrent_and_merge) {
+    histogram h;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&h]() {
+            for (uint64_t v = 0; v < 10000; ++v)
+                h.record(v);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    ASSERT_EQ(h.count(), 40000);
+    histogram total;
+    total.merge(h);
+    total.merge(h);
+    ASSERT_EQ(total.count(), 80000);
+    ASSERT_EQ(total.max(), 9999);
+    h.reset();
+    ASSERT_EQ(h.count(), 0);
+    ASSERT_EQ(h.percentile(0.5), 0);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::AddGlobalTestEnvironment(new histogram_test);
+    auto res = RUN_ALL_TESTS();
+    LOG(INFO) << "res: " << res << std::endl;
+    return 0;
+}
@@ -119,6 +119,135 @@ TEST_F(host_test, ack_test) {
     ASSERT_EQ(msg1, nullptr);
 }
 
+// 验证nack/reject: 重新入队 & 死信转投
+TEST_F(host_test, reject_test) {
+    std::unordered_map<std::string, std::string> empty_map;
+    std::unordered_map<std::string, std::string> dlx_args = { { "x-dead-letter-exchange", "dlx" } };
+    __host->declare_exchange("dlx", ExchangeType::FANOUT, true, false, empty_map);
+    __host->declare_queue("dlq", true, false, false, empty_map);
+    __host->declare_queue("queue4", true, false, false, dlx_args);
+    __host->bind("dlx", "dlq", "");
+    __host->basic_publish("queue4", nullptr, "hello world-1");
+    __host->basic_publish("queue4", nullptr, "hello world-2");
+    // requeue 之后消息回到队首
+    message_ptr msg1 = __host->basic_consume("queue4");
+    ASSERT_EQ(msg1->payload().body(), "hello world-1");
+    auto ready = __host->basic_reject("queue4", { msg1->payload().properties().id() }, true);
+    ASSERT_EQ(ready.size(), 1);
+    ASSERT_EQ(ready[0], "queue4");
+    msg1 = __host->basic_consume("queue4");
+    ASSERT_EQ(msg1->payload().body(), "hello world-1");
+    // 不 requeue 则投递到死信交换机绑定的队列中
+    ready = __host->basic_reject("queue4", { msg1->payload().properties().id() }, false);
+    ASSERT_EQ(ready.size(), 1);
+    ASSERT_EQ(ready[0], "dlq");
+    message_ptr dead = __host->basic_consume("dlq");
+    ASSERT_NE(dead, nullptr);
+    ASSERT_EQ(dead->payload().body(), "hello world-1");
+    msg1 = __host->basic_consume("queue4");
+    ASSERT_EQ(msg1->payload().body(), "hello world-2");
+    // 没有配置死信交换机的队列，被拒绝的消息直接丢弃
+    message_ptr msg2 = __host->basic_consume("queue1");
+    ready = __host->basic_reject("queue1", { msg2->payload().properties().id() }, false);
+    ASSERT_EQ(ready.size(), 0);
+}
+
+// 死信扇出到多个队列: 非持久化消息共享同一个消息对象，持久化消息每个队列一份
+TEST_F(host_test, dead_letter_fanout_test) {
+    std::unordered_map<std::string, std::string> empty_map;
+    std::unordered_map<std::string, std::string> dlx_args = { { "x-dead-letter-exchange", "dlx.fanout" } };
+    __host->declare_exchange("dlx.fanout", ExchangeType::FANOUT, true, false, empty_map);
+    __host->declare_queue("dlq1", true, false, false, empty_map);
+    __host->declare_queue("dlq2", true, false, false, empty_map);
+    __host->declare_queue("queue5", true, false, false, dlx_args);
+    __host->bind("dlx.fanout", "dlq1", "");
+    __host->bind("dlx.fanout", "dlq2", "");
+    BasicProperties bp;
+    bp.set_id("dead-1");
+    bp.set_delivery_mode(DeliveryMode::UNDURABLE);
+    __host->basic_publish("queue5", &bp, "undurable");
+    bp.set_id("dead-2");
+    bp.set_delivery_mode(DeliveryMode::DURABLE);
+    __host->basic_publish("queue5", &bp, "durable");
+    message_ptr msg = __host->basic_consume("queue5");
+    ASSERT_EQ(__host->basic_reject("queue5", { msg->payload().properties().id() }, false).size(), 2);
+    message_ptr dead1 = __host->basic_consume("dlq1");
+    message_ptr dead2 = __host->basic_consume("dlq2");
+    ASSERT_EQ(dead1->payload().body(), "undurable");
+    ASSERT_EQ(dead1, dead2); // 消息体没有拷贝
+    msg = __host->basic_consume("queue5");
+    ASSERT_EQ(__host->basic_reject("queue5", { msg->payload().properties().id() }, false).size(), 2);
+    dead1 = __host->basic_consume("dlq1");
+    dead2 = __host->basic_consume("dlq2");
+    ASSERT_EQ(dead1->payload().body(), "durable");
+    ASSERT_EQ(dead2->payload().body(), "durable");
+    ASSERT_NE(dead1, dead2); // 持久化位置是每个队列各自的
+}
+
+// 验证basic_get: 按条数和字节数批量拉取
+TEST_F(host_test, get_test) {
+    auto msgs = __host->basic_get("queue1", 2, 0);
+    ASSERT_EQ(msgs.size(), 2);
+    ASSERT_EQ(msgs[0]->payload().body(), "hello world-1");
+    ASSERT_EQ(msgs[1]->payload().body(), "hello world-2");
+    // 字节数限制很小时，至少也会返回一条
+    msgs = __host->basic_get("queue2", 3, 1);
+    ASSERT_EQ(msgs.size(), 1);
+    ASSERT_EQ(msgs[0]->payload().body(), "hello world-1");
+    msgs = __host->basic_get("queue3", 10, 0);
+    ASSERT_EQ(msgs.size(), 3);
+    msgs = __host->basic_get("queue3", 10, 0);
+    ASSERT_EQ(msgs.size(), 0);
+}
+
+// 一致性哈希交换机: 每条消息只投递到一个队列，同一个 routing_key 总是同一个队列
+TEST_F(host_test, consistent_hash_test) {
+    std::unordered_map<std::string, std::string> empty_map;
+    __host->declare_exchange("exchange4", ExchangeType::CONSISTENT_HASH, true, false, empty_map);
+    ASSERT_EQ(__host->bind("exchange4", "queue1", "1"), true);
+    ASSERT_EQ(__host->bind("exchange4", "queue2", "2"), true);
+    exchange::ptr ep = __host->select_exchange("exchange4");
+    BasicProperties bp;
+    bp.set_routing_key("order.1");
+    std::vector<std::string> first = __host->route(ep, &bp);
+    ASSERT_EQ(first.size(), 1);
+    ASSERT_EQ(__host->route(ep, &bp), first);
+    // 解除绑定之后不会再路由到这个队列
+    __host->unbind("exchange4", first[0]);
+    std::vector<std::string> second = __host->route(ep, &bp);
+    ASSERT_EQ(second.size(), 1);
+    ASSERT_NE(second[0], first[0]);
+    // 删除队列之后环上也没有了
+    __host->delete_queue(second[0]);
+    ASSERT_EQ(__host->route(ep, &bp).size(), 0);
+    __host->delete_exchange("exchange4");
+}
+
+// 头部交换机: x-match=all 需要全部条件满足，x-match=any 满足一个即可
+TEST_F(host_test, headers_test) {
+    std::unordered_map<std::string, std::string> empty_map;
+    __host->declare_exchange("exchange5", ExchangeType::HEADERS, true, false, empty_map);
+    ASSERT_EQ(__host->bind("exchange5", "queue1", "x-match=all&region=eu&tenant=t1"), true);
+    ASSERT_EQ(__host->bind("exchange5", "queue2", "x-match=any&region=eu&type=order"), true);
+    exchange::ptr ep = __host->select_exchange("exchange5");
+    BasicProperties bp;
+    (*bp.mutable_headers())["region"] = "eu";
+    std::vector<std::string> qnames = __host->route(ep, &bp);
+    ASSERT_EQ(qnames.size(), 1);
+    ASSERT_EQ(qnames[0], "queue2");
+    (*bp.mutable_headers())["tenant"] = "t1";
+    qnames = __host->route(ep, &bp);
+    std::sort(qnames.begin(), qnames.end());
+    ASSERT_EQ(qnames, std::vector<std::string>({ "queue1", "queue2" }));
+    (*bp.mutable_headers())["region"] = "us";
+    ASSERT_EQ(__host->route(ep, &bp).size(), 0);
+    ASSERT_EQ(__host->route(ep, nullptr).size(), 0);
+    __host->unbind("exchange5", "queue2");
+    (*bp.mutable_headers())["type"] = "order";
+    ASSERT_EQ(__host->route(ep, &bp).size(), 0);
+    __host->delete_exchange("exchange5");
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     auto res = RUN_ALL_TESTS();
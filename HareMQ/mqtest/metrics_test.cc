@@ -0,0 +1,105 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#include "../mqserver/message.hpp"
+#include "../mqserver/metrics.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace hare_mq;
+
+class metrics_test : public testing::Environment {
+public:
+    virtual void SetUp() override { }
+    virtual void TearDown() override { }
+};
+
+TEST(metrics_test, per_thread_counters) {
+    // 全局的注册表在整个进程内共享，按差值判断
+    metrics_registry& reg = metrics_registry::instance();
+    uint64_t before = reg.snapshot().counters[METRIC_GC_RUNS];
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&reg]() {
+            for (int i = 0; i < 1000; ++i)
+                reg.add(METRIC_GC_RUNS);
+            reg.observe(METRIC_ROUTE_LATENCY, 100);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    metrics_snapshot snap = reg.snapshot();
+    ASSERT_EQ(snap.counters[METRIC_GC_RUNS] - before, 4000); // 线程退出之后计数还在
+    ASSERT_GE(snap.histograms[METRIC_ROUTE_LATENCY].count, 4);
+    ASSERT_EQ(snap.histograms[METRIC_ROUTE_LATENCY].max, 100);
+}
+
+TEST(metrics_test, queue_stats) {
+    metrics_registry& reg = metrics_registry::instance();
+    metrics_snapshot before = reg.snapshot();
+    queue_message qm("./data-metrics/", "metrics_queue");
+    BasicProperties bp;
+    bp.set_delivery_mode(DeliveryMode::DURABLE);
+    for (int i = 0; i < 10; ++i) {
+        bp.set_id("metrics-" + std::to_string(i));
+        qm.insert(&bp, "hello", true);
+    }
+    std::vector<uint64_t> seqs;
+    qm.front(5, 0, &seqs);
+    qm.remove(std::vector<uint64_t> { seqs[0], seqs[1] });
+    qm.reject(std::vector<uint64_t> { seqs[2] }, true);
+    qm.reject(std::vector<uint64_t> { seqs[3] }, false);
+    queue_stats s = qm.stats();
+    ASSERT_EQ(s.name, "metrics_queue");
+    ASSERT_EQ(s.published, 10);
+    ASSERT_EQ(s.delivered, 5);
+    ASSERT_EQ(s.acked, 2);
+    ASSERT_EQ(s.redelivered, 1);
+    ASSERT_EQ(s.depth, 6);
+    ASSERT_EQ(s.unacked, 1);
+    ASSERT_GT(s.disk_bytes, 0);
+    metrics_snapshot after = reg.snapshot();
+    ASSERT_EQ(after.counters[METRIC_PUBLISHED] - before.counters[METRIC_PUBLISHED], 10);
+    ASSERT_EQ(after.counters[METRIC_REJECTED] - before.counters[METRIC_REJECTED], 1);
+    ASSERT_GE(after.histograms[METRIC_DISK_WRITE_LATENCY].count - before.histograms[METRIC_DISK_WRITE_LATENCY].count, 13);
+    after.queues.push_back(s);
+    std::string text = after.to_prometheus();
+    ASSERT_NE(text.find("# TYPE hare_published_total counter\n"), std::string::npos);
+    ASSERT_NE(text.find("hare_queue_depth{queue=\"metrics_queue\"} 6\n"), std::string::npos);
+    ASSERT_NE(text.find("hare_disk_write_latency_us{quantile=\"0.99\"}"), std::string::npos);
+    qm.clear();
+}
+
+TEST(metrics_test, per_op_latency) {
+    // 分发表注册请求类型时调用 register_op，同名只创建一次
+    metrics_registry& reg = metrics_registry::instance();
+    op_metrics* op = reg.register_op("basicPublishRequest");
+    ASSERT_EQ(op, reg.register_op("basicPublishRequest"));
+    ASSERT_NE(op, reg.register_op("basicAckRequest"));
+    op->latency.record(20);
+    op->latency.record(40);
+    metrics_snapshot snap = reg.snapshot();
+    bool found = false;
+    for (const auto& s : snap.ops) {
+        if (s.name != "basicPublishRequest")
+            continue;
+        found = true;
+        ASSERT_EQ(s.latency.count, 2);
+        ASSERT_EQ(s.latency.max, 40);
+    }
+    ASSERT_TRUE(found);
+    std::string text = snap.to_prometheus();
+    ASSERT_NE(text.find("hare_request_latency_us_count{op=\"basicPublishRequest\"} 2\n"), std::string::npos);
+    ASSERT_NE(text.find("hare_request_latency_us{op=\"basicAckRequest\",quantile=\"0.5\"}"), std::string::npos);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::AddGlobalTestEnvironment(new metrics_test);
+    auto res = RUN_ALL_TESTS();
+    LOG(INFO) << "res: " << res << std::endl;
+    return 0;
+}
@@ -106,6 +106,44 @@ TEST(msg_test, delete_ack_test) {
     ASSERT_EQ(mmp->total_count("queue1"), 4); // 还是4，因为还没垃圾回收
     ASSERT_EQ(mmp->wait_ack_count("queue1"), 0);
 }
+// 优先级测试：高优先级先推送，同一优先级先进先出，重启恢复之后顺序不变
+TEST(msg_test, priority_test) {
+    mmp->init_queue_msg("queue_priority", 5);
+    int priorities[] = { 0, 3, 9, 3, 1 }; // 9 超过最大优先级，按 5 处理
+    for (int i = 0; i < 5; ++i) {
+        BasicProperties properties;
+        properties.set_id(uuid_helper::uuid());
+        properties.set_delivery_mode(DeliveryMode::DURABLE);
+        properties.set_priority(priorities[i]);
+        mmp->insert("queue_priority", &properties, "msg-" + std::to_string(i), true);
+    }
+    std::vector<std::string> expected = { "msg-2", "msg-1", "msg-3", "msg-4", "msg-0" };
+    // 模拟重启: 用新的 message_manager 从文件恢复
+    message_manager::ptr recovered = std::make_shared<message_manager>("./data-mesg");
+    recovered->init_queue_msg("queue_priority", 5);
+    for (const auto& body : expected) {
+        ASSERT_EQ(mmp->front("queue_priority")->payload().body(), body);
+        ASSERT_EQ(recovered->front("queue_priority")->payload().body(), body);
+    }
+    ASSERT_EQ(mmp->front("queue_priority"), nullptr);
+    mmp->destroy_queue_msg("queue_priority");
+}
+// 无锁入口测试：非持久化消息经过入口，持久化消息加锁，同一个生产者的顺序不变
+TEST(msg_test, inbox_test) {
+    mmp->init_queue_msg("queue_inbox", 0, INBOX_MPSC);
+    for (int i = 0; i < 6; ++i) {
+        BasicProperties properties;
+        properties.set_id(uuid_helper::uuid());
+        properties.set_delivery_mode(i % 3 == 0 ? DeliveryMode::DURABLE : DeliveryMode::UNDURABLE);
+        mmp->insert("queue_inbox", &properties, "msg-" + std::to_string(i), true);
+    }
+    ASSERT_EQ(mmp->getable_count("queue_inbox"), 6);
+    for (int i = 0; i < 6; ++i)
+        ASSERT_EQ(mmp->front("queue_inbox")->payload().body(), "msg-" + std::to_string(i));
+    ASSERT_EQ(mmp->getable_count("queue_inbox"), 0);
+    ASSERT_EQ(mmp->front("queue_inbox"), nullptr);
+    mmp->destroy_queue_msg("queue_inbox");
+}
 // 销毁测试
 TEST(message_test, clear_test) {
     // 前面都clear了很多次了，不测了
@@ -0,0 +1,134 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+// 队列存储的微基准: 比较 std::list 和分段环形缓冲区(msg_ring)的入队/出队吞吐和内存占用，
+// 再测一遍 queue_message 完整的 insert -> front -> ack 流程，
+// 最后是多个发布线程 + 一个推送线程的竞争场景，比较加锁入队和无锁入口(x-inbox-mode)
+// usage: ./queue_bench [messages] [producers]
+
+#include "../mqserver/message.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <thread>
+
+static std::atomic<size_t> g_alloc_bytes(0); // 当前还没有释放的堆内存(不含 malloc 自身的开销)
+
+void* operator new(size_t n) {
+    size_t* p = (size_t*)std::malloc(n + sizeof(size_t));
+    if (p == nullptr)
+        throw std::bad_alloc();
+    *p = n;
+    g_alloc_bytes += n;
+    return p + 1;
+}
+void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr)
+        return;
+    size_t* p = (size_t*)ptr - 1;
+    g_alloc_bytes -= *p;
+    std::free(p);
+}
+void* operator new[](size_t n) { return operator new(n); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+
+using namespace hare_mq;
+
+template <typename Q>
+void bench_container(const char* name, const std::vector<message_ptr>& msgs) {
+    Q q;
+    size_t base = g_alloc_bytes;
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& m : msgs)
+        q.push_back(m);
+    auto t1 = std::chrono::steady_clock::now();
+    size_t bytes = g_alloc_bytes - base;
+    while (!q.empty())
+        q.pop_front();
+    auto t2 = std::chrono::steady_clock::now();
+    double enq = std::chrono::duration<double>(t1 - t0).count();
+    double deq = std::chrono::duration<double>(t2 - t1).count();
+    LOG(INFO) << name << ": enqueue " << std::to_string((size_t)(msgs.size() / enq)) << " msg/s"
+              << ", dequeue " << std::to_string((size_t)(msgs.size() / deq)) << " msg/s"
+              << ", bytes/msg " << std::to_string(bytes * 1.0 / msgs.size()) << std::endl;
+}
+
+void bench_queue_message(size_t n) {
+    queue_message qm("./data-queue-bench/", "bench_queue");
+    BasicProperties bp;
+    bp.set_delivery_mode(DeliveryMode::UNDURABLE);
+    std::string body(64, 'x');
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) {
+        bp.set_id(std::to_string(i));
+        qm.insert(&bp, body, false);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    std::vector<uint64_t> seqs(1);
+    for (size_t i = 0; i < n; ++i) {
+        qm.front(&seqs[0]);
+        qm.remove(seqs);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    double ins = std::chrono::duration<double>(t1 - t0).count();
+    double ack = std::chrono::duration<double>(t2 - t1).count();
+    LOG(INFO) << "queue_message: insert " << std::to_string((size_t)(n / ins)) << " msg/s"
+              << ", front+ack " << std::to_string((size_t)(n / ack)) << " msg/s" << std::endl;
+    qm.clear();
+}
+
+void bench_contention(const char* name, queue_inbox_mode mode, size_t producers, size_t n) {
+    queue_message qm("./data-queue-bench/", "bench_contention", 0, mode);
+    std::string body(64, 'x');
+    size_t per_producer = n / producers;
+    size_t total = per_producer * producers;
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&qm, &body, per_producer]() {
+            BasicProperties bp;
+            bp.set_delivery_mode(DeliveryMode::UNDURABLE);
+            for (size_t i = 0; i < per_producer; ++i)
+                qm.insert(&bp, body, false);
+        });
+    }
+    std::thread consumer([&qm, total]() {
+        std::vector<uint64_t> seqs(1);
+        size_t received = 0;
+        while (received < total) {
+            if (qm.front(&seqs[0]) == nullptr)
+                continue; // 忙等，只测队列本身
+            qm.remove(seqs);
+            ++received;
+        }
+    });
+    for (auto& t : threads)
+        t.join();
+    consumer.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    LOG(INFO) << name << " producers: " << std::to_string(producers)
+              << ", " << std::to_string((size_t)(total / seconds)) << " msg/s" << std::endl;
+    qm.clear();
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    size_t producers = argc > 2 ? std::stoul(argv[2]) : 4;
+    std::vector<message_ptr> msgs;
+    msgs.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        msgs.push_back(std::make_shared<Message>());
+    bench_container<std::list<message_ptr>>("std::list", msgs);
+    bench_container<msg_ring>("msg_ring ", msgs);
+    bench_queue_message(n);
+    bench_contention("mutex", INBOX_NONE, 1, n);
+    bench_contention("mpsc ", INBOX_MPSC, 1, n);
+    bench_contention("mutex", INBOX_NONE, producers, n);
+    bench_contention("mpsc ", INBOX_MPSC, producers, n);
+    return 0;
+}
@@ -125,6 +125,61 @@ TEST(route_test, route) {
     }
 }
 
+// 一致性哈希环: 按权重分布，增加队列时只有少部分 key 改变去向
+TEST(route_test, hash_ring) {
+    ASSERT_EQ(router::hash_weight("3"), 3);
+    ASSERT_EQ(router::hash_weight(""), 1);
+    ASSERT_EQ(router::hash_weight("abc"), 1);
+    ASSERT_EQ(router::hash_weight("99999"), HASH_RING_MAX_WEIGHT);
+    hash_ring ring;
+    ASSERT_EQ(ring.select("key"), "");
+    ring.add("queue1", 1);
+    ring.add("queue2", 3);
+    std::unordered_map<std::string, int> count;
+    std::vector<std::string> before;
+    for (int i = 0; i < 10000; ++i) {
+        before.push_back(ring.select("key" + std::to_string(i)));
+        count[before.back()]++;
+    }
+    ASSERT_GT(count["queue2"], count["queue1"] * 2); // 权重 1:3
+    ring.add("queue3", 1);
+    int moved = 0;
+    for (int i = 0; i < 10000; ++i) {
+        std::string now = ring.select("key" + std::to_string(i));
+        if (now != before[i]) {
+            ASSERT_EQ(now, "queue3"); // 只会迁移到新加入的队列
+            ++moved;
+        }
+    }
+    ASSERT_GT(moved, 0);
+    ASSERT_LT(moved, 4000);
+    ring.remove("queue3");
+    for (int i = 0; i < 10000; ++i)
+        ASSERT_EQ(ring.select("key" + std::to_string(i)), before[i]);
+}
+
+// 头部倒排索引: 只统计消息头部命中的绑定
+TEST(route_test, headers_index) {
+    headers_index index;
+    index.bind("queue1", "region=eu&tenant=t1"); // 默认 x-match=all
+    index.bind("queue2", "x-match=any&region=eu&region=us");
+    index.bind("queue3", "x-match=all");
+    google::protobuf::Map<std::string, std::string> headers;
+    headers["region"] = "eu";
+    std::vector<std::string> qnames = index.select(headers);
+    std::sort(qnames.begin(), qnames.end());
+    ASSERT_EQ(qnames, std::vector<std::string>({ "queue2", "queue3" }));
+    headers["tenant"] = "t1";
+    qnames = index.select(headers);
+    ASSERT_EQ(qnames.size(), 3);
+    index.remove("queue1");
+    index.remove("queue3");
+    qnames = index.select(headers);
+    ASSERT_EQ(qnames, std::vector<std::string>({ "queue2" }));
+    index.remove("queue2");
+    ASSERT_EQ(index.empty(), true);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     testing::AddGlobalTestEnvironment(new route_test);
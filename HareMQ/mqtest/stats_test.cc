@@ -0,0 +1,135 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#include "../mqserver/stats.hpp"
+#include "../mqserver/virtual_host.hpp"
+#include <gtest/gtest.h>
+
+using namespace hare_mq;
+
+class stats_test : public testing::Test {
+public:
+    void SetUp() override {
+        std::unordered_map<std::string, std::string> empty_map;
+        __host = std::make_shared<virtual_host>("stats_host", "./stats_host/message/", "./stats_host/stats_host.db");
+        __host->declare_exchange("order.direct", ExchangeType::DIRECT, true, false, empty_map);
+        __host->declare_exchange("order.topic", ExchangeType::TOPIC, false, false, empty_map);
+        __host->declare_exchange("user.fanout", ExchangeType::FANOUT, true, false, empty_map);
+        for (int i = 0; i < 5; ++i)
+            __host->declare_queue("order.q" + std::to_string(i), true, false, false, empty_map);
+        __host->declare_queue("user.q", false, false, false, empty_map);
+        __host->bind("order.direct", "order.q1", "key1");
+        __host->bind("order.direct", "order.q0", "key0");
+        __host->bind("user.fanout", "user.q", "");
+        __cmp = std::make_shared<consumer_manager>();
+        __cmp->init_queue_consumer("order.q0");
+        __cmp->init_queue_consumer("user.q");
+        __cmp->create("c2", "order.q0", false, nullptr);
+        __cmp->create("c1", "order.q0", true, nullptr);
+        __cmp->create("c3", "user.q", false, nullptr);
+    }
+    void TearDown() override {
+        __host->clear();
+    }
+    statsResponse query(StatsSection section, const std::string& prefix = "", uint32_t offset = 0, uint32_t limit = 0) {
+        statsRequest req;
+        req.set_section(section);
+        req.set_name_prefix(prefix);
+        req.set_offset(offset);
+        req.set_limit(limit);
+        req.set_include_bindings(true);
+        statsResponse resp;
+        stats_query::fill(req, *__host->topology(), *__cmp->snapshot(), &resp);
+        return resp;
+    }
+
+public:
+    virtual_host::ptr __host;
+    consumer_manager::ptr __cmp;
+};
+
+TEST_F(stats_test, snapshot_version) {
+    topology_snapshot::ptr s1 = __host->topology();
+    ASSERT_EQ(s1, __host->topology()); // 拓扑没有变化，复用同一个快照
+    ASSERT_EQ(s1->exchanges.size(), 3);
+    ASSERT_EQ(s1->queues.size(), 6);
+    __host->basic_publish("order.q0", nullptr, "hello"); // 发布消息不影响拓扑
+    ASSERT_EQ(s1, __host->topology());
+    __host->unbind("order.direct", "order.q1");
+    topology_snapshot::ptr s2 = __host->topology();
+    ASSERT_NE(s1, s2);
+    ASSERT_GT(s2->version, s1->version);
+    ASSERT_EQ(s1->exchanges[0].bindings.size(), 2); // 旧快照不受影响
+    ASSERT_EQ(s2->exchanges[0].bindings.size(), 1);
+    consumer_snapshot::ptr c1 = __cmp->snapshot();
+    ASSERT_EQ(c1, __cmp->snapshot());
+    __cmp->remove("c3", "user.q");
+    ASSERT_NE(c1, __cmp->snapshot());
+    ASSERT_EQ(__cmp->snapshot()->consumers.size(), 2);
+}
+
+TEST_F(stats_test, entries) {
+    BasicProperties bp;
+    for (int i = 0; i < 3; ++i) {
+        bp.set_id("stats-" + std::to_string(i));
+        __host->basic_publish("order.q0", &bp, "hello");
+    }
+    __host->basic_get("order.q0", 1, 0);
+    statsResponse resp = query(STATS_ALL);
+    ASSERT_EQ(resp.total_exchanges(), 3);
+    ASSERT_EQ(resp.total_queues(), 6);
+    ASSERT_EQ(resp.total_consumers(), 3);
+    // 按名称排序
+    ASSERT_EQ(resp.exchanges(0).name(), "order.direct");
+    ASSERT_EQ(resp.exchanges(0).type(), ExchangeType::DIRECT);
+    ASSERT_EQ(resp.exchanges(0).binding_count(), 2);
+    ASSERT_EQ(resp.exchanges(0).bindings(0).queue_name(), "order.q0");
+    ASSERT_EQ(resp.exchanges(0).bindings(1).binding_key(), "key1");
+    ASSERT_EQ(resp.exchanges(1).durable(), false);
+    const queueStats& q0 = resp.queues(0);
+    ASSERT_EQ(q0.name(), "order.q0");
+    ASSERT_EQ(q0.depth(), 2);
+    ASSERT_EQ(q0.unacked(), 1);
+    ASSERT_EQ(q0.consumer_count(), 2);
+    ASSERT_EQ(q0.published(), 3);
+    ASSERT_EQ(q0.delivered(), 1);
+    ASSERT_EQ(resp.queues(5).name(), "user.q");
+    ASSERT_EQ(resp.queues(5).consumer_count(), 1);
+    ASSERT_EQ(resp.consumers(0).tag(), "c1");
+    ASSERT_EQ(resp.consumers(0).auto_ack(), true);
+    ASSERT_EQ(resp.consumers(2).queue_name(), "user.q");
+}
+
+TEST_F(stats_test, filter_and_page) {
+    statsResponse resp = query(STATS_QUEUES, "order.", 1, 2);
+    ASSERT_EQ(resp.exchanges_size(), 0);
+    ASSERT_EQ(resp.consumers_size(), 0);
+    ASSERT_EQ(resp.total_queues(), 5);
+    ASSERT_EQ(resp.queues_size(), 2);
+    ASSERT_EQ(resp.queues(0).name(), "order.q1");
+    ASSERT_EQ(resp.queues(1).name(), "order.q2");
+    resp = query(STATS_QUEUES, "order.", 4, 2);
+    ASSERT_EQ(resp.queues_size(), 1);
+    ASSERT_EQ(resp.queues(0).name(), "order.q4");
+    resp = query(STATS_QUEUES, "order.", 10, 2);
+    ASSERT_EQ(resp.queues_size(), 0);
+    resp = query(STATS_EXCHANGES, "user");
+    ASSERT_EQ(resp.total_exchanges(), 1);
+    ASSERT_EQ(resp.exchanges(0).name(), "user.fanout");
+    resp = query(STATS_CONSUMERS, "user.");
+    ASSERT_EQ(resp.total_consumers(), 1);
+    ASSERT_EQ(resp.consumers(0).tag(), "c3");
+    resp = query(STATS_EXCHANGES, "none");
+    ASSERT_EQ(resp.total_exchanges(), 0);
+    ASSERT_EQ(resp.exchanges_size(), 0);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    auto res = RUN_ALL_TESTS();
+    LOG(INFO) << "res: " << res << std::endl;
+    return 0;
+}
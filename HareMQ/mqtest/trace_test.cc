@@ -0,0 +1,118 @@
+/*
+ * Write by Yufc
+ * See https://github.com/ffengc/HareMQ
+ * please cite my project link: https://github.com/ffengc/HareMQ when you use this code
+ */
+
+#include "../mqcommon/logger.hpp"
+#include "../mqserver/message.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace hare_mq;
+
+// 追踪器在整个进程内共享，每个用例开始前清空
+class trace_test : public testing::Test {
+public:
+    void SetUp() override {
+        tracer::instance().set_sample_every(0);
+        tracer::instance().clear();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1)); // clear 按时间过滤，之后的事件时间要严格更晚
+    }
+    void TearDown() override {
+        tracer::instance().set_sample_every(0);
+    }
+};
+
+TEST_F(trace_test, off_by_default) {
+    for (int i = 0; i < 100; ++i) {
+        trace_context ctx(tracer::instance().sample());
+        ASSERT_EQ(tracer::current(), 0);
+        trace_scope scope(TRACE_ROUTE);
+    }
+    ASSERT_TRUE(tracer::instance().events().empty());
+}
+
+TEST_F(trace_test, sampling_and_stages) {
+    tracer::instance().set_sample_every(4);
+    size_t sampled = 0;
+    for (int i = 0; i < 100; ++i) {
+        trace_context ctx(tracer::instance().sample());
+        if (tracer::current() != 0)
+            ++sampled;
+        trace_scope lookup(TRACE_LOOKUP);
+        trace_scope route(TRACE_ROUTE);
+    }
+    ASSERT_EQ(sampled, 25);
+    ASSERT_EQ(tracer::current(), 0); // 退出作用域之后恢复
+    std::vector<trace_event> events = tracer::instance().events();
+    ASSERT_EQ(events.size(), 50);
+    for (const auto& e : events) {
+        ASSERT_NE(e.id, 0);
+        ASSERT_LE(e.begin_ns, e.end_ns);
+    }
+    std::string json = tracer::instance().to_chrome_json();
+    ASSERT_EQ(json.compare(0, 15, "{\"traceEvents\":"), 0);
+    ASSERT_NE(json.find("\"name\":\"route\""), std::string::npos);
+    ASSERT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST_F(trace_test, across_threads) {
+    // 发布线程采样，消息带着追踪id，推送线程接着记录
+    tracer::instance().set_sample_every(1);
+    queue_message qm("./data-trace/", "trace_queue");
+    uint64_t id = 0;
+    {
+        trace_context ctx(tracer::instance().sample());
+        id = tracer::current();
+        BasicProperties bp;
+        bp.set_id("trace-1");
+        bp.set_delivery_mode(DeliveryMode::DURABLE);
+        qm.insert(&bp, "hello", true);
+    }
+    ASSERT_NE(id, 0);
+    std::thread t([&qm]() {
+        message_ptr mp = qm.front();
+        trace_context ctx(mp->trace_id());
+        trace_scope send(TRACE_DELIVERY_SEND);
+    });
+    t.join();
+    std::vector<trace_event> events = tracer::instance().events();
+    bool disk = false, send = false;
+    uint32_t disk_tid = 0, send_tid = 0;
+    for (const auto& e : events) {
+        ASSERT_EQ(e.id, id);
+        if (e.stage == TRACE_DISK_WRITE) {
+            disk = true;
+            disk_tid = e.tid;
+        }
+        if (e.stage == TRACE_DELIVERY_SEND) {
+            send = true;
+            send_tid = e.tid;
+        }
+    }
+    ASSERT_TRUE(disk);
+    ASSERT_TRUE(send);
+    ASSERT_NE(disk_tid, send_tid);
+    qm.clear();
+}
+
+TEST_F(trace_test, ring_wraps) {
+    tracer::instance().set_sample_every(1);
+    std::thread t([]() {
+        for (int i = 0; i < TRACE_RING_CAPACITY + 100; ++i) {
+            trace_context ctx(tracer::instance().sample());
+            trace_scope scope(TRACE_ROUTE);
+        }
+    });
+    t.join();
+    // 只保留最近的事件，写满之后最老的一个位置就是下一次写入的位置，读取时总是丢掉
+    ASSERT_EQ(tracer::instance().events().size(), TRACE_RING_CAPACITY - 1);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    auto res = RUN_ALL_TESTS();
+    LOG(INFO) << "res: " << res << std::endl;
+    return 0;
+}